@@ -0,0 +1,52 @@
+#include <LSD/Format.h>
+
+#include <chrono>
+#include <cstdio>
+
+// compares lsd::format(), which grows the output in a single pass, with lsd::formatSized(), which counts the output first and writes it in a second pass
+
+template <class Function> static double measure(std::size_t iterations, std::size_t& checksum, Function function) {
+	auto begin = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i) checksum += function(i).size();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(iterations);
+}
+
+template <class Format, class FormatSized> static void run(const char* name, std::size_t iterations, Format format, FormatSized formatSized) {
+	std::size_t checksum = 0;
+
+	auto single = measure(iterations, checksum, format);
+	auto sized = measure(iterations, checksum, formatSized);
+
+	std::printf("%-24s format: %8.1f ns    formatSized: %8.1f ns    (checksum %zu)\n", name, single, sized, checksum);
+}
+
+int main() {
+	constexpr std::size_t iterations = 200000;
+
+	run("short integers", iterations,
+		[](std::size_t i) { return lsd::format("{} + {} = {}", i, i * 3, i * 4); },
+		[](std::size_t i) { return lsd::formatSized("{} + {} = {}", i, i * 3, i * 4); }
+	);
+
+	run("long literal text", iterations,
+		[](std::size_t i) { return lsd::format("The quick brown fox jumps over the lazy dog, iteration {} of the benchmark, and then the dog jumps back over the fox.", i); },
+		[](std::size_t i) { return lsd::formatSized("The quick brown fox jumps over the lazy dog, iteration {} of the benchmark, and then the dog jumps back over the fox.", i); }
+	);
+
+	run("floating point fields", iterations,
+		[](std::size_t i) { return lsd::format("{} {} {} {} {} {}", i * 0.1, i * 0.2, i * 0.3, i * 1e-7, i * 1e7, i * 3.14159); },
+		[](std::size_t i) { return lsd::formatSized("{} {} {} {} {} {}", i * 0.1, i * 0.2, i * 0.3, i * 1e-7, i * 1e7, i * 3.14159); }
+	);
+
+	run("padded fields", iterations,
+		[](std::size_t i) { return lsd::format("[{:>32}] [{:<32}] [{:^32}]", i, i * 7, i * 13); },
+		[](std::size_t i) { return lsd::formatSized("[{:>32}] [{:<32}] [{:^32}]", i, i * 7, i * 13); }
+	);
+
+	run("wide strings", iterations,
+		[](std::size_t i) { return lsd::format(L"{} + {} = {}", i, i * 3, i * 4); },
+		[](std::size_t i) { return lsd::formatSized(L"{} + {} = {}", i, i * 3, i * 4); }
+	);
+}
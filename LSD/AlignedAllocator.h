@@ -0,0 +1,86 @@
+/*************************
+ * @file AlignedAllocator.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Allocator with a guaranteed alignment for SIMD and cache line sized storage
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Detail/CoreUtility.h"
+
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+
+namespace lsd {
+
+inline constexpr std::size_t cacheLineSize = 64;
+
+/**
+ * @brief Allocator which aligns every allocation to at least Align bytes
+ *
+ * @details Containers which support it round their capacities up to a multiple of capacityGranularity elements,
+ * so the storage always ends on an alignment boundary as well and SIMD loops can process whole registers past the size.
+ *
+ * @tparam Ty type to allocate
+ * @tparam Align alignment in bytes, a power of two, which is raised to the alignment of Ty if it is smaller
+ */
+template <class Ty, std::size_t Align = cacheLineSize> class AlignedAllocator {
+public:
+	static_assert(Align != 0 && (Align & (Align - 1)) == 0, "lsd::AlignedAllocator: Alignment has to be a power of two!");
+
+	using value_type = Ty;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+
+	using propagate_on_container_move_assignment = std::true_type;
+	using is_always_equal = std::true_type;
+
+	template <class Other> struct rebind {
+		using other = AlignedAllocator<Other, Align>;
+	};
+
+	static constexpr size_type alignment = std::max(Align, alignof(value_type));
+	static constexpr size_type capacityGranularity = alignment / std::gcd(alignment, sizeof(value_type)); // smallest element count filling whole alignment blocks
+
+	constexpr AlignedAllocator() noexcept = default;
+	template <class Other> constexpr AlignedAllocator(const AlignedAllocator<Other, Align>&) noexcept { }
+
+	[[nodiscard]] constexpr value_type* allocate(size_type count) {
+		if consteval {
+			return std::allocator<value_type>().allocate(count);
+		} else {
+			if (count > maxSize()) LSD_THROW(std::bad_array_new_length());
+			return static_cast<value_type*>(::operator new(count * sizeof(value_type), std::align_val_t(alignment)));
+		}
+	}
+	constexpr void deallocate(value_type* pointer, size_type count) noexcept {
+		if consteval {
+			std::allocator<value_type>().deallocate(pointer, count);
+		} else {
+			::operator delete(pointer, count * sizeof(value_type), std::align_val_t(alignment));
+		}
+	}
+
+	[[nodiscard]] constexpr size_type maxSize() const noexcept {
+		return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(value_type);
+	}
+	[[nodiscard]] constexpr size_type max_size() const noexcept {
+		return maxSize();
+	}
+
+	template <class Other> [[nodiscard]] friend constexpr bool operator==(const AlignedAllocator&, const AlignedAllocator<Other, Align>&) noexcept {
+		return true;
+	}
+};
+
+} // namespace lsd
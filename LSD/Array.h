@@ -11,11 +11,14 @@
 #pragma once
 
 #include "Iterators.h"
+#include "Detail/CoreUtility.h"
+#include "AlignedAllocator.h"
 
 #include <cassert>
 #include <utility>
 #include <algorithm>
 #include <stdexcept>
+#include <limits>
 
 namespace lsd {
 
@@ -105,11 +108,11 @@ template <class Ty, std::size_t Size> struct Array {
 		return m_array[index];
 	}
 	[[nodiscard]] constexpr reference at(size_type index) {
-		if (index > Size) throw std::out_of_range("lsd::Array::at: Index exceded array bounds!");
+		if (index > Size) LSD_THROW(std::out_of_range("lsd::Array::at: Index exceded array bounds!"));
 		return m_array[index];
 	}
 	[[nodiscard]] constexpr const_reference at(size_type index) const {
-		if (index > Size) throw std::out_of_range("lsd::Array::at: Index exceded array bounds!");
+		if (index > Size) LSD_THROW(std::out_of_range("lsd::Array::at: Index exceded array bounds!"));
 		return m_array[index];
 	}
 
@@ -132,11 +135,19 @@ template <class Ty, std::size_t Size> struct Array {
 	array m_array;
 };
 
+/**
+ * @brief Array aligned to Align bytes, for example for aligned SIMD loads or to keep per thread data on separate cache lines
+ *
+ * @details Its size is rounded up to a multiple of the alignment. It is initialized like an Array.
+ */
+template <class Ty, std::size_t Size, std::size_t Align = cacheLineSize> struct alignas(std::max(Align, alignof(Ty))) AlignedArray : Array<Ty, Size> { };
+
 
 // array type trait
 
 template <class Ty> struct IsArray : std::is_array<Ty> { };
 template <class Ty, std::size_t Size> struct IsArray<Array<Ty, Size>> : std::true_type { };
+template <class Ty, std::size_t Size, std::size_t Align> struct IsArray<AlignedArray<Ty, Size, Align>> : std::true_type { };
 
 template <class Ty> inline constexpr bool isArrayValue = IsArray<Ty>::value;
 
@@ -0,0 +1,269 @@
+/*************************
+ * @file CaseFolding.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief ASCII case conversion and case insensitive comparison and hashing
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "String.h"
+#include "StringView.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace lsd {
+
+namespace detail {
+
+// only the ASCII letters are folded, every other character including the bytes of multibyte UTF-8 sequences stays as it is
+
+template <class CharTy> [[nodiscard]] constexpr CharTy asciiToLower(CharTy c) noexcept {
+	return (c >= CharTy('A') && c <= CharTy('Z')) ? static_cast<CharTy>(c + (CharTy('a') - CharTy('A'))) : c;
+}
+template <class CharTy> [[nodiscard]] constexpr CharTy asciiToUpper(CharTy c) noexcept {
+	return (c >= CharTy('a') && c <= CharTy('z')) ? static_cast<CharTy>(c - (CharTy('a') - CharTy('A'))) : c;
+}
+
+#if defined(__SSE2__)
+
+// signed comparisons exclude the bytes at or above 0x80, since they are negative
+
+template <bool Upper> [[nodiscard]] inline __m128i asciiConvertCase(__m128i v) noexcept {
+	auto inRange = _mm_and_si128(
+		_mm_cmpgt_epi8(v, _mm_set1_epi8(Upper ? 'a' - 1 : 'A' - 1)),
+		_mm_cmplt_epi8(v, _mm_set1_epi8(Upper ? 'z' + 1 : 'Z' + 1))
+	);
+
+	return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi8(0x20)));
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+template <bool Upper> [[nodiscard]] inline __m256i asciiConvertCase(__m256i v) noexcept {
+	auto inRange = _mm256_and_si256(
+		_mm256_cmpgt_epi8(v, _mm256_set1_epi8(Upper ? 'a' - 1 : 'A' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8(Upper ? 'z' + 1 : 'Z' + 1), v)
+	);
+
+	return _mm256_xor_si256(v, _mm256_and_si256(inRange, _mm256_set1_epi8(0x20)));
+}
+
+#endif
+
+template <bool Upper, class CharTy> constexpr void asciiConvertCase(const CharTy* source, CharTy* dest, std::size_t size) noexcept {
+	std::size_t i = 0;
+
+#if defined(__SSE2__)
+	if constexpr (sizeof(CharTy) == 1) {
+		if (!std::is_constant_evaluated()) {
+#if defined(__AVX2__)
+			for (; i + 32 <= size; i += 32) {
+				auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), asciiConvertCase<Upper>(v));
+			}
+#endif
+			for (; i + 16 <= size; i += 16) {
+				auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), asciiConvertCase<Upper>(v));
+			}
+		}
+	}
+#endif
+
+	for (; i < size; i++) dest[i] = Upper ? asciiToUpper(source[i]) : asciiToLower(source[i]);
+}
+
+// index of the first characters which differ ignoring case, or size if there are none
+template <class CharTy> [[nodiscard]] constexpr std::size_t caselessMismatch(const CharTy* first, const CharTy* second, std::size_t size) noexcept {
+	std::size_t i = 0;
+
+#if defined(__SSE2__)
+	if constexpr (sizeof(CharTy) == 1) {
+		if (!std::is_constant_evaluated()) {
+#if defined(__AVX2__)
+			for (; i + 32 <= size; i += 32) {
+				auto a = asciiConvertCase<false>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)));
+				auto b = asciiConvertCase<false>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + i)));
+
+				if (auto mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); mask != 0)
+					return i + static_cast<std::size_t>(std::countr_zero(mask));
+			}
+#endif
+			for (; i + 16 <= size; i += 16) {
+				auto a = asciiConvertCase<false>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)));
+				auto b = asciiConvertCase<false>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i)));
+
+				if (auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) ^ 0xFFFFu; mask != 0)
+					return i + static_cast<std::size_t>(std::countr_zero(mask));
+			}
+		}
+	}
+#endif
+
+	for (; i < size; i++)
+		if (asciiToLower(first[i]) != asciiToLower(second[i])) return i;
+
+	return size;
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Convert the ASCII letters of a string to lower case in place
+ *
+ * @details Uses SSE2 or AVX2 to convert 16 or 32 characters per step for single byte characters when available.
+ * Characters outside of ASCII, including the bytes of multibyte UTF-8 sequences, are left unchanged.
+ *
+ * @param string string to convert
+ *
+ * @return Reference to the string
+ */
+template <class CharTy, class Traits, class Alloc, std::size_t N> constexpr BasicString<CharTy, Traits, Alloc, N>& toLowerInPlace(BasicString<CharTy, Traits, Alloc, N>& string) noexcept {
+	detail::asciiConvertCase<false>(string.data(), string.data(), string.size());
+	return string;
+}
+/**
+ * @brief Convert the ASCII letters of a string to upper case in place
+ *
+ * @param string string to convert
+ *
+ * @return Reference to the string
+ */
+template <class CharTy, class Traits, class Alloc, std::size_t N> constexpr BasicString<CharTy, Traits, Alloc, N>& toUpperInPlace(BasicString<CharTy, Traits, Alloc, N>& string) noexcept {
+	detail::asciiConvertCase<true>(string.data(), string.data(), string.size());
+	return string;
+}
+
+/**
+ * @brief Copy a string with its ASCII letters converted to lower case
+ *
+ * @param string string to convert
+ *
+ * @return The converted string
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr BasicString<CharTy, Traits> toLower(BasicStringView<CharTy, Traits> string) {
+	BasicString<CharTy, Traits> result;
+	result.resizeAndOverwrite(string.size(), [string](CharTy* data, std::size_t size) {
+		detail::asciiConvertCase<false>(string.data(), data, size);
+		return size;
+	});
+
+	return result;
+}
+/**
+ * @brief Copy a string with its ASCII letters converted to upper case
+ *
+ * @param string string to convert
+ *
+ * @return The converted string
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr BasicString<CharTy, Traits> toUpper(BasicStringView<CharTy, Traits> string) {
+	BasicString<CharTy, Traits> result;
+	result.resizeAndOverwrite(string.size(), [string](CharTy* data, std::size_t size) {
+		detail::asciiConvertCase<true>(string.data(), data, size);
+		return size;
+	});
+
+	return result;
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N> [[nodiscard]] constexpr BasicString<CharTy, Traits> toLower(const BasicString<CharTy, Traits, Alloc, N>& string) {
+	return toLower(BasicStringView<CharTy, Traits>(string));
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N> [[nodiscard]] constexpr BasicString<CharTy, Traits> toUpper(const BasicString<CharTy, Traits, Alloc, N>& string) {
+	return toUpper(BasicStringView<CharTy, Traits>(string));
+}
+
+/**
+ * @brief Check if two strings are equal ignoring the case of ASCII letters
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr bool iequals(BasicStringView<CharTy, Traits> first, std::type_identity_t<BasicStringView<CharTy, Traits>> second) noexcept {
+	return first.size() == second.size() && detail::caselessMismatch(first.data(), second.data(), first.size()) == first.size();
+}
+/**
+ * @brief Compare two strings lexicographically ignoring the case of ASCII letters
+ *
+ * @return A negative value if first is ordered before second, 0 if they are equal and a positive value otherwise
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr int icompare(BasicStringView<CharTy, Traits> first, std::type_identity_t<BasicStringView<CharTy, Traits>> second) noexcept {
+	auto size = std::min(first.size(), second.size());
+	auto i = detail::caselessMismatch(first.data(), second.data(), size);
+
+	if (i != size) {
+		using unsigned_type = std::make_unsigned_t<CharTy>;
+
+		auto a = static_cast<unsigned_type>(detail::asciiToLower(first[i]));
+		auto b = static_cast<unsigned_type>(detail::asciiToLower(second[i]));
+
+		return (a < b) ? -1 : 1;
+	}
+
+	return (first.size() < second.size()) ? -1 : (first.size() > second.size());
+}
+template <class String> [[nodiscard]] constexpr bool iequals(const String& first, const String& second) noexcept requires requires { typename String::view_type; } {
+	return iequals(typename String::view_type(first), typename String::view_type(second));
+}
+template <class String> [[nodiscard]] constexpr int icompare(const String& first, const String& second) noexcept requires requires { typename String::view_type; } {
+	return icompare(typename String::view_type(first), typename String::view_type(second));
+}
+
+
+/**
+ * @brief Transparent hash ignoring the case of ASCII letters, to be used together with CaselessEqual
+ *
+ * @details Hashes the same way as Hash<BasicStringView>, but on the lower case characters
+ *
+ * @tparam CharTy character type
+ */
+template <class CharTy = char> struct CaselessHash {
+	using is_transparent = void;
+	using view_type = BasicStringView<CharTy>;
+
+	constexpr std::size_t operator()(view_type s) const noexcept {
+		std::size_t hash = 5381;
+
+		for (auto c : s) hash = ((hash << 5) + hash) ^ static_cast<std::size_t>(detail::asciiToLower(c));
+
+		return hash;
+	}
+	template <class String> constexpr std::size_t operator()(const String& s) const noexcept requires std::is_convertible_v<const String&, view_type> {
+		return (*this)(view_type(s));
+	}
+};
+
+/**
+ * @brief Transparent equality ignoring the case of ASCII letters
+ *
+ * @tparam CharTy character type
+ */
+template <class CharTy = char> struct CaselessEqual {
+	using is_transparent = void;
+	using view_type = BasicStringView<CharTy>;
+
+	constexpr bool operator()(view_type first, view_type second) const noexcept {
+		return iequals(first, second);
+	}
+	template <class First, class Second> constexpr bool operator()(const First& first, const Second& second) const noexcept
+		requires (std::is_convertible_v<const First&, view_type> && std::is_convertible_v<const Second&, view_type>) {
+		return iequals(view_type(first), view_type(second));
+	}
+};
+
+} // namespace lsd
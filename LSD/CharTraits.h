@@ -15,6 +15,9 @@
 #include <cstdlib>
 #include <utility>
 #include <algorithm>
+#include <cstring>
+#include <cwchar>
+#include <type_traits>
 
 namespace lsd {
 
@@ -65,6 +68,8 @@ public:
 	}
 
 	constexpr static std::size_t length(const char_type* s) {
+		if (!std::is_constant_evaluated()) return std::strlen(s); // the C library versions are vectorized
+
 		std::size_t size = 0;
 
 		for (; !eq(*s, '\0'); s++, size++) { }
@@ -73,6 +78,8 @@ public:
 	}
 
 	constexpr static const char_type* find(const char_type* ptr, std::size_t count, const char_type& ch) {
+		if (!std::is_constant_evaluated()) return static_cast<const char_type*>(std::memchr(ptr, ch, count));
+
 		for (; count > 0; ptr++, count--) if (eq(*ptr, ch)) return ptr;
 		return nullptr;
 	}
@@ -126,10 +133,10 @@ public:
 	}
 
 	constexpr static bool eq(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) == static_cast<unsigned char>(b);
+		return a == b;
 	}
 	constexpr static bool lt(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+		return a < b;
 	}
 
 	constexpr static char_type* move(char_type* dst, const char_type* src, std::size_t count) {
@@ -154,6 +161,8 @@ public:
 	}
 
 	constexpr static std::size_t length(const char_type* s) {
+		if (!std::is_constant_evaluated()) return std::wcslen(s); // the C library versions are vectorized
+
 		std::size_t size = 0;
 
 		for (; !eq(*s, '\0'); s++, size++) { }
@@ -162,6 +171,8 @@ public:
 	}
 
 	constexpr static const char_type* find(const char_type* ptr, std::size_t count, const char_type& ch) {
+		if (!std::is_constant_evaluated()) return std::wmemchr(ptr, ch, count);
+
 		for (; count > 0; ptr++, count--) if (eq(*ptr, ch)) return ptr;
 		return nullptr;
 	}
@@ -304,10 +315,10 @@ public:
 	}
 
 	constexpr static bool eq(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) == static_cast<unsigned char>(b);
+		return a == b;
 	}
 	constexpr static bool lt(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+		return a < b;
 	}
 
 	constexpr static char_type* move(char_type* dst, const char_type* src, std::size_t count) {
@@ -393,10 +404,10 @@ public:
 	}
 
 	constexpr static bool eq(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) == static_cast<unsigned char>(b);
+		return a == b;
 	}
 	constexpr static bool lt(char_type a, char_type b) noexcept {
-		return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+		return a < b;
 	}
 
 	constexpr static char_type* move(char_type* dst, const char_type* src, std::size_t count) {
@@ -0,0 +1,184 @@
+/*************************
+ * @file BulkCopy.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Copying and relocating ranges of elements, lowered to memcpy and memmove where possible
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "../Iterators.h"
+
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+namespace lsd {
+
+namespace detail {
+
+// contiguous iterators are raw pointers, the library's own iterators and standard contiguous iterators like those of std::vector and std::string
+
+template <class It> concept ContiguousAddressIterator = std::is_pointer_v<It> ||
+	std::contiguous_iterator<It> ||
+	(std::is_same_v<typename std::iterator_traits<It>::iterator_category, std::contiguous_iterator_tag> && requires(const It& it) {
+		{ it.get() } -> std::convertible_to<const volatile void*>;
+	});
+
+template <ContiguousAddressIterator It> [[nodiscard]] constexpr auto iteratorAddress(const It& it) noexcept {
+	if constexpr (std::is_pointer_v<It>) return it;
+	else if constexpr (std::contiguous_iterator<It>) return std::to_address(it);
+	else return it.get();
+}
+
+// allocators which construct and destroy elements in the default way do not have to be called for trivial types
+
+template <class Alloc, class Ty> inline constexpr bool hasDefaultConstruct = !requires(Alloc& alloc, Ty* p, const Ty& v) { alloc.construct(p, v); };
+template <class Alloc, class Ty> inline constexpr bool hasDefaultDestroy = !requires(Alloc& alloc, Ty* p) { alloc.destroy(p); };
+
+template <class It, class Ty> inline constexpr bool isBulkAssignable = []() {
+	if constexpr (ContiguousAddressIterator<It>) {
+		using source_type = std::remove_cv_t<std::remove_pointer_t<decltype(iteratorAddress(std::declval<const It&>()))>>;
+		return std::is_same_v<source_type, Ty> && std::is_trivially_copyable_v<Ty>;
+	} else return false;
+}();
+
+template <class It, class Ty, class Alloc> inline constexpr bool isBulkCopyable = isBulkAssignable<It, Ty> && hasDefaultConstruct<Alloc, Ty>;
+
+template <class It> inline constexpr bool isMoveIterator = false;
+template <class It> inline constexpr bool isMoveIterator<std::move_iterator<It>> = true;
+
+template <class Ty, class Alloc> inline constexpr bool isBulkRelocatable = std::is_trivially_copyable_v<Ty> && hasDefaultConstruct<Alloc, Ty> && hasDefaultDestroy<Alloc, Ty>;
+
+
+/**
+ * @brief Copy construct a range into uninitialized memory
+ *
+ * @return Pointer behind the last constructed element
+ */
+template <class Alloc, class It, class Ty> constexpr Ty* uninitializedCopy(Alloc& alloc, It first, It last, Ty* dest) {
+	if constexpr (isMoveIterator<It>) {
+		if constexpr (isBulkCopyable<typename It::iterator_type, Ty, Alloc>) // moving a trivially copyable type copies it
+			if (!std::is_constant_evaluated()) return uninitializedCopy(alloc, first.base(), last.base(), dest);
+	} else if constexpr (isBulkCopyable<It, Ty, Alloc>) {
+		if (!std::is_constant_evaluated()) {
+			auto count = static_cast<std::size_t>(last - first);
+			if (count != 0) std::memcpy(dest, iteratorAddress(first), count * sizeof(Ty));
+
+			return dest + count;
+		}
+	}
+
+	for (; first != last; ++first, ++dest) std::allocator_traits<Alloc>::construct(alloc, dest, *first);
+	return dest;
+}
+
+/**
+ * @brief Copy assign a range to already constructed elements, which may overlap the range if they start in front of it
+ *
+ * @return Pointer behind the last assigned element
+ */
+template <class It, class Ty> constexpr Ty* copyRange(It first, It last, Ty* dest) {
+	if constexpr (isBulkAssignable<It, Ty>) {
+		if (!std::is_constant_evaluated()) {
+			auto count = static_cast<std::size_t>(last - first);
+			if (count != 0) std::memmove(dest, iteratorAddress(first), count * sizeof(Ty));
+
+			return dest + count;
+		}
+	}
+
+	for (; first != last; ++first, ++dest) *dest = *first;
+	return dest;
+}
+
+/**
+ * @brief Copy construct count copies of a value into uninitialized memory
+ *
+ * @return Pointer behind the last constructed element
+ */
+template <class Alloc, class Ty> constexpr Ty* uninitializedFill(Alloc& alloc, Ty* dest, std::size_t count, const Ty& value) {
+	if constexpr (sizeof(Ty) == 1 && std::is_trivially_copyable_v<Ty> && hasDefaultConstruct<Alloc, Ty>) {
+		if (!std::is_constant_evaluated()) {
+			if (count != 0) std::memset(dest, std::bit_cast<unsigned char>(value), count);
+			return dest + count;
+		}
+	}
+
+	for (; count > 0; count--, ++dest) std::allocator_traits<Alloc>::construct(alloc, dest, value);
+	return dest;
+}
+
+/**
+ * @brief Move a range into uninitialized memory which does not overlap it and destroy the source elements
+ *
+ * @return Pointer behind the last relocated element
+ */
+template <class Alloc, class Ty> constexpr Ty* uninitializedRelocate(Alloc& alloc, Ty* first, Ty* last, Ty* dest) {
+	if constexpr (isBulkRelocatable<Ty, Alloc>) {
+		if (!std::is_constant_evaluated()) {
+			auto count = static_cast<std::size_t>(last - first);
+			if (count != 0) std::memcpy(dest, first, count * sizeof(Ty));
+
+			return dest + count;
+		}
+	}
+
+	for (; first != last; ++first, ++dest) {
+		std::allocator_traits<Alloc>::construct(alloc, dest, std::move_if_noexcept(*first));
+		std::allocator_traits<Alloc>::destroy(alloc, first);
+	}
+
+	return dest;
+}
+
+/**
+ * @brief Move a range to a destination which may overlap it, where every slot of the destination outside of the range is uninitialized
+ *
+ * @details Afterwards, the slots of the range which are not part of the destination are uninitialized
+ *
+ * @return Pointer behind the last relocated element
+ */
+template <class Alloc, class Ty> constexpr Ty* relocateRange(Alloc& alloc, Ty* first, Ty* last, Ty* dest) {
+	auto count = static_cast<std::size_t>(last - first);
+
+	if (dest == first) return last;
+
+	if constexpr (isBulkRelocatable<Ty, Alloc>) {
+		if (!std::is_constant_evaluated()) {
+			if (count != 0) std::memmove(dest, first, count * sizeof(Ty));
+			return dest + count;
+		}
+	}
+
+	if (dest < first) return uninitializedRelocate(alloc, first, last, dest);
+
+	for (auto source = last, target = dest + count; source != first;) { // relocate backwards so no element is overwritten before it was moved
+		--source, --target;
+
+		std::allocator_traits<Alloc>::construct(alloc, target, std::move_if_noexcept(*source));
+		std::allocator_traits<Alloc>::destroy(alloc, source);
+	}
+
+	return dest + count;
+}
+
+/**
+ * @brief Destroy a range of elements, which does nothing for trivially destructible types
+ */
+template <class Alloc, class Ty> constexpr void destroyRange(Alloc& alloc, Ty* first, Ty* last) {
+	if constexpr (!std::is_trivially_destructible_v<Ty> || !hasDefaultDestroy<Alloc, Ty>)
+		for (; first != last; ++first) std::allocator_traits<Alloc>::destroy(alloc, first);
+}
+
+} // namespace detail
+
+} // namespace lsd
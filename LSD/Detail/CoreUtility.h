@@ -14,11 +14,22 @@
 #include "../MathExt.h"
 
 #include <cstddef>
+#include <cstdlib>
 #include <type_traits>
 #include <concepts>
 
 #include <memory>
 
+// exceptions, errors abort the program if they are disabled
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define LSD_EXCEPTIONS 1
+#define LSD_THROW(...) throw __VA_ARGS__
+#else
+#define LSD_EXCEPTIONS 0
+#define LSD_THROW(...) ::std::abort()
+#endif
+
 namespace lsd {
 
 // concepts
@@ -37,7 +48,13 @@ namespace detail {
 // hash map utility
 
 inline constexpr std::size_t hashmapBucketSizeCheck(std::size_t requested, std::size_t required) noexcept {
-	return (requested < required) ? nextPrime(required) : nextPrime(requested);
+	return tablePrimeAtLeast((requested < required) ? required : requested).divisor();
+}
+
+// the reciprocal of a bucket count, taken from the prime table if the count is one of its primes
+inline constexpr FastModulus hashmapBucketModulus(std::size_t bucketCount) noexcept {
+	const auto& prime = tablePrimeAtLeast(bucketCount);
+	return (prime.divisor() == bucketCount) ? prime : FastModulus(bucketCount);
 }
 
 
@@ -57,6 +74,13 @@ template <class Alloc> inline constexpr bool allocatorPropagationNecessary(const
 	else return traits_type::propagate_on_container_move_assignment::value && !(a1 == a2);
 }
 
+// allocators may request capacities which are multiples of a number of elements, for example to fill whole SIMD registers
+
+template <class Alloc> inline constexpr std::size_t allocatorCapacityGranularity = []() -> std::size_t {
+	if constexpr (requires { Alloc::capacityGranularity; }) return Alloc::capacityGranularity;
+	else return 1;
+}();
+
 } // namespace detail
 
 
@@ -171,8 +171,8 @@ template <std::size_t Count, class CharTy> struct Formatter<CharTy[Count], CharT
 	}
 };
 
-template <class Traits, class Alloc, class CharTy> struct Formatter<BasicString<CharTy, Traits, Alloc>, CharTy> {
-	void format(const BasicString<CharTy, Traits, Alloc>& value, BasicFormatContext<CharTy>& context) {
+template <class Traits, class Alloc, std::size_t N, class CharTy> struct Formatter<BasicString<CharTy, Traits, Alloc, N>, CharTy> {
+	void format(const BasicString<CharTy, Traits, Alloc, N>& value, BasicFormatContext<CharTy>& context) {
 		detail::StringFormatter<CharTy>::template format<const CharTy>(value.data(), value.size(), context);
 	}
 };
@@ -17,6 +17,8 @@
 
 #include <type_traits>
 #include <system_error>
+#include <charconv>
+#include <string>
 #include <cctype>
 #include <bit>
 
@@ -203,6 +205,49 @@ template <ContinuousIteratorType Iterator, class Numerical> constexpr bool eisel
 
 } // namespace detail
 
+namespace detail {
+
+// correctly rounded conversion through std::from_chars, characters of other types are narrowed into a buffer first
+
+template <class Numerical, IteratorType Iterator> FromCharsResult<Iterator> standardFloatFromChars(Iterator begin, Iterator end, Numerical& result, CharsFormat fmt) {
+	static constexpr std::size_t stackSize = 64;
+
+	auto format = static_cast<std::chars_format>(fmt);
+
+	if constexpr (std::is_pointer_v<Iterator> && sizeof(typename std::iterator_traits<Iterator>::value_type) == 1) {
+		auto first = reinterpret_cast<const char*>(begin);
+		auto res = std::from_chars(first, first + (end - begin), result, format);
+
+		return { begin + (res.ptr - first), res.ec };
+	} else {
+		// only ascii letters, digits and signs can be part of a number
+		auto isNumberChar = [](auto c) {
+			return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '+' || c == '-';
+		};
+
+		std::size_t size = 0;
+		for (auto it = begin; it != end && isNumberChar(*it); ++it) ++size;
+
+		char stack[stackSize];
+		std::string heap;
+
+		auto first = stack;
+		if (size > stackSize) {
+			heap.resize(size);
+			first = heap.data();
+		}
+
+		auto it = begin;
+		for (std::size_t i = 0; i < size; i++, ++it) first[i] = static_cast<char>(*it);
+
+		auto res = std::from_chars(first, first + size, result, format);
+
+		return { begin + (res.ptr - first), res.ec };
+	}
+}
+
+} // namespace detail
+
 template <class Numerical, IteratorType Iterator> constexpr FromCharsResult<Iterator> fromChars(
 	Iterator begin, 
 	Iterator end, 
@@ -212,20 +257,9 @@ template <class Numerical, IteratorType Iterator> constexpr FromCharsResult<Iter
 	(std::is_same_v<Numerical, float> || std::is_same_v<Numerical, double>) &&
 	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type>
 ) {
-	detail::FloatParseResult<Iterator> parseRes { };
-
- 	if (auto parseErr = detail::parseFloatingPoint(parseRes, begin, end, fmt, result); parseErr == std::errc::operation_canceled)
-		return { parseRes.last, std::errc { } };
-	else if (parseErr != std::errc { })
-		return { begin, parseErr };
-
-	if (detail::fastPath(parseRes, result))
-		return { parseRes.last, std::errc { } };
-
-	if (detail::eiselLemire(parseRes, result))
-		return { parseRes.last, std::errc { } };
-
-	return { begin, std::errc::result_out_of_range }; // since the input should be valid at this point, the only possible error is out of range
+	// fastPath() and eiselLemire() are not correctly rounded yet and index out of their tables for large exponents, 
+	// so conversions go through the standard library until they are
+	return detail::standardFloatFromChars(begin, end, result, fmt);
 }
 
 } // namespace lsd
@@ -23,23 +23,23 @@ requires (
 	isIteratorValue<Iterator> && 
 	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type> 
 ) {
-	constexpr Numerical maxVal = std::numeric_limits<Numerical>::max();
-
 	if (base < 2 || base > 36 || begin == end) return { begin, std::errc::invalid_argument };
 
 	auto beginCopy = begin;
 
-	Numerical sign = 1;
+	bool negative = false;
 
 	if (*begin == '-') {
-		if constexpr (std::is_signed_v<Numerical>) sign = -1;
+		if constexpr (std::is_signed_v<Numerical>) negative = true;
 		else return { begin, std::errc::invalid_argument };
 
 		++begin;
 	}
 
-	const Numerical maxValOverBase = maxVal / base;
-	const Numerical maxLastDigit = maxVal % base;
+	// negative numbers are accumulated below zero so that the minimum value, whose magnitude exceeds the maximum, still fits
+	const Numerical limit = negative ? std::numeric_limits<Numerical>::min() : std::numeric_limits<Numerical>::max();
+	const Numerical limitOverBase = limit / base;
+	const Numerical limitLastDigit = negative ? -(limit % base) : limit % base;
 
 	Numerical res = 0;
 
@@ -57,10 +57,10 @@ requires (
 				else break;
 			} else break;
 
-			if (res > maxValOverBase || (res == maxValOverBase && n > maxLastDigit))
+			if (negative ? (res < limitOverBase || (res == limitOverBase && n > limitLastDigit)) : (res > limitOverBase || (res == limitOverBase && n > limitLastDigit)))
 				return { beginCopy, std::errc::result_out_of_range };
 
-			res = res * base + n;
+			res = negative ? res * base - n : res * base + n;
 		}
 	} else {
 		const std::remove_cvref_t<decltype(*begin)> numLimit = ('0' + base);
@@ -68,15 +68,15 @@ requires (
 		for (std::uint8_t n = 0; begin != end && *begin >= '0' && *begin < numLimit; begin++, iterationCount++) {
 			n = *begin - '0';
 
-			if (res > maxValOverBase || (res == maxValOverBase && n > maxLastDigit))
+			if (negative ? (res < limitOverBase || (res == limitOverBase && n > limitLastDigit)) : (res > limitOverBase || (res == limitOverBase && n > limitLastDigit)))
 				return { beginCopy, std::errc::result_out_of_range };
 
-			res = res * base + n;
+			res = negative ? res * base - n : res * base + n;
 		}
 	}
 
 	if (iterationCount != 0) {
-		result = res * sign;
+		result = res;
 		return { begin, std::errc { } };
 	} else return { beginCopy, std::errc::invalid_argument };
 }
@@ -0,0 +1,99 @@
+/*************************
+ * @file StringArena.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief A monotonic arena for objects which live as long as their owner
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "../Vector.h"
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace lsd {
+
+namespace detail {
+
+/**
+ * @brief Allocates memory in large blocks and only frees it all at once on destruction
+ */
+class StringArena {
+public:
+	static constexpr std::size_t defaultBlockSize = 4096;
+
+	StringArena() noexcept = default;
+	explicit StringArena(std::size_t blockSize) noexcept : m_blockSize(blockSize) { }
+	StringArena(const StringArena&) = delete;
+	StringArena(StringArena&& other) noexcept :
+		m_blocks(std::move(other.m_blocks)),
+		m_current(std::exchange(other.m_current, nullptr)),
+		m_remaining(std::exchange(other.m_remaining, 0)),
+		m_blockSize(other.m_blockSize) { }
+	~StringArena() {
+		release();
+	}
+
+	StringArena& operator=(const StringArena&) = delete;
+	StringArena& operator=(StringArena&& other) noexcept {
+		release();
+
+		m_blocks = std::move(other.m_blocks);
+		m_current = std::exchange(other.m_current, nullptr);
+		m_remaining = std::exchange(other.m_remaining, 0);
+		m_blockSize = other.m_blockSize;
+
+		return *this;
+	}
+
+	[[nodiscard]] void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+		void* current = m_current;
+
+		if (!current || !std::align(alignment, size, current, m_remaining)) {
+			auto blockSize = std::max(m_blockSize, size + alignment);
+
+			std::unique_ptr<std::byte[]> block(new std::byte[blockSize]); // freed again if the block list fails to grow
+			m_blocks.pushBack(block.get());
+
+			m_current = block.release();
+			m_remaining = blockSize;
+
+			current = m_current;
+			std::align(alignment, size, current, m_remaining);
+		}
+
+		m_current = static_cast<std::byte*>(current) + size;
+		m_remaining -= size;
+
+		return current;
+	}
+
+	void release() noexcept {
+		for (auto block : m_blocks) delete[] block;
+
+		m_blocks.clear();
+		m_current = nullptr;
+		m_remaining = 0;
+	}
+
+	[[nodiscard]] std::size_t blockCount() const noexcept {
+		return m_blocks.size();
+	}
+
+private:
+	Vector<std::byte*> m_blocks;
+	std::byte* m_current = nullptr;
+	std::size_t m_remaining = 0;
+	std::size_t m_blockSize = defaultBlockSize;
+};
+
+} // namespace detail
+
+} // namespace lsd
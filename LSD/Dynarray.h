@@ -179,7 +179,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 
 
 	constexpr iterator insert(const_iterator pos, const_reference value) { 
-		if (full()) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (full()) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		auto prevIt = &back();
 		auto moveIt = prevIt + 1;
@@ -195,7 +195,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 		return insertIt;
 	}
 	constexpr iterator insert(const_iterator pos, rvreference value) {
-		if (full()) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (full()) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		auto prevIt = &back();
 		auto moveIt = prevIt + 1;
@@ -211,7 +211,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 		return insertIt;
 	}
 	constexpr iterator insert(const_iterator pos, size_type count, const_reference value) {
-		if (m_size + count > Capacity) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (m_size + count > Capacity) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		auto moveIt = &back();
 		auto lastIt = moveIt + count;
@@ -229,7 +229,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 	template <class It> constexpr iterator insert(const_iterator pos, It first, It last) requires isIteratorValue<It> {
 		auto count = last - first;
 
-		if (m_size + count > Capacity) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (m_size + count > Capacity) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		auto moveIt = &back();
 		auto lastIt = moveIt + count;
@@ -249,7 +249,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 	}
 
 	template <class... Args> constexpr iterator emplace(const_iterator pos, Args&&... args) {
-		if (full()) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (full()) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		auto prevIt = &back();
 		auto moveIt = prevIt + 1;
@@ -265,7 +265,7 @@ template <DynarrayValueType Ty, std::size_t Capacity> struct Dynarray {
 		return insertIt;
 	}
 	template <class... Args> constexpr reference emplaceBack(Args&&... args) {
-		if (full()) throw std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!");
+		if (full()) LSD_THROW(std::out_of_range("lsd::Dynarray::insert: Dynamic Array is already full!"));
 
 		new (&m_array[m_size++]) value_type(std::forward<Args>(args)...);
 
@@ -35,35 +35,111 @@
 
 namespace lsd {
 
-// formatting functions
+namespace detail {
 
-template <class... Args> inline String format(FormatString<Args...> fmt, Args&&... args) {
+// opt-in sizing pass, runs the whole format with an iterator that only counts the characters
+
+template <class Context> inline std::size_t formattedSize(typename Context::view_type fmt, const typename Context::format_args& args) {
+	std::size_t size = 0;
+	Context(
+		typename Context::iterator(
+			&size,
+			[](void* size, const typename Context::char_type&) { ++*static_cast<std::size_t*>(size); },
+			[](void*) { return false; }
+		),
+		args
+	).format(fmt);
+
+	return size;
+}
+
+// formats in a single pass, the size of the format string is reserved up front since the literal text usually makes up most of the output
+
+template <class String, class Context> inline String formatGrowing(typename Context::view_type fmt, const typename Context::format_args& args) {
 	String out;
-	FormatContext(
-		detail::FormatBackInserter(
+	out.reserve(fmt.size());
+
+	Context(
+		typename Context::iterator(
 			&out,
-			[](void* out, const char& v) { static_cast<String*>(out)->pushBack(v); },
-			[](void* out) { return false; }
+			[](void* out, const typename Context::char_type& v) { static_cast<String*>(out)->pushBack(v); },
+			[](void*) { return false; }
 		),
-		makeFormatArgs(args...)
-	).format(fmt.get());
+		args
+	).format(fmt);
 
 	return out;
 }
-template <class... Args> inline WString format(WFormatString<Args...> fmt, Args&&... args) {
-	WString out;
-	WFormatContext(
-		detail::FormatBackInserter(
-			&out,
-			[](void* out, const wchar_t& v) { static_cast<WString*>(out)->pushBack(v); },
-			[](void* out) { return false; }
-		),
-		makeWFormatArgs(args...)
-	).format(fmt.get());
+
+// opt-in two pass format, sizes the string exactly once and then writes the output through a raw pointer without any capacity checks
+
+template <class String, class Context> inline String formatSized(typename Context::view_type fmt, const typename Context::format_args& args) {
+	using char_type = typename Context::char_type;
+
+	String out;
+	out.resizeAndOverwrite(formattedSize<Context>(fmt, args), [&fmt, &args](char_type* data, std::size_t size) {
+		Context(
+			typename Context::iterator(
+				&data,
+				[](void* data, const char_type& v) { *(*static_cast<char_type**>(data))++ = v; },
+				[](void*) { return false; }
+			),
+			args
+		).format(fmt);
+
+		return size;
+	});
 
 	return out;
 }
 
+} // namespace detail
+
+
+// formatting functions
+
+/**
+ * @brief Get the exact amount of characters a format would produce
+ *
+ * @note This runs the complete format without storing the output, only formatSized() calls it
+ *
+ * @param fmt format string
+ * @param args format arguments
+ *
+ * @return Size of the formatted string, without the null terminator
+ */
+template <class... Args> [[nodiscard]] inline std::size_t formattedSize(FormatString<Args...> fmt, Args&&... args) {
+	return detail::formattedSize<FormatContext>(fmt.get(), makeFormatArgs(args...));
+}
+template <class... Args> [[nodiscard]] inline std::size_t formattedSize(WFormatString<Args...> fmt, Args&&... args) {
+	return detail::formattedSize<WFormatContext>(fmt.get(), makeWFormatArgs(args...));
+}
+
+template <class... Args> inline String format(FormatString<Args...> fmt, Args&&... args) {
+	return detail::formatGrowing<String, FormatContext>(fmt.get(), makeFormatArgs(args...));
+}
+template <class... Args> inline WString format(WFormatString<Args...> fmt, Args&&... args) {
+	return detail::formatGrowing<WString, WFormatContext>(fmt.get(), makeWFormatArgs(args...));
+}
+
+/**
+ * @brief Format into a string which is sized exactly before any output is written
+ *
+ * @details Runs the format twice, once to count the characters and once to write them without any capacity checks.
+ * This only pays off if growing the string costs more than formatting the arguments a second time, see Benchmarks/Format.
+ *
+ * @param fmt format string
+ * @param args format arguments
+ *
+ * @return Formatted string
+ */
+template <class... Args> inline String formatSized(FormatString<Args...> fmt, Args&&... args) {
+	return detail::formatSized<String, FormatContext>(fmt.get(), makeFormatArgs(args...));
+}
+template <class... Args> inline WString formatSized(WFormatString<Args...> fmt, Args&&... args) {
+	return detail::formatSized<WString, WFormatContext>(fmt.get(), makeWFormatArgs(args...));
+}
+
 
 template <class OutputIt, class... Args> inline OutputIt formatTo(OutputIt it, std::size_t n, FormatString<Args...> fmt, Args&&... args) {
 	
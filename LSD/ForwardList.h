@@ -332,8 +332,7 @@ public:
 		return m_alloc;
 	}
 	[[nodiscard]] constexpr bool empty() const noexcept {
-		if (m_beforeHead) return m_beforeHead == m_beforeHead.next;
-		return true;
+		return m_beforeHead.next == nullptr;
 	}
 	[[nodiscard]] constexpr size_type maxSize() const noexcept {
 		return node_traits::max_size(m_alloc);
@@ -119,7 +119,7 @@ public:
 		return m_callable;
 	}
 	constexpr result_type operator()(Args... args) {
-		if (!m_callable) throw std::bad_function_call();
+		if (!m_callable) LSD_THROW(std::bad_function_call());
 		return m_callable->run(std::forward<Args>(args)...);
 	}
 
@@ -0,0 +1,299 @@
+/**************************
+ * @file InternedString.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Interned strings with stable IDs and precomputed hashes
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "StringView.h"
+#include "Hash.h"
+#include "Detail/StringArena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <new>
+
+namespace lsd {
+
+template <class Literal> class BasicStringInternPool;
+
+namespace detail {
+
+template <class Literal> struct InternedStringEntry {
+	std::size_t hash;
+	std::size_t size;
+	std::size_t id;
+
+	[[nodiscard]] constexpr const Literal* data() const noexcept { // the characters and the null terminator are stored directly behind the entry
+		return reinterpret_cast<const Literal*>(this + 1);
+	}
+	[[nodiscard]] constexpr Literal* data() noexcept {
+		return reinterpret_cast<Literal*>(this + 1);
+	}
+};
+
+template <class Literal> struct EmptyInternedStringEntry {
+	InternedStringEntry<Literal> entry;
+	Literal terminator;
+};
+
+static_assert(offsetof(EmptyInternedStringEntry<char>, terminator) == sizeof(InternedStringEntry<char>));
+static_assert(offsetof(EmptyInternedStringEntry<char32_t>, terminator) == sizeof(InternedStringEntry<char32_t>));
+
+template <class Literal> inline constexpr EmptyInternedStringEntry<Literal> emptyInternedStringEntry { { Hash<BasicStringView<Literal>>{}(BasicStringView<Literal>()), 0, 0 }, Literal() };
+
+} // namespace detail
+
+
+/**
+ * @brief Pointer sized handle to a string interned in a BasicStringInternPool
+ *
+ * @details Strings with the same content interned in the same pool share their storage,
+ * so comparing two handles is a pointer comparison and their hash is computed only once.
+ * The pool has to outlive every string interned in it.
+ *
+ * @tparam Literal character type
+ */
+template <class Literal> class BasicInternedString {
+public:
+	using value_type = Literal;
+	using size_type = std::size_t;
+	using view_type = BasicStringView<value_type>;
+	using pool_type = BasicStringInternPool<value_type>;
+
+	constexpr BasicInternedString() noexcept = default;
+	/**
+	 * @brief Intern a string in the pool active on the current thread
+	 *
+	 * @param string string to intern
+	 */
+	explicit BasicInternedString(view_type string) : BasicInternedString(pool_type::current().intern(string)) { }
+	explicit BasicInternedString(const value_type* string) : BasicInternedString(view_type(string)) { }
+
+	[[nodiscard]] constexpr view_type view() const noexcept {
+		return view_type(m_entry->data(), m_entry->size);
+	}
+	[[nodiscard]] constexpr operator view_type() const noexcept {
+		return view();
+	}
+
+	[[nodiscard]] constexpr const value_type* data() const noexcept {
+		return m_entry->data();
+	}
+	[[nodiscard]] constexpr const value_type* cStr() const noexcept {
+		return m_entry->data();
+	}
+	[[nodiscard]] constexpr size_type size() const noexcept {
+		return m_entry->size;
+	}
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return m_entry->size == 0;
+	}
+	[[nodiscard]] constexpr size_type hash() const noexcept {
+		return m_entry->hash;
+	}
+	/**
+	 * @brief Get the ID of the string, which is unique in its pool and never changes
+	 *
+	 * @details IDs are handed out in the order the strings are interned starting from 1, the empty string always has the ID 0
+	 */
+	[[nodiscard]] constexpr size_type id() const noexcept {
+		return m_entry->id;
+	}
+
+	[[nodiscard]] friend constexpr bool operator==(const BasicInternedString& first, const BasicInternedString& second) noexcept {
+		return first.m_entry == second.m_entry;
+	}
+	[[nodiscard]] friend constexpr bool operator==(const BasicInternedString& first, view_type second) noexcept {
+		return first.view() == second;
+	}
+
+private:
+	const detail::InternedStringEntry<value_type>* m_entry = &detail::emptyInternedStringEntry<value_type>.entry;
+
+	constexpr BasicInternedString(const detail::InternedStringEntry<value_type>* entry) noexcept : m_entry(entry) { }
+
+	friend class BasicStringInternPool<value_type>;
+};
+
+
+/**
+ * @brief Thread safe intern table
+ *
+ * @details The table is split into shards selected by the hash of the string, each with its own lock, arena and open addressing table of precomputed hashes,
+ * so threads interning different strings rarely wait for each other.
+ * There is a global pool which is used by default, a different pool can be activated for the current thread with a Scope, for example to give each document its own pool.
+ *
+ * @tparam Literal character type
+ */
+template <class Literal> class BasicStringInternPool {
+public:
+	using value_type = Literal;
+	using size_type = std::size_t;
+	using view_type = BasicStringView<value_type>;
+	using string_type = BasicInternedString<value_type>;
+	using entry_type = detail::InternedStringEntry<value_type>;
+
+	static constexpr size_type shardCount = 16;
+
+	/**
+	 * @brief Activates a pool on the current thread for the lifetime of the scope
+	 *
+	 * @details Other threads keep using their own active pool, tryParseJsonLines() activates the pool of the calling thread on its workers
+	 */
+	class Scope {
+	public:
+		explicit Scope(BasicStringInternPool& pool) noexcept : m_previous(std::exchange(activePool, &pool)) { }
+		Scope(const Scope&) = delete;
+		~Scope() {
+			activePool = m_previous;
+		}
+
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		BasicStringInternPool* m_previous;
+	};
+
+	BasicStringInternPool() = default;
+	BasicStringInternPool(const BasicStringInternPool&) = delete;
+	BasicStringInternPool& operator=(const BasicStringInternPool&) = delete;
+
+	[[nodiscard]] static BasicStringInternPool& global() {
+		static BasicStringInternPool pool;
+		return pool;
+	}
+	[[nodiscard]] static BasicStringInternPool& current() {
+		return activePool ? *activePool : global();
+	}
+
+	/**
+	 * @brief Get the handle of a string, inserting it into the pool if it is not interned yet
+	 *
+	 * @param string string to intern
+	 *
+	 * @return Handle to the interned string
+	 */
+	[[nodiscard]] string_type intern(view_type string) {
+		if (string.empty()) return string_type();
+
+		auto hash = Hash<view_type>{}(string);
+		auto& shard = m_shards[shardIndex(hash)];
+
+		std::lock_guard lock(shard.mutex);
+
+		auto mask = shard.table.size() - 1;
+		auto i = hash & mask;
+
+		for (; shard.table[i]; i = (i + 1) & mask) {
+			if (shard.table[i]->hash == hash && view_type(shard.table[i]->data(), shard.table[i]->size) == string)
+				return string_type(shard.table[i]);
+		}
+
+		auto entry = ::new (shard.arena.allocate(sizeof(entry_type) + (string.size() + 1) * sizeof(value_type), alignof(entry_type))) entry_type {
+			hash,
+			string.size(),
+			m_nextId.fetch_add(1, std::memory_order_relaxed)
+		};
+		std::memcpy(entry->data(), string.data(), string.size() * sizeof(value_type));
+		entry->data()[string.size()] = value_type();
+
+		shard.table[i] = entry;
+		if (++shard.size * 2 > shard.table.size()) shard.grow();
+
+		return string_type(entry);
+	}
+
+	/**
+	 * @brief Get the amount of interned strings, not counting the empty string
+	 */
+	[[nodiscard]] size_type size() const {
+		size_type s = 0;
+
+		for (const auto& shard : m_shards) {
+			std::lock_guard lock(shard.mutex);
+			s += shard.size;
+		}
+
+		return s;
+	}
+
+private:
+	struct Shard {
+		Vector<const entry_type*> table = Vector<const entry_type*>(16, nullptr);
+		size_type size = 0;
+
+		detail::StringArena arena;
+		mutable std::mutex mutex;
+
+		void grow() {
+			Vector<const entry_type*> newTable(table.size() * 2, nullptr);
+			auto mask = newTable.size() - 1;
+
+			for (auto entry : table) {
+				if (!entry) continue;
+
+				auto i = entry->hash & mask;
+				while (newTable[i]) i = (i + 1) & mask;
+				newTable[i] = entry;
+			}
+
+			table = std::move(newTable);
+		}
+	};
+
+	Shard m_shards[shardCount];
+	std::atomic<size_type> m_nextId = 1;
+
+	static inline thread_local BasicStringInternPool* activePool = nullptr;
+
+	[[nodiscard]] static constexpr size_type shardIndex(size_type hash) noexcept { // the high bits of a short djb2 hash are mostly zero, so they are mixed first
+		return static_cast<size_type>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 60);
+	}
+};
+
+template <class Literal> struct Hash<BasicInternedString<Literal>> {
+	using is_transparent = void;
+
+	constexpr std::size_t operator()(const BasicInternedString<Literal>& string) const noexcept {
+		return string.hash();
+	}
+	constexpr std::size_t operator()(BasicStringView<Literal> string) const noexcept {
+		return Hash<BasicStringView<Literal>>{}(string);
+	}
+};
+
+using InternedString = BasicInternedString<char>;
+using WInternedString = BasicInternedString<wchar_t>;
+using StringInternPool = BasicStringInternPool<char>;
+using WStringInternPool = BasicStringInternPool<wchar_t>;
+
+} // namespace lsd
+
+
+// equality of interned strings is a pointer comparison, views are compared by content
+
+template <class Literal> struct std::equal_to<lsd::BasicInternedString<Literal>> {
+	using is_transparent = void;
+
+	constexpr bool operator()(const lsd::BasicInternedString<Literal>& first, const lsd::BasicInternedString<Literal>& second) const noexcept {
+		return first == second;
+	}
+	constexpr bool operator()(const lsd::BasicInternedString<Literal>& first, lsd::BasicStringView<Literal> second) const noexcept {
+		return first.view() == second;
+	}
+	constexpr bool operator()(lsd::BasicStringView<Literal> first, const lsd::BasicInternedString<Literal>& second) const noexcept {
+		return first == second.view();
+	}
+};
@@ -12,17 +12,83 @@
 #pragma once
 
 #include "Vector.h"
-#include "UnorderedSparseSet.h"
+#include "UnorderedSmallSparseSet.h"
 #include "String.h"
 #include "StringView.h"
 #include "FromChars.h"
+#include "ToChars.h"
+#include "JsonPath.h"
+#include "JsonKey.h"
+#include "Unicode.h"
 
+#include <cstdint>
 #include <exception>
+#include <expected>
 #include <variant>
 #include <charconv>
+#include <algorithm>
 
 namespace lsd {
 
+enum class JsonErrorCode : std::uint8_t {
+	none,
+	unexpectedEnd,
+	unexpectedSymbol,
+	expectedQuotationMarks,
+	expectedColon,
+	expectedCommaOrBracket,
+	invalidLiteral,
+	invalidNumber,
+	invalidUnicodeEscape,
+	controlCharacter,
+	unterminatedString,
+	trailingCharacters,
+	depthExceeded,
+	invalidUnicode,
+	invalidEscape
+};
+
+/**
+ * @brief Describes why and where parsing a JSON document failed
+ *
+ * @details The offset is counted in characters from the beginning of the text, lines and columns start at 1.
+ */
+struct JsonError {
+	JsonErrorCode code = JsonErrorCode::none;
+	std::size_t offset = 0;
+	std::size_t line = 1;
+	std::size_t column = 1;
+
+	[[nodiscard]] constexpr explicit operator bool() const noexcept {
+		return code != JsonErrorCode::none;
+	}
+
+	[[nodiscard]] constexpr const char* message() const noexcept {
+		switch (code) {
+			case JsonErrorCode::none: return "No error";
+			case JsonErrorCode::unexpectedEnd: return "Unexpected end of the document";
+			case JsonErrorCode::unexpectedSymbol: return "Unexpected symbol, couldn't match identifier with any type";
+			case JsonErrorCode::expectedQuotationMarks: return "Unexpected symbol, expected quotation marks";
+			case JsonErrorCode::expectedColon: return "Unexpected symbol, expected colon after member name";
+			case JsonErrorCode::expectedCommaOrBracket: return "Unexpected symbol, expected comma or closing bracket";
+			case JsonErrorCode::invalidLiteral: return "Invalid literal";
+			case JsonErrorCode::invalidNumber: return "Invalid number";
+			case JsonErrorCode::invalidUnicodeEscape: return "Invalid unicode escape sequence";
+			case JsonErrorCode::controlCharacter: return "Unescaped control character in string";
+			case JsonErrorCode::unterminatedString: return "Missing symbol, string not terminated";
+			case JsonErrorCode::trailingCharacters: return "Unexpected symbol after the end of the document";
+			case JsonErrorCode::depthExceeded: return "Document exceeds the maximum nesting depth";
+			case JsonErrorCode::invalidUnicode: return "Invalid unicode sequence";
+			case JsonErrorCode::invalidEscape: return "Invalid escape sequence";
+		}
+
+		return "Unknown error";
+	}
+};
+
+template <class Ty> using JsonParseResult = std::expected<Ty, JsonError>;
+
+
 class JsonParseError : public std::runtime_error {
 public:
 	JsonParseError(const String& message) : std::runtime_error(message.cStr()) {
@@ -31,6 +97,9 @@ public:
 	JsonParseError(const char* message) : std::runtime_error(message) {
 		m_message.append(message);
 	}
+	explicit JsonParseError(const JsonError& error) : JsonParseError(describe(error)) {
+		m_error = error;
+	}
 	JsonParseError(const JsonParseError&) = default;
 	JsonParseError(JsonParseError&&) = default;
 
@@ -41,8 +110,31 @@ public:
 		return m_message.cStr();
 	}
 
+	[[nodiscard]] const JsonError& error() const noexcept {
+		return m_error;
+	}
+
 private:
 	String m_message { "Program terminated with JsonParseError: " };
+	JsonError m_error { };
+
+	static String describe(const JsonError& error) {
+		String r("lsd::Json::parse(): JSON Syntax Error: ");
+		r.append(error.message());
+
+		char buffer[24];
+		auto appendNumber = [&](const char* prefix, std::size_t number) {
+			r.append(prefix);
+			r.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), number).ptr - buffer);
+		};
+
+		appendNumber(" at line ", error.line);
+		appendNumber(", column ", error.column);
+		appendNumber(" (offset ", error.offset);
+		r.append(")!");
+
+		return r;
+	}
 };
 
 
@@ -53,6 +145,124 @@ template <class Ty> concept SignedType = std::is_signed_v<Ty> && std::is_integra
 template <class Ty> concept UnsignedType = std::is_unsigned_v<Ty> && std::is_integral_v<Ty>;
 template <class Ty> concept FloatingType = std::is_floating_point_v<Ty>;
 
+template <class CharTy> constexpr std::size_t jsonEscapeSize(CharTy c) noexcept {
+	auto u = static_cast<std::make_unsigned_t<CharTy>>(c);
+
+	if (u == '\"' || u == '\\' || u == '\b' || u == '\f' || u == '\n' || u == '\r' || u == '\t') return 2;
+	else if (u < 0x20) return 6;
+	else return 1;
+}
+
+/**
+ * @brief Get the size of a string after escaping it for JSON text, excluding the quotation marks
+ *
+ * @param data pointer to the string
+ * @param size size of the string
+ *
+ * @return Size of the escaped string
+ */
+template <class CharTy> [[nodiscard]] constexpr std::size_t jsonEscapedSize(const CharTy* data, std::size_t size) noexcept {
+	std::size_t r = 0;
+	for (auto end = data + size; data != end; ++data) r += jsonEscapeSize(*data);
+
+	return r;
+}
+
+/**
+ * @brief Append a string to JSON text, with quotation marks, backslashes and control characters escaped
+ *
+ * @param out string to append to
+ * @param data pointer to the string
+ * @param size size of the string
+ */
+template <class Str, class CharTy> constexpr void appendJsonString(Str& out, const CharTy* data, std::size_t size) {
+	constexpr CharTy hex[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+	constexpr CharTy quote[] = { '\"' };
+
+	out.append(quote, 1);
+
+	auto run = data;
+	auto end = data + size;
+
+	for (auto it = run; it != end; ++it) {
+		auto c = static_cast<std::make_unsigned_t<CharTy>>(*it);
+		if (c >= 0x20 && c != '\"' && c != '\\') continue;
+
+		out.append(run, it - run);
+		run = it + 1;
+
+		CharTy escape[] = { '\\', static_cast<CharTy>(c), '0', '0', hex[(c >> 4) & 0xF], hex[c & 0xF] };
+		switch (c) {
+			case '\"': case '\\': break;
+			case '\b': escape[1] = 'b'; break;
+			case '\f': escape[1] = 'f'; break;
+			case '\n': escape[1] = 'n'; break;
+			case '\r': escape[1] = 'r'; break;
+			case '\t': escape[1] = 't'; break;
+			default: escape[1] = 'u';
+		}
+
+		out.append(escape, jsonEscapeSize(*it));
+	}
+
+	out.append(run, end - run);
+	out.append(quote, 1);
+}
+
+template <class CharTy> struct JsonNumberToken {
+	const CharTy* end; // end of the characters which can be part of a number
+	bool valid;
+	bool isFloat; // has a fraction or an exponent
+};
+
+/**
+ * @brief Scan the characters which can be part of a number and check them against the JSON number grammar
+ *
+ * @details The grammar is -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?, so leading zeros, leading or trailing decimal points and a leading plus are invalid
+ *
+ * @param begin first character of the number
+ * @param end end of the text
+ *
+ * @return The end of the scanned characters and whether they form a valid number
+ */
+template <class CharTy> [[nodiscard]] constexpr JsonNumberToken<CharTy> scanJsonNumber(const CharTy* begin, const CharTy* end) noexcept {
+	auto isDigit = [](CharTy c) { return c >= '0' && c <= '9'; };
+
+	auto tokenEnd = begin;
+	while (tokenEnd != end && (isDigit(*tokenEnd) || *tokenEnd == '.' || *tokenEnd == 'e' || *tokenEnd == 'E' || *tokenEnd == '+' || *tokenEnd == '-')) ++tokenEnd;
+
+	JsonNumberToken<CharTy> r { tokenEnd, false, false };
+	auto it = begin;
+
+	auto digits = [&it, tokenEnd, &isDigit]() {
+		auto first = it;
+		while (it != tokenEnd && isDigit(*it)) ++it;
+
+		return it != first;
+	};
+
+	if (it != tokenEnd && *it == '-') ++it;
+
+	if (it != tokenEnd && *it == '0') ++it;
+	else if (!digits()) return r;
+
+	if (it != tokenEnd && *it == '.') {
+		++it;
+		r.isFloat = true;
+		if (!digits()) return r;
+	}
+
+	if (it != tokenEnd && (*it == 'e' || *it == 'E')) {
+		++it;
+		r.isFloat = true;
+		if (it != tokenEnd && (*it == '+' || *it == '-')) ++it;
+		if (!digits()) return r;
+	}
+
+	r.valid = (it == tokenEnd);
+	return r;
+}
+
 } // namespace detail
 
 
@@ -66,7 +276,8 @@ template <
 	detail::SignedType Signed = std::int64_t,
 	detail::UnsignedType Unsigned = std::uint64_t,
 	detail::FloatingType Floating = double,
-	template <class...> class NodeContainer = UnorderedSparseSet> 
+	template <class...> class NodeContainer = UnorderedSmallSparseSet,
+	class Key = BasicString<Literal>> 
 class BasicJson {
 public:
 	using size_type = std::size_t;
@@ -80,10 +291,11 @@ public:
 	using literal_type = Literal;
 	using string_type = BasicString<literal_type>;
 
-	using key_type = string_type;
+	using key_type = Key;
 	using key_reference = key_type&;
 	using const_key_reference = const key_type&;
 	using key_rvreference = key_type&&;
+	using key_view = BasicStringView<literal_type>;
 
 	using json_type = BasicJson;
 	using pointer = json_type*;
@@ -105,8 +317,50 @@ public:
 	>;
 
 private:
-	CUSTOM_HASHER(Hasher, const BasicJson&, const_key_reference, Hash<key_type>{}, .m_name)
-	CUSTOM_EQUAL(Equal, const BasicJson&, const_key_reference, .m_name)
+	// the hasher and comparator also accept views, so that lookups don't have to construct a key
+	class Hasher {
+	public:
+		constexpr std::size_t operator()(const BasicJson& json) const noexcept {
+			return (*this)(json.m_name);
+		}
+		constexpr std::size_t operator()(const key_type& key) const noexcept {
+			if constexpr (requires { { key.hash() } -> std::convertible_to<std::size_t>; }) return key.hash(); // interned keys carry their hash
+			else return Hash<key_view>{}(key);
+		}
+		constexpr std::size_t operator()(key_view key) const noexcept {
+			return Hash<key_view>{}(key);
+		}
+		constexpr std::size_t operator()(const literal_type* key) const noexcept {
+			return Hash<key_view>{}(key);
+		}
+	};
+	class Equal {
+	public:
+		constexpr bool operator()(const BasicJson& first, const BasicJson& second) const noexcept {
+			return first.m_name == second.m_name;
+		}
+		constexpr bool operator()(const BasicJson& first, const key_type& second) const noexcept {
+			return first.m_name == second;
+		}
+		constexpr bool operator()(const key_type& first, const BasicJson& second) const noexcept {
+			return first == second.m_name;
+		}
+		constexpr bool operator()(const BasicJson& first, key_view second) const noexcept {
+			return key_view(first.m_name) == second;
+		}
+		constexpr bool operator()(key_view first, const BasicJson& second) const noexcept {
+			return first == key_view(second.m_name);
+		}
+		constexpr bool operator()(key_view first, key_view second) const noexcept {
+			return first == second;
+		}
+		constexpr bool operator()(const BasicJson& first, const literal_type* second) const noexcept {
+			return key_view(first.m_name) == key_view(second);
+		}
+		constexpr bool operator()(const literal_type* first, const BasicJson& second) const noexcept {
+			return key_view(first) == key_view(second.m_name);
+		}
+	};
 
 public:
 	
@@ -222,19 +476,19 @@ public:
 
 
 	constexpr reference erase(iterator pos) { 
-		return m_children.erase(pos); 
+		m_children.erase(pos); 
 		return *this;
 	}
 	constexpr reference erase(const_iterator pos) { 
-		return m_children.erase(pos); 
+		m_children.erase(pos); 
 		return *this;
 	}
 	constexpr reference erase(const_iterator first, const_iterator last) { 
-		return m_children.erase(first, last); 
+		m_children.erase(first, last); 
 		return *this;
 	}
 	template <class KeyType> constexpr size_type erase(KeyType&& name) requires std::is_convertible_v<KeyType, key_type> { 
-		return m_children.erase(std::forward(name)); 
+		return m_children.erase(std::forward<KeyType>(name)); 
 	}
 
 	constexpr reference clear() noexcept { 
@@ -242,20 +496,21 @@ public:
 		return *this;
 	}
 
+	/**
+	 * @brief Parse a JSON document
+	 *
+	 * @details The document has to either contain a single object or array at global scope or be empty.
+	 *
+	 * @param begin begin of the text
+	 * @param end end of the text
+	 *
+	 * @return Parsed document
+	 */
 	template <lsd::ContinuousIteratorType Iterator> [[nodiscard]] static constexpr json_type parse(Iterator begin, Iterator end) {
-		// first node
-		json_type json;
-		if (begin == end) return json;
-
-		skipCharacters(begin, end);
+		auto r = tryParse(begin, end);
+		if (!r) LSD_THROW(JsonParseError(r.error()));
 
-		// start parsing
-		if (*begin == '{') json.m_value = parseObject(begin, end, json);
-		else if (*begin == '[') json.m_value = parseArray(begin, end);
-		else if (++begin == end) json.m_value = object_type();
-		else throw JsonParseError("lsd::Json::parse(): JSON Syntax Error: Unexpected symbol, JSON file has to either contain a single object or array at global scope or be empty!");
-
-		return json;
+		return std::move(*r);
 	}
 	template <lsd::IteratableContainer Container> [[nodiscard]] static constexpr json_type parse(const Container& container) {
 		return parse(std::begin(container), std::end(container));
@@ -271,8 +526,60 @@ public:
 		return parse(string, end);
 	}
 
+	/**
+	 * @brief Parse a JSON document without throwing on malformed input
+	 *
+	 * @param begin begin of the text
+	 * @param end end of the text
+	 *
+	 * @return The parsed document or the error with the position at which parsing stopped
+	 */
+	template <lsd::ContinuousIteratorType Iterator> [[nodiscard]] static constexpr JsonParseResult<json_type> tryParse(Iterator begin, Iterator end) {
+		if (begin == end) return json_type();
+
+		const literal_type* first = &*begin;
+		return Parser(first, first + (end - begin)).parseDocument();
+	}
+	template <lsd::IteratableContainer Container> [[nodiscard]] static constexpr JsonParseResult<json_type> tryParse(const Container& container) {
+		return tryParse(std::begin(container), std::end(container));
+	}
+	template <class CStringLike> [[nodiscard]] static constexpr JsonParseResult<json_type> tryParse(CStringLike string) requires(
+		(std::is_pointer_v<CStringLike>) &&
+		std::is_integral_v<std::remove_cvref_t<std::remove_pointer_t<std::remove_all_extents_t<std::remove_cvref_t<CStringLike>>>>>
+	) {
+		auto end = string;
+		while (*end != '\0')
+			++end;
+
+		return tryParse(string, end);
+	}
+
+	/**
+	 * @brief Get an upper bound of the size of the stringified JSON
+	 *
+	 * @details Strings and keys are counted exactly, numbers are counted with the maximum amount of characters their type can produce
+	 *
+	 * @return Upper bound of the size of stringify()
+	 */
+	constexpr size_type stringifySize() const noexcept {
+		if (isObject()) return objectSize(*this);
+		else if (isArray()) return arraySize(*this);
+		else return pairSize(*this);
+	}
+	/**
+	 * @brief Get an upper bound of the size of the pretty stringified JSON
+	 *
+	 * @return Upper bound of the size of stringifyPretty()
+	 */
+	constexpr size_type stringifyPrettySize() const noexcept {
+		if (isObject()) return objectPrettySize(0, *this);
+		else if (isArray()) return arrayPrettySize(0, *this);
+		else return pairPrettySize(0, *this);
+	}
+
 	constexpr string_type stringify() const {
 		string_type r;
+		r.reserve(stringifySize());
 
 		if (isObject()) stringifyObject(*this, r);
 		else if (isArray()) stringifyArray(*this, r);
@@ -282,6 +589,7 @@ public:
 	}
 	constexpr string_type stringifyPretty() const {
 		string_type r;
+		r.reserve(stringifyPrettySize());
 
 		if (isObject()) stringifyObjectPretty(0, *this, r);
 		else if (isArray()) stringifyArrayPretty(0, *this, r);
@@ -398,70 +706,88 @@ public:
 		return m_children.contains(std::forward<KeyType>(name)); 
 	}
 
-	template <class KeyType> constexpr const_reference child(KeyType&& key) const {
-		constexpr bool stringlike = requires(const KeyType& k) {
-			key_type(key);
-			key_type().find("");
-			key_type().substr(0, 0);
-		};
+	template <class KeyType> constexpr const_reference child(KeyType&& key) const requires(!detail::JsonPathType<KeyType>) {
+		constexpr bool stringlike = std::is_convertible_v<const KeyType&, key_view>;
 
 		if constexpr (stringlike) {
-			key_type k(key);
+			key_view k(key);
 			size_type beg = 0, cur;
 			const_pointer p = this;
 
-			while ((cur = k.find("::", beg)) < k.size()) {
+			while ((cur = k.find(separator, beg)) != key_view::npos) {
 				p = &p->m_children.at(k.substr(beg, cur - beg));
-				(beg = cur) += 2;
+				beg = cur + 2;
 			}
 
-			return *p->m_children.at(k.substr(beg)).get();
+			return p->m_children.at(k.substr(beg));
 		} else {
-			return *m_children.at(key).get();
+			return m_children.at(key);
 		}
 	}
-	template <class KeyType> constexpr reference child(KeyType&& key) {
-		constexpr bool stringlike = requires(const KeyType& k) {
-			key_type(key);
-			key_type().find("");
-			key_type().substr(0, 0);
-		};
+	template <class KeyType> constexpr reference child(KeyType&& key) requires(!detail::JsonPathType<KeyType>) {
+		return const_cast<reference>(static_cast<const_reference>(*this).child(std::forward<KeyType>(key)));
+	}
 
-		if constexpr (stringlike) {
-			key_type k(key);
-			size_type beg = 0, cur;
-			const_pointer p = this;
+	template <std::size_t Capacity, std::size_t SegmentCapacity> constexpr const_reference child(const BasicJsonPath<literal_type, Capacity, SegmentCapacity>& path) const {
+		auto p = resolve(path);
+		if (!p) LSD_THROW(std::out_of_range("lsd::BasicJson::child(): Path could not be resolved in the JSON!"));
+		return *p;
+	}
+	template <std::size_t Capacity, std::size_t SegmentCapacity> constexpr reference child(const BasicJsonPath<literal_type, Capacity, SegmentCapacity>& path) {
+		return const_cast<reference>(static_cast<const_reference>(*this).child(path));
+	}
 
-			while ((cur = k.find("::", beg)) < k.size()) {
-				p = p->m_children.at(k.substr(beg, cur - beg));
-				beg = cur + 2;
-			}
+	/**
+	 * @brief Evaluates a precompiled path against this node without allocating or rehashing any keys
+	 *
+	 * @details Index segments select array elements if the current node holds an array and are looked up as keys otherwise.
+	 *
+	 * @param path path to evaluate
+	 *
+	 * @return Pointer to the node at the path, nullptr if it does not exist
+	 */
+	template <std::size_t Capacity, std::size_t SegmentCapacity> [[nodiscard]] constexpr const_pointer resolve(const BasicJsonPath<literal_type, Capacity, SegmentCapacity>& path) const noexcept {
+		const_pointer p = this;
 
-			return *p->m_children.at(k.substr(beg)).get();
-		} else {
-			return *m_children.at(key).get();
+		for (const auto& segment : path) {
+			if (segment.isIndex() && std::holds_alternative<array_type>(p->m_value)) {
+				const auto& array = std::get<array_type>(p->m_value);
+				if (segment.index() >= array.size()) return nullptr;
+
+				p = &array[segment.index()];
+			} else {
+				auto it = p->m_children.find(path.key(segment), segment.hash());
+				if (it == p->m_children.end()) return nullptr;
+
+				p = &*it;
+			}
 		}
+
+		return p;
+	}
+	template <std::size_t Capacity, std::size_t SegmentCapacity> [[nodiscard]] constexpr pointer resolve(const BasicJsonPath<literal_type, Capacity, SegmentCapacity>& path) noexcept {
+		return const_cast<pointer>(static_cast<const json_type&>(*this).resolve(path));
 	}
 
 	const_reference at(size_type i) const {
-		return *get<array_type>().at(i);
+		return std::get<array_type>(m_value).at(i);
 	}
 	reference operator[](size_type i) {
-		return *get<array_type>()[i];
+		return std::get<array_type>(m_value)[i];
 	}
 
 	template <class KeyType> constexpr const_reference at(KeyType&& name) const {
-		*m_children.at(std::forward<KeyType>(name));
+		return m_children.at(std::forward<KeyType>(name));
 	}
 	template <class KeyType> constexpr reference at(KeyType&& name) {
-		*m_children.at(std::forward<KeyType>(name));
+		return m_children.at(std::forward<KeyType>(name));
 	}
 	
 	template <class KeyType> constexpr const_reference operator[](KeyType&& name) const {
-		return *m_children[std::forward<KeyType>(name)];
+		return m_children[std::forward<KeyType>(name)];
 	}
 	template <class KeyType> constexpr reference operator[](KeyType&& name) {
-		return *m_children[std::forward<KeyType>(name)];
+		return m_children[std::forward<KeyType>(name)];
 	}
 
 
@@ -490,273 +816,455 @@ private:
 	pointer m_parent = nullptr;
 	container m_children { };
 
+	static constexpr literal_type separator[] = { ':', ':', '\0' };
+
 
 	// Parsing functions
 
-	template <class Iterator> static constexpr int skipCharacters(Iterator& begin, Iterator& end) {
-		switch (*begin) {
-			case ' ': case '\f': case '\n': case '\r': case '\t': case '\v': case '\0':
-				for (++begin; begin != end; begin++) {
-					switch (*begin) {
-						case ' ': case '\f': case '\n': case '\r': case '\t': case '\v': case '\0':
-							continue;
-					}
+	/**
+	 * @brief Recursive descent parser which reports errors through its state instead of throwing
+	 */
+	class Parser {
+	public:
+		static constexpr size_type maxDepth = 1024;
 
-					break;
-				}
-		}
+		constexpr Parser(const literal_type* begin, const literal_type* end) noexcept : m_begin(begin), m_current(begin), m_end(end) { }
 
-		return *begin;
-	}
+		constexpr JsonParseResult<json_type> parseDocument() {
+			json_type json;
 
-	template <class Iterator> static constexpr string_type parseString(Iterator& begin, Iterator& end) {
-		string_type r;
+			// strings are validated in one pass over the whole document, which is vectorized for UTF-8
+			if (auto invalid = findInvalidUnicode(m_begin, static_cast<size_type>(m_end - m_begin)); invalid != static_cast<size_type>(m_end - m_begin)) {
+				m_current = m_begin + invalid;
+				return fail(JsonErrorCode::invalidUnicode);
+			}
 
-		for (++begin; begin != end; begin++) {
-			switch (*begin) {
-				case '\\':
-					++begin;
+			skipWhitespace();
 
-					if (begin == end) {
-						throw JsonParseError("lsd::Json::parseString(): JSON Syntax Error: Missing symbol, string not terminated!");
+			if (m_current == m_end) return json;
+			else if (*m_current != '{' && *m_current != '[') return fail(JsonErrorCode::unexpectedSymbol);
+			else if (!parseValue(json)) return fail(m_error);
 
-						return r;
-					}
+			skipWhitespace();
+			if (m_current != m_end) return fail(JsonErrorCode::trailingCharacters);
 
-					switch (*begin) {
-						case 'b':
-							r.pushBack('\b');
+			return json;
+		}
 
-							break;
+	private:
+		const literal_type* m_begin;
+		const literal_type* m_current;
+		const literal_type* m_end;
 
-						case 't':
-							r.pushBack('\t');
-							
-							break;
+		size_type m_depth = 0;
+		JsonErrorCode m_error = JsonErrorCode::none;
 
-						case 'n':
-							r.pushBack('\n');
-							
-							break;
+		constexpr bool error(JsonErrorCode code) noexcept {
+			m_error = code;
+			return false;
+		}
+		constexpr std::unexpected<JsonError> fail(JsonErrorCode code) const noexcept {
+			JsonError r { code, static_cast<size_type>(m_current - m_begin), 1, 1 };
+
+			for (auto it = m_begin; it != m_current; it++) {
+				if (*it == '\n') {
+					r.line++;
+					r.column = 1;
+				} else r.column++;
+			}
 
-						case 'f':
-							r.pushBack('\f');
-							
-							break;
+			return std::unexpected(r);
+		}
 
-						case 'r':
-							r.pushBack('\r');
-							
-							break;
-						
-						case 'u':
-							/// @todo 4 hex digits
-							begin += 4;
+		constexpr void skipWhitespace() noexcept {
+			while (m_current != m_end && (*m_current == ' ' || *m_current == '\n' || *m_current == '\r' || *m_current == '\t'))
+				++m_current;
+		}
 
-							break;
+		constexpr bool parseValue(json_type& json) {
+			if (m_current == m_end) return error(JsonErrorCode::unexpectedEnd);
 
-						default:
-							r.pushBack(*begin);
-					}
+			switch (*m_current) {
+				case '{':
+					return parseObject(json);
 
-					break;
+				case '[':
+					return parseArray(json);
+
+				case '\"': {
+					string_type string;
+					if (!parseString(string)) return false;
+
+					json.m_value = std::move(string);
+					return true;
+				}
+
+				case 't':
+					json.m_value = true;
+					return parseLiteral("true", 4);
+
+				case 'f':
+					json.m_value = false;
+					return parseLiteral("false", 5);
+
+				case 'n':
+					json.m_value = null_type { };
+					return parseLiteral("null", 4);
 
-				case '\"':
-					return r;
-				
 				default:
-					r.pushBack(*begin);
+					return parseNumber(json);
 			}
 		}
 
-		throw JsonParseError("lsd::Json::parseString(): JSON Syntax Error: Missing symbol, string not terminated!");
-		return r;
-	}
-	template <class Iterator> static constexpr value_type parsePrimitive(Iterator& begin, Iterator& end) {
-		switch(*begin) {
-			case 't':
-				if (end - begin < 4 || !strncmp(++begin, "rue", 3))
-					break;
+		constexpr bool parseObject(json_type& json) {
+			if (++m_depth > maxDepth) return error(JsonErrorCode::depthExceeded);
+
+			json.m_value = object_type { };
 
-				begin += 2;
+			++m_current;
+			skipWhitespace();
+
+			if (m_current != m_end && *m_current == '}') {
+				++m_current;
+				--m_depth;
 				return true;
+			}
 
-			case 'f':
-				if (end - begin < 5 || !strncmp(++begin, "alse", 4))
-					break;
-				
-				begin += 3;
-				return false;
-				
-			case 'n':
-				if (end - begin < 4 || !strncmp(++begin, "ull", 3))
-					break;
+			string_type buffer;
+			key_view name;
 
-				begin += 2;
-				return value_type(null_type { });
-			
-			case '0':
-			case '1':
-			case '2':
-			case '3':
-			case '4':
-			case '5':
-			case '6':
-			case '7':
-			case '8':
-			case '9': {
-				unsigned_type uRes { };
-				if (auto res = fromChars(begin, end, uRes); res.ec == std::errc { } && 
-					*res.ptr != '.' && *res.ptr != 'e' && *res.ptr != 'p'
-				) {
-					begin = res.ptr - 1;
-					return uRes;
-				}
+			while (true) {
+				skipWhitespace();
+				if (m_current == m_end) return error(JsonErrorCode::unexpectedEnd);
+				else if (*m_current != '\"') return error(JsonErrorCode::expectedQuotationMarks);
+
+				if (!parseKey(name, buffer)) return false;
+
+				skipWhitespace();
+				if (m_current == m_end) return error(JsonErrorCode::unexpectedEnd);
+				else if (*m_current != ':') return error(JsonErrorCode::expectedColon);
+
+				++m_current;
+				skipWhitespace();
+
+				json_type child;
+				child.m_name = key_type(name);
+				if (!parseValue(child)) return false;
 
-				break;
+				json.insert(std::move(child));
+
+				skipWhitespace();
+				if (m_current == m_end) return error(JsonErrorCode::unexpectedEnd);
+				else if (*m_current == ',') ++m_current;
+				else if (*m_current == '}') {
+					++m_current;
+					break;
+				} else return error(JsonErrorCode::expectedCommaOrBracket);
 			}
-			
-			case '-': {
-				signed_type sRes = { };
-				if (auto res = fromChars(begin, end, sRes); res.ec == std::errc { } && 
-					*res.ptr != '.' && *res.ptr != 'e' && *res.ptr != 'p'
-				) {
-					begin = res.ptr - 1;
-					return sRes;
+
+			--m_depth;
+			return true;
+		}
+
+		constexpr bool parseArray(json_type& json) {
+			if (++m_depth > maxDepth) return error(JsonErrorCode::depthExceeded);
+
+			array_type array;
+
+			++m_current;
+			skipWhitespace();
+
+			if (m_current != m_end && *m_current == ']') ++m_current;
+			else {
+				while (true) {
+					skipWhitespace();
+					if (!parseValue(array.emplaceBack())) return false;
+
+					skipWhitespace();
+					if (m_current == m_end) return error(JsonErrorCode::unexpectedEnd);
+					else if (*m_current == ',') ++m_current;
+					else if (*m_current == ']') {
+						++m_current;
+						break;
+					} else return error(JsonErrorCode::expectedCommaOrBracket);
 				}
 			}
+
+			json.m_value = std::move(array);
+
+			--m_depth;
+			return true;
 		}
 
-		floating_type fRes = { };
-		if (auto res = fromChars(begin, end, fRes); res.ec == std::errc { }) {
-			begin = res.ptr - 1;
-			return fRes;
+		// keys without escape sequences are viewed directly in the document, so interned keys are looked up without copying them first
+		constexpr bool parseKey(key_view& key, string_type& buffer) {
+			for (auto it = m_current + 1; it != m_end; ++it) {
+				if (*it == '\"') {
+					key = key_view(m_current + 1, static_cast<size_type>(it - m_current - 1));
+					m_current = it + 1;
+
+					return true;
+				} else if (*it == '\\' || static_cast<std::make_unsigned_t<literal_type>>(*it) < 0x20) break;
+			}
+
+			buffer.clear();
+			if (!parseString(buffer)) return false;
+
+			key = key_view(buffer.data(), buffer.size());
+			return true;
 		}
 
-		throw JsonParseError("lsd::Json::parsePrimitive(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!");
-		return value_type();
-	}
+		constexpr bool parseString(string_type& string) {
+			auto run = ++m_current;
 
-	template <class Iterator> static constexpr object_type parseObject(Iterator& begin, Iterator& end, json_type& json) {
-		for (++begin; begin != end; begin++) {
-			switch(skipCharacters(begin, end)) {
-				case '}':
-					return object_type();
+			for (; m_current != m_end; ++m_current) {
+				auto c = *m_current;
 
-				default:
-					json.insert(parsePair(begin, end));
+				if (c == '\"') {
+					string.append(run, m_current - run);
+					++m_current;
+
+					return true;
+				} else if (c == '\\') {
+					string.append(run, m_current - run);
+					if (++m_current == m_end) break;
+
+					switch (*m_current) {
+						case 'b': string.pushBack('\b'); break;
+						case 't': string.pushBack('\t'); break;
+						case 'n': string.pushBack('\n'); break;
+						case 'f': string.pushBack('\f'); break;
+						case 'r': string.pushBack('\r'); break;
+						case 'u':
+							if (!parseUnicodeEscape(string)) return false;
+							break;
+
+						case '\"': case '\\': case '/': string.pushBack(*m_current); break;
 
-				case ',':
+						default: return error(JsonErrorCode::invalidEscape);
+					}
+
+					run = m_current + 1;
+				} else if (static_cast<std::make_unsigned_t<literal_type>>(c) < 0x20) {
+					return error(JsonErrorCode::controlCharacter);
+				}
 			}
+
+			return error(JsonErrorCode::unterminatedString);
 		}
 
-		throw JsonParseError("lsd::Json::parseObject(): JSON Syntax Error: Missing symbol, expected closing curly brackets to close object!");
+		constexpr bool parseHex4(char32_t& code) noexcept {
+			if (m_end - m_current < 5) return error(JsonErrorCode::invalidUnicodeEscape);
 
-		return object_type();
-	}
-	template <class Iterator> static constexpr array_type parseArray(Iterator& begin, Iterator& end) {
-		array_type r;
+			code = 0;
+			for (int i = 0; i < 4; i++) {
+				auto c = *++m_current;
+				code <<= 4;
 
-		for (++begin; begin != end; begin++) {
-			json_type tok { };
+				if (c >= '0' && c <= '9') code |= c - '0';
+				else if (c >= 'a' && c <= 'f') code |= c - 'a' + 10;
+				else if (c >= 'A' && c <= 'F') code |= c - 'A' + 10;
+				else return error(JsonErrorCode::invalidUnicodeEscape);
+			}
 
-			switch(skipCharacters(begin, end)) {
-				case '{':
-					tok.m_value = parseObject(begin, end, tok);
-					r.emplaceBack(std::move(tok));
+			return true;
+		}
+		constexpr bool parseUnicodeEscape(string_type& string) {
+			char32_t code;
+			if (!parseHex4(code)) return false;
+
+			if (code >= 0xD800 && code <= 0xDBFF) {
+				char32_t low;
+
+				if (m_end - m_current < 7 || m_current[1] != '\\' || m_current[2] != 'u') return error(JsonErrorCode::invalidUnicodeEscape);
+
+				m_current += 2;
+				if (!parseHex4(low)) return false;
+				else if (low < 0xDC00 || low > 0xDFFF) return error(JsonErrorCode::invalidUnicodeEscape);
+
+				code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+			} else if (code >= 0xDC00 && code <= 0xDFFF) return error(JsonErrorCode::invalidUnicodeEscape);
+
+			if constexpr (sizeof(literal_type) == 1) {
+				if (code < 0x80) string.pushBack(static_cast<literal_type>(code));
+				else if (code < 0x800) {
+					string.pushBack(static_cast<literal_type>(0xC0 | (code >> 6)));
+					string.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+				} else if (code < 0x10000) {
+					string.pushBack(static_cast<literal_type>(0xE0 | (code >> 12)));
+					string.pushBack(static_cast<literal_type>(0x80 | ((code >> 6) & 0x3F)));
+					string.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+				} else {
+					string.pushBack(static_cast<literal_type>(0xF0 | (code >> 18)));
+					string.pushBack(static_cast<literal_type>(0x80 | ((code >> 12) & 0x3F)));
+					string.pushBack(static_cast<literal_type>(0x80 | ((code >> 6) & 0x3F)));
+					string.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+				}
+			} else if constexpr (sizeof(literal_type) == 2) {
+				if (code < 0x10000) string.pushBack(static_cast<literal_type>(code));
+				else {
+					string.pushBack(static_cast<literal_type>(0xD800 + ((code - 0x10000) >> 10)));
+					string.pushBack(static_cast<literal_type>(0xDC00 + ((code - 0x10000) & 0x3FF)));
+				}
+			} else string.pushBack(static_cast<literal_type>(code));
 
-					break;
+			return true;
+		}
 
-				case '[':
-					tok.m_value = parseArray(begin, end);
-					r.emplaceBack(std::move(tok));
+		constexpr bool parseLiteral(const char* literal, size_type length) noexcept {
+			if (static_cast<size_type>(m_end - m_current) < length) return error(JsonErrorCode::invalidLiteral);
 
-					break;
+			for (size_type i = 0; i < length; i++)
+				if (m_current[i] != literal[i]) return error(JsonErrorCode::invalidLiteral);
 
-				case '\"':
-					tok.m_value = parseString(begin, end);
-					r.emplaceBack(std::move(tok));
+			m_current += length;
+			return true;
+		}
 
-					if (*(begin + 1) != ']') ++begin;
+		constexpr bool parseNumber(json_type& json) {
+			auto token = detail::scanJsonNumber(m_current, m_end);
+			if (token.end == m_current) return error(JsonErrorCode::unexpectedSymbol);
+			else if (!token.valid) return error(JsonErrorCode::invalidNumber);
 
-					break;
+			auto numberEnd = token.end;
+			auto isFloat = token.isFloat;
 
-				case ']':
-					return r;
+			if (!isFloat) {
+				if (*m_current == '-') {
+					signed_type s { };
+					if (auto res = fromChars(m_current, numberEnd, s); res.ec == std::errc { } && res.ptr == numberEnd) {
+						json.m_value = s;
+						m_current = numberEnd;
 
-				default:
-					tok.m_value = parsePrimitive(begin, end);
-					r.emplaceBack(std::move(tok));
+						return true;
+					}
+				} else {
+					unsigned_type u { };
+					if (auto res = fromChars(m_current, numberEnd, u); res.ec == std::errc { } && res.ptr == numberEnd) {
+						json.m_value = u;
+						m_current = numberEnd;
 
-				case '}':
-				case ',':
+						return true;
+					}
+				}
 			}
+
+			// integers out of range are stored as floating point numbers
+			floating_type f { };
+			if (auto res = fromChars(m_current, numberEnd, f); res.ec == std::errc { } && res.ptr == numberEnd) {
+				json.m_value = f;
+				m_current = numberEnd;
+
+				return true;
+			}
+
+			return error(JsonErrorCode::invalidNumber);
 		}
+	};
 
-		throw JsonParseError("lsd::Json::parseArray(): JSON Syntax Error: Missing symbol!");
 
-		return r;
+	// Stringification size estimation
+
+	static constexpr size_type primitiveSize(const json_type& t) noexcept {
+		if (t.isBoolean()) return t.get<bool>() ? 4 : 5;
+		else if (t.isSigned()) return toCharsMaxSize<signed_type>;
+		else if (t.isUnsigned()) return toCharsMaxSize<unsigned_type>;
+		else if (t.isFloating()) return toCharsMaxSize<floating_type> + 2; // see stringifyNumber()
+		else return 4;
+	}
+	static constexpr size_type stringSize(const json_type& t) noexcept {
+		const auto& string = t.get<string_type>();
+		return detail::jsonEscapedSize(string.data(), string.size()) + 2;
+	}
+	static constexpr size_type keySize(const json_type& t) noexcept {
+		key_view key(t.m_name);
+		return detail::jsonEscapedSize(key.data(), key.size()) + 2;
 	}
-	template <class Iterator> static constexpr json_type parsePair(Iterator& begin, Iterator& end) {
-		json_type tok;
 
-		if (*begin != '\"')
-			throw JsonParseError("lsd::Json::parseString(): JSON Syntax Error: Unexpected symbol, expected quotation marks!"); // the check is done here and not in the string because this is the only case where the validity of begin is not guaranteed
-		tok.m_name = parseString(begin, end);
+	static constexpr size_type valueSize(const json_type& t) noexcept {
+		if (t.isString()) return stringSize(t);
+		else if (t.isObject()) return objectSize(t);
+		else if (t.isArray()) return arraySize(t);
+		else return primitiveSize(t);
+	}
+	static constexpr size_type objectSize(const json_type& t) noexcept {
+		size_type size = 2 + (t.size() > 0 ? t.size() - 1 : 0);
+		for (const auto& pair : t) size += pairSize(pair);
 
-		if (++begin == end)
-			throw JsonParseError("lsd::Json::parseString(): JSON Syntax Error: Unexpected symbol!");
-		if (skipCharacters(begin, end) != ':')
-			throw JsonParseError("lsd::Json::parsePair(): JSON Syntax Error: Unexpected symbol, expected double colon after variable name!");
-		if (++begin == end)
-			throw JsonParseError("lsd::Json::parseString(): JSON Syntax Error: Unexpected symbol!");
+		return size;
+	}
+	static constexpr size_type arraySize(const json_type& t) noexcept {
+		const auto& array = t.get<array_type>();
 
-		switch(skipCharacters(begin, end)) {
-			case '{':
-				tok.m_value = parseObject(begin, end, tok);
-				break;
-			case '[':
-				tok.m_value = parseArray(begin, end);
-				break;
-			case '\"':
-				tok.m_value = parseString(begin, end);
-				break;
-			
-			case '}':
-			case ']':
-				++begin;
-				break;
+		size_type size = 2 + (array.size() > 0 ? array.size() - 1 : 0);
+		for (const auto& value : array) size += valueSize(value);
 
-			default:
-				tok.m_value = parsePrimitive(begin, end);
-		}
+		return size;
+	}
+	static constexpr size_type pairSize(const json_type& t) noexcept {
+		return keySize(t) + 1 + valueSize(t);
+	}
 
-		return tok;
+	static constexpr size_type valuePrettySize(size_type indent, const json_type& t) noexcept {
+		if (t.isString()) return stringSize(t);
+		else if (t.isObject()) return objectPrettySize(indent, t);
+		else if (t.isArray()) return arrayPrettySize(indent, t);
+		else return primitiveSize(t);
+	}
+	static constexpr size_type objectPrettySize(size_type indent, const json_type& t) noexcept {
+		size_type size = 4 + indent + (t.size() > 0 ? (t.size() - 1) * 2 : 0);
+		for (const auto& pair : t) size += pairPrettySize(indent + 1, pair);
+
+		return size;
+	}
+	static constexpr size_type arrayPrettySize(size_type indent, const json_type& t) noexcept {
+		const auto& array = t.get<array_type>();
+
+		size_type size = 4 + indent + (array.size() > 0 ? (array.size() - 1) * 2 : 0);
+		for (const auto& value : array) size += indent + 1 + valuePrettySize(indent + 1, value);
+
+		return size;
+	}
+	static constexpr size_type pairPrettySize(size_type indent, const json_type& t) noexcept {
+		return indent + keySize(t) + 2 + valuePrettySize(indent, t);
 	}
 
 
 	// Stringification implementations
 
+	static constexpr void stringifyString(const json_type& t, string_type& s) {
+		const auto& string = t.get<string_type>();
+		detail::appendJsonString(s, string.data(), string.size());
+	}
+	static constexpr void stringifyKey(const json_type& t, string_type& s) {
+		key_view key(t.m_name);
+		detail::appendJsonString(s, key.data(), key.size());
+	}
+
+	template <class Numerical> static constexpr void stringifyNumber(Numerical value, string_type& s) {
+		literal_type buffer[toCharsMaxSize<Numerical> + 2];
+		auto end = toChars(buffer, buffer + toCharsMaxSize<Numerical>, value).ptr;
+
+		if constexpr (std::is_floating_point_v<Numerical>) { // integral values get a fraction so they are parsed back as floating point numbers
+			if (std::all_of(buffer, end, [](literal_type c) { return c == '-' || (c >= '0' && c <= '9'); })) {
+				*end++ = '.';
+				*end++ = '0';
+			}
+		}
+
+		s.append(buffer, end - buffer);
+	}
 	static constexpr void stringifyPrimitive(const json_type& t, string_type& s) {
 		if (t.isBoolean()) {
 			if (t.get<bool>() == true) s.append("true");
 			else s.append("false");
-		} else if (t.isSigned()) {
-			if constexpr (sizeof(literal_type) == 1)
-				s.append(toString(t.get<signed_type>()));
-			else
-				s.append(toWString(t.get<signed_type>()));
-		} else if (t.isUnsigned()) {
-			if constexpr (sizeof(literal_type) == 1)
-				s.append(toString(t.get<unsigned_type>()));
-			else
-				s.append(toWString(t.get<unsigned_type>()));
-		}  else if (t.isFloating()) {
-			if constexpr (sizeof(literal_type) == 1)
-				s.append(toString(t.get<floating_type>()));
-			else
-				s.append(toWString(t.get<floating_type>()));
-		} else 
+		} else if (t.isSigned())
+			stringifyNumber(t.get<signed_type>(), s);
+		else if (t.isUnsigned())
+			stringifyNumber(t.get<unsigned_type>(), s);
+		else if (t.isFloating())
+			stringifyNumber(t.get<floating_type>(), s);
+		else 
 			s.append("null");
 	}
 	static constexpr void stringifyObject(const json_type& t, string_type& s) {
@@ -771,9 +1279,9 @@ private:
 		s.pushBack('[');
 		const auto& array = t.get<array_type>();
 		for (auto it = array.begin(); it != array.end(); it++) {
-			if (it != array.end()) s.pushBack(',');
+			if (it != array.begin()) s.pushBack(',');
 			if (it->isString())
-				s.append("\"").append(it->template get<string_type>()).pushBack('\"');
+				stringifyString(*it, s);
 			else if (it->isObject())
 				stringifyObject(*it, s);
 			else if (it->isArray())
@@ -784,10 +1292,11 @@ private:
 		s.pushBack(']');
 	}
 	static constexpr void stringifyPair(const json_type& t, string_type& s) {
-		s.append("\"").append(t.m_name).append("\":");
+		stringifyKey(t, s);
+		s.pushBack(':');
 		
 		if (t.isString())
-			s.append("\"").append(t.get<string_type>()).append("\"");
+			stringifyString(t, s);
 		else if (t.isObject())
 			stringifyObject(t, s);
 		else if (t.isArray())
@@ -817,7 +1326,7 @@ private:
 			s.append(indent, '\t');
 
 			if (it->isString())
-				s.append("\"").append(it->template get<string_type>()).pushBack('\"');
+				stringifyString(*it, s);
 			else if (it->isObject())
 				stringifyObjectPretty(indent, *it, s);
 			else if (it->isArray())
@@ -829,10 +1338,12 @@ private:
 		s.append("\n").append(--indent, '\t').pushBack(']');
 	}
 	static constexpr void stringifyPairPretty(size_type indent, const json_type& t, string_type& s) {
-		s.append(indent, '\t').append("\"").append(t.m_name).append("\": ");
+		s.append(indent, '\t');
+		stringifyKey(t, s);
+		s.append(": ");
 		
 		if (t.isString())
-			s.append("\"").append(t.get<string_type>()).pushBack('\"');
+			stringifyString(t, s);
 		else if (t.isObject())
 			stringifyObjectPretty(indent, t, s);
 		else if (t.isArray())
@@ -849,4 +1360,8 @@ private:
 using Json = BasicJson<>;
 using WJson = BasicJson<wchar_t>;
 
+// json types with interned object keys, see JsonKey.h
+using InternedJson = BasicJson<char, Vector, std::int64_t, std::uint64_t, double, UnorderedSmallSparseSet, JsonKey>;
+using InternedWJson = BasicJson<wchar_t, Vector, std::int64_t, std::uint64_t, double, UnorderedSmallSparseSet, WJsonKey>;
+
 } // namespace lsd
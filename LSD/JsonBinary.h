@@ -0,0 +1,713 @@
+/**************************
+ * @file JsonBinary.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief MessagePack and CBOR encodings for JSON documents
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "StringView.h"
+#include "JSON.h"
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace lsd {
+
+enum class JsonBinaryType : std::uint8_t {
+	null,
+	boolean,
+	signedInt,
+	unsignedInt,
+	floating,
+	string,
+	array,
+	object,
+	end // end of an array or object of indefinite size
+};
+
+/**
+ * @brief A single value read from a binary encoded document
+ *
+ * @details Arrays and objects only report their size, their elements (or key value pairs) follow as separate items.
+ * Strings point into the buffer that is being read.
+ */
+struct JsonBinaryItem {
+	static constexpr std::size_t indefinite = std::numeric_limits<std::size_t>::max();
+
+	JsonBinaryType type = JsonBinaryType::null;
+
+	bool boolean = false;
+	std::int64_t signedInt = 0;
+	std::uint64_t unsignedInt = 0;
+	double floating = 0.0;
+	StringView string;
+	std::size_t size = 0;
+};
+
+
+namespace detail {
+
+class JsonBinaryReaderBase {
+public:
+	using size_type = std::size_t;
+	using byte_type = std::uint8_t;
+
+	constexpr JsonBinaryReaderBase(const byte_type* begin, const byte_type* end) noexcept : m_begin(begin), m_current(begin), m_end(end) { }
+
+	[[nodiscard]] constexpr bool done() const noexcept {
+		return m_current == m_end;
+	}
+	[[nodiscard]] constexpr size_type offset() const noexcept {
+		return m_current - m_begin;
+	}
+	[[nodiscard]] constexpr size_type remaining() const noexcept {
+		return m_end - m_current;
+	}
+
+protected:
+	const byte_type* m_begin;
+	const byte_type* m_current;
+	const byte_type* m_end;
+
+	constexpr void require(size_type count) const {
+		if (static_cast<size_type>(m_end - m_current) < count) LSD_THROW(JsonParseError("lsd::JsonBinaryReader: Binary Syntax Error: Unexpected end of the document!"));
+	}
+	constexpr byte_type readByte() {
+		require(1);
+		return *m_current++;
+	}
+	template <class Ty> constexpr Ty readBigEndian() {
+		require(sizeof(Ty));
+
+		std::uint64_t r = 0;
+		for (size_type i = 0; i < sizeof(Ty); i++) r = (r << 8) | *m_current++;
+
+		return static_cast<Ty>(r);
+	}
+	StringView readBytes(size_type count) {
+		require(count);
+
+		StringView r(reinterpret_cast<const char*>(m_current), count);
+		m_current += count;
+
+		return r;
+	}
+};
+
+template <class Buffer> class JsonBinaryWriterBase {
+public:
+	using size_type = std::size_t;
+	using byte_type = std::uint8_t;
+
+	constexpr JsonBinaryWriterBase(Buffer& out) noexcept : m_out(out) { }
+
+protected:
+	Buffer& m_out;
+
+	constexpr void writeByte(byte_type byte) {
+		m_out.pushBack(static_cast<typename Buffer::value_type>(byte));
+	}
+	template <class Ty> constexpr void writeBigEndian(Ty value) {
+		auto bits = static_cast<std::uint64_t>(value);
+		for (size_type i = sizeof(Ty); i > 0; i--) writeByte(static_cast<byte_type>(bits >> ((i - 1) * 8)));
+	}
+	constexpr void writeBytes(StringView bytes) {
+		for (auto c : bytes) writeByte(static_cast<byte_type>(c));
+	}
+
+	// doubles which survive the round trip through single precision are stored in half the space
+	static constexpr bool fitsFloat(double value) noexcept {
+		return value != value || static_cast<double>(static_cast<float>(value)) == value;
+	}
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Streaming MessagePack encoder
+ *
+ * @details Arrays and maps are started with their element count, followed by the elements (or alternating keys and values).
+ * Signed integers are always written with the signed formats, so that the type survives a round trip.
+ *
+ * @tparam Buffer byte container to append to
+ */
+template <class Buffer = Vector<std::uint8_t>> class MsgPackWriter : private detail::JsonBinaryWriterBase<Buffer> {
+private:
+	using base = detail::JsonBinaryWriterBase<Buffer>;
+
+	using base::writeByte;
+	using base::writeBigEndian;
+	using base::writeBytes;
+	using base::fitsFloat;
+
+public:
+	using typename base::size_type;
+
+	constexpr MsgPackWriter(Buffer& out) noexcept : base(out) { }
+
+	constexpr void writeNull() {
+		writeByte(0xc0);
+	}
+	constexpr void writeBool(bool value) {
+		writeByte(value ? 0xc3 : 0xc2);
+	}
+	constexpr void writeUnsigned(std::uint64_t value) {
+		if (value < 0x80) writeByte(static_cast<std::uint8_t>(value));
+		else if (value <= 0xff) {
+			writeByte(0xcc);
+			writeBigEndian(static_cast<std::uint8_t>(value));
+		} else if (value <= 0xffff) {
+			writeByte(0xcd);
+			writeBigEndian(static_cast<std::uint16_t>(value));
+		} else if (value <= 0xffffffff) {
+			writeByte(0xce);
+			writeBigEndian(static_cast<std::uint32_t>(value));
+		} else {
+			writeByte(0xcf);
+			writeBigEndian(value);
+		}
+	}
+	constexpr void writeSigned(std::int64_t value) {
+		if (value < 0 && value >= -32) writeByte(static_cast<std::uint8_t>(value));
+		else if (value >= std::numeric_limits<std::int8_t>::min() && value <= std::numeric_limits<std::int8_t>::max()) {
+			writeByte(0xd0);
+			writeBigEndian(static_cast<std::int8_t>(value));
+		} else if (value >= std::numeric_limits<std::int16_t>::min() && value <= std::numeric_limits<std::int16_t>::max()) {
+			writeByte(0xd1);
+			writeBigEndian(static_cast<std::int16_t>(value));
+		} else if (value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max()) {
+			writeByte(0xd2);
+			writeBigEndian(static_cast<std::int32_t>(value));
+		} else {
+			writeByte(0xd3);
+			writeBigEndian(value);
+		}
+	}
+	constexpr void writeFloating(double value) {
+		if (fitsFloat(value)) {
+			writeByte(0xca);
+			writeBigEndian(std::bit_cast<std::uint32_t>(static_cast<float>(value)));
+		} else {
+			writeByte(0xcb);
+			writeBigEndian(std::bit_cast<std::uint64_t>(value));
+		}
+	}
+	constexpr void writeString(StringView value) {
+		auto size = value.size();
+
+		if (size < 32) writeByte(static_cast<std::uint8_t>(0xa0 | size));
+		else if (size <= 0xff) {
+			writeByte(0xd9);
+			writeBigEndian(static_cast<std::uint8_t>(size));
+		} else if (size <= 0xffff) {
+			writeByte(0xda);
+			writeBigEndian(static_cast<std::uint16_t>(size));
+		} else {
+			writeByte(0xdb);
+			writeBigEndian(static_cast<std::uint32_t>(size));
+		}
+
+		writeBytes(value);
+	}
+	constexpr void beginArray(size_type count) {
+		writeContainer(count, 0x90, 0xdc);
+	}
+	constexpr void beginObject(size_type count) {
+		writeContainer(count, 0x80, 0xde);
+	}
+
+private:
+	constexpr void writeContainer(size_type count, std::uint8_t fix, std::uint8_t format) {
+		if (count < 16) writeByte(static_cast<std::uint8_t>(fix | count));
+		else if (count <= 0xffff) {
+			writeByte(format);
+			writeBigEndian(static_cast<std::uint16_t>(count));
+		} else {
+			writeByte(format + 1);
+			writeBigEndian(static_cast<std::uint32_t>(count));
+		}
+	}
+};
+
+/**
+ * @brief Streaming MessagePack decoder
+ *
+ * @details Binary data is reported as a string, extension types are not supported.
+ */
+class MsgPackReader : public detail::JsonBinaryReaderBase {
+public:
+	using detail::JsonBinaryReaderBase::JsonBinaryReaderBase;
+
+	/**
+	 * @brief Read the next item of the document
+	 *
+	 * @return The item
+	 */
+	JsonBinaryItem next() {
+		JsonBinaryItem r;
+		auto byte = readByte();
+
+		if (byte < 0x80) return unsignedItem(byte);
+		else if (byte >= 0xe0) return signedItem(static_cast<std::int8_t>(byte));
+		else if (byte < 0x90) return containerItem(JsonBinaryType::object, byte & 0x0f);
+		else if (byte < 0xa0) return containerItem(JsonBinaryType::array, byte & 0x0f);
+		else if (byte < 0xc0) return stringItem(byte & 0x1f);
+
+		switch (byte) {
+			case 0xc0: break;
+			case 0xc2: case 0xc3:
+				r.type = JsonBinaryType::boolean;
+				r.boolean = (byte == 0xc3);
+				break;
+
+			case 0xc4: case 0xd9: return stringItem(readBigEndian<std::uint8_t>());
+			case 0xc5: case 0xda: return stringItem(readBigEndian<std::uint16_t>());
+			case 0xc6: case 0xdb: return stringItem(readBigEndian<std::uint32_t>());
+
+			case 0xca: return floatingItem(std::bit_cast<float>(readBigEndian<std::uint32_t>()));
+			case 0xcb: return floatingItem(std::bit_cast<double>(readBigEndian<std::uint64_t>()));
+
+			case 0xcc: return unsignedItem(readBigEndian<std::uint8_t>());
+			case 0xcd: return unsignedItem(readBigEndian<std::uint16_t>());
+			case 0xce: return unsignedItem(readBigEndian<std::uint32_t>());
+			case 0xcf: return unsignedItem(readBigEndian<std::uint64_t>());
+
+			case 0xd0: return signedItem(readBigEndian<std::int8_t>());
+			case 0xd1: return signedItem(readBigEndian<std::int16_t>());
+			case 0xd2: return signedItem(readBigEndian<std::int32_t>());
+			case 0xd3: return signedItem(readBigEndian<std::int64_t>());
+
+			case 0xdc: return containerItem(JsonBinaryType::array, readBigEndian<std::uint16_t>());
+			case 0xdd: return containerItem(JsonBinaryType::array, readBigEndian<std::uint32_t>());
+			case 0xde: return containerItem(JsonBinaryType::object, readBigEndian<std::uint16_t>());
+			case 0xdf: return containerItem(JsonBinaryType::object, readBigEndian<std::uint32_t>());
+
+			case 0xc1: LSD_THROW(JsonParseError("lsd::MsgPackReader::next(): Binary Syntax Error: Invalid type byte!"));
+			default: LSD_THROW(JsonParseError("lsd::MsgPackReader::next(): Binary Syntax Error: Extension types are not supported!"));
+		}
+
+		return r;
+	}
+
+private:
+	static constexpr JsonBinaryItem unsignedItem(std::uint64_t value) noexcept {
+		JsonBinaryItem r;
+		r.type = JsonBinaryType::unsignedInt;
+		r.unsignedInt = value;
+		return r;
+	}
+	static constexpr JsonBinaryItem signedItem(std::int64_t value) noexcept {
+		JsonBinaryItem r;
+		r.type = JsonBinaryType::signedInt;
+		r.signedInt = value;
+		return r;
+	}
+	static constexpr JsonBinaryItem floatingItem(double value) noexcept {
+		JsonBinaryItem r;
+		r.type = JsonBinaryType::floating;
+		r.floating = value;
+		return r;
+	}
+	static constexpr JsonBinaryItem containerItem(JsonBinaryType type, size_type size) noexcept {
+		JsonBinaryItem r;
+		r.type = type;
+		r.size = size;
+		return r;
+	}
+	JsonBinaryItem stringItem(size_type size) {
+		JsonBinaryItem r;
+		r.type = JsonBinaryType::string;
+		r.string = readBytes(size);
+		return r;
+	}
+};
+
+
+/**
+ * @brief Streaming CBOR (RFC 8949) encoder
+ *
+ * @details CBOR has a single integer type, so non-negative signed integers are decoded as unsigned ones, exactly like the text parser does.
+ *
+ * @tparam Buffer byte container to append to
+ */
+template <class Buffer = Vector<std::uint8_t>> class CborWriter : private detail::JsonBinaryWriterBase<Buffer> {
+private:
+	using base = detail::JsonBinaryWriterBase<Buffer>;
+
+	using base::writeByte;
+	using base::writeBigEndian;
+	using base::writeBytes;
+	using base::fitsFloat;
+
+public:
+	using typename base::size_type;
+
+	constexpr CborWriter(Buffer& out) noexcept : base(out) { }
+
+	constexpr void writeNull() {
+		writeByte(0xf6);
+	}
+	constexpr void writeBool(bool value) {
+		writeByte(value ? 0xf5 : 0xf4);
+	}
+	constexpr void writeUnsigned(std::uint64_t value) {
+		writeHead(0, value);
+	}
+	constexpr void writeSigned(std::int64_t value) {
+		if (value >= 0) writeHead(0, static_cast<std::uint64_t>(value));
+		else writeHead(1, ~static_cast<std::uint64_t>(value));
+	}
+	constexpr void writeFloating(double value) {
+		if (fitsFloat(value)) {
+			writeByte(0xfa);
+			writeBigEndian(std::bit_cast<std::uint32_t>(static_cast<float>(value)));
+		} else {
+			writeByte(0xfb);
+			writeBigEndian(std::bit_cast<std::uint64_t>(value));
+		}
+	}
+	constexpr void writeString(StringView value) {
+		writeHead(3, value.size());
+		writeBytes(value);
+	}
+	constexpr void beginArray(size_type count) {
+		writeHead(4, count);
+	}
+	constexpr void beginObject(size_type count) {
+		writeHead(5, count);
+	}
+
+private:
+	constexpr void writeHead(std::uint8_t major, std::uint64_t value) {
+		major <<= 5;
+
+		if (value < 24) writeByte(static_cast<std::uint8_t>(major | value));
+		else if (value <= 0xff) {
+			writeByte(major | 24);
+			writeBigEndian(static_cast<std::uint8_t>(value));
+		} else if (value <= 0xffff) {
+			writeByte(major | 25);
+			writeBigEndian(static_cast<std::uint16_t>(value));
+		} else if (value <= 0xffffffff) {
+			writeByte(major | 26);
+			writeBigEndian(static_cast<std::uint32_t>(value));
+		} else {
+			writeByte(major | 27);
+			writeBigEndian(value);
+		}
+	}
+};
+
+/**
+ * @brief Streaming CBOR (RFC 8949) decoder
+ *
+ * @details Byte strings are reported as strings and tags are skipped. Arrays and maps of indefinite length report JsonBinaryItem::indefinite as their size and are terminated by an item of type end.
+ * Strings of indefinite length are not supported.
+ */
+class CborReader : public detail::JsonBinaryReaderBase {
+public:
+	using detail::JsonBinaryReaderBase::JsonBinaryReaderBase;
+
+	/**
+	 * @brief Read the next item of the document
+	 *
+	 * @return The item
+	 */
+	JsonBinaryItem next() {
+		JsonBinaryItem r;
+
+		while (true) {
+			auto byte = readByte();
+			auto major = byte >> 5;
+			auto info = byte & 0x1f;
+
+			if (major == 7) {
+				switch (info) {
+					case 20: case 21:
+						r.type = JsonBinaryType::boolean;
+						r.boolean = (info == 21);
+						break;
+
+					case 22: case 23: break;
+
+					case 25:
+						r.type = JsonBinaryType::floating;
+						r.floating = halfToDouble(readBigEndian<std::uint16_t>());
+						break;
+
+					case 26:
+						r.type = JsonBinaryType::floating;
+						r.floating = std::bit_cast<float>(readBigEndian<std::uint32_t>());
+						break;
+
+					case 27:
+						r.type = JsonBinaryType::floating;
+						r.floating = std::bit_cast<double>(readBigEndian<std::uint64_t>());
+						break;
+
+					case 31:
+						r.type = JsonBinaryType::end;
+						break;
+
+					default: LSD_THROW(JsonParseError("lsd::CborReader::next(): Binary Syntax Error: Unsupported simple value!"));
+				}
+
+				return r;
+			}
+
+			if (info == 31) {
+				if (major == 4 || major == 5) {
+					r.type = (major == 4) ? JsonBinaryType::array : JsonBinaryType::object;
+					r.size = JsonBinaryItem::indefinite;
+
+					return r;
+				}
+
+				LSD_THROW(JsonParseError("lsd::CborReader::next(): Binary Syntax Error: Strings of indefinite length are not supported!"));
+			}
+
+			auto argument = readArgument(info);
+
+			switch (major) {
+				case 0:
+					r.type = JsonBinaryType::unsignedInt;
+					r.unsignedInt = argument;
+					return r;
+
+				case 1:
+					if (argument > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+						LSD_THROW(JsonParseError("lsd::CborReader::next(): Binary Syntax Error: Negative integer out of range!"));
+
+					r.type = JsonBinaryType::signedInt;
+					r.signedInt = -1 - static_cast<std::int64_t>(argument);
+					return r;
+
+				case 2: case 3:
+					if (argument > static_cast<std::uint64_t>(m_end - m_current))
+						LSD_THROW(JsonParseError("lsd::JsonBinaryReader: Binary Syntax Error: Unexpected end of the document!"));
+
+					r.type = JsonBinaryType::string;
+					r.string = readBytes(static_cast<size_type>(argument));
+					return r;
+
+				case 4: case 5:
+					if (argument >= JsonBinaryItem::indefinite)
+						LSD_THROW(JsonParseError("lsd::CborReader::next(): Binary Syntax Error: Container size out of range!"));
+
+					r.type = (major == 4) ? JsonBinaryType::array : JsonBinaryType::object;
+					r.size = static_cast<size_type>(argument);
+					return r;
+
+				default: // tags only annotate the following item
+					continue;
+			}
+		}
+	}
+
+private:
+	constexpr std::uint64_t readArgument(std::uint8_t info) {
+		switch (info) {
+			case 24: return readBigEndian<std::uint8_t>();
+			case 25: return readBigEndian<std::uint16_t>();
+			case 26: return readBigEndian<std::uint32_t>();
+			case 27: return readBigEndian<std::uint64_t>();
+		}
+
+		if (info > 27) LSD_THROW(JsonParseError("lsd::CborReader::next(): Binary Syntax Error: Reserved additional information!"));
+		return info;
+	}
+
+	static double halfToDouble(std::uint16_t half) noexcept {
+		auto exponent = (half >> 10) & 0x1f;
+		auto mantissa = half & 0x3ff;
+
+		double r;
+		if (exponent == 0) r = std::ldexp(mantissa, -24);
+		else if (exponent != 31) r = std::ldexp(mantissa + 1024, exponent - 25);
+		else r = (mantissa == 0) ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+
+		return (half & 0x8000) ? -r : r;
+	}
+};
+
+
+namespace detail {
+
+template <class Writer, class JsonType> constexpr void encodeJsonBinary(Writer& writer, const JsonType& json) {
+	static_assert(sizeof(typename JsonType::literal_type) == 1, "lsd::encodeJsonBinary(): Binary encodings are only supported for JSON with UTF-8 strings!");
+
+	using key_view = typename JsonType::key_view;
+	using array_type = typename JsonType::array_type;
+	using string_type = typename JsonType::string_type;
+
+	if (json.isObject()) {
+		writer.beginObject(json.size());
+
+		for (const auto& child : json) {
+			key_view key(child.name());
+			writer.writeString(StringView(reinterpret_cast<const char*>(key.data()), key.size()));
+			encodeJsonBinary(writer, child);
+		}
+	} else if (json.isArray()) {
+		const auto& array = json.template get<array_type>();
+		writer.beginArray(array.size());
+
+		for (const auto& element : array) encodeJsonBinary(writer, element);
+	} else if (json.isString()) {
+		const auto& string = json.template get<string_type>();
+		writer.writeString(StringView(reinterpret_cast<const char*>(string.data()), string.size()));
+	} else if (json.isSigned()) writer.writeSigned(json.signedInt());
+	else if (json.isUnsigned()) writer.writeUnsigned(json.unsignedInt());
+	else if (json.isFloating()) writer.writeFloating(json.floating());
+	else if (json.isBoolean()) writer.writeBool(json.boolean());
+	else writer.writeNull();
+}
+
+template <class JsonType, class Reader> void decodeJsonBinary(Reader& reader, JsonType& json, const JsonBinaryItem& item, std::size_t depth) {
+	static_assert(sizeof(typename JsonType::literal_type) == 1, "lsd::decodeJsonBinary(): Binary encodings are only supported for JSON with UTF-8 strings!");
+
+	using value_type = typename JsonType::value_type;
+	using literal_type = typename JsonType::literal_type;
+	using key_type = typename JsonType::key_type;
+	using key_view = typename JsonType::key_view;
+
+	static constexpr std::size_t maxDepth = 1024;
+
+	auto toView = [](StringView string) {
+		return key_view(reinterpret_cast<const literal_type*>(string.data()), string.size());
+	};
+
+	switch (item.type) {
+		case JsonBinaryType::null: json = value_type(JsonNull { }); break;
+		case JsonBinaryType::boolean: json = value_type(item.boolean); break;
+		case JsonBinaryType::signedInt: json = value_type(static_cast<typename JsonType::signed_type>(item.signedInt)); break;
+		case JsonBinaryType::unsignedInt: json = value_type(static_cast<typename JsonType::unsigned_type>(item.unsignedInt)); break;
+		case JsonBinaryType::floating: json = value_type(static_cast<typename JsonType::floating_type>(item.floating)); break;
+		case JsonBinaryType::string: {
+			auto string = toView(item.string);
+			json = value_type(typename JsonType::string_type(string.data(), string.size()));
+			break;
+		}
+
+		case JsonBinaryType::array: {
+			if (depth >= maxDepth) LSD_THROW(JsonParseError("lsd::decodeJsonBinary(): Binary Syntax Error: Document exceeds the maximum nesting depth!"));
+
+			typename JsonType::array_type array;
+			if (item.size != JsonBinaryItem::indefinite) array.reserve(std::min(item.size, reader.remaining())); // every element takes at least one byte
+
+			for (std::size_t i = 0; i < item.size; i++) {
+				auto element = reader.next();
+				if (element.type == JsonBinaryType::end && item.size == JsonBinaryItem::indefinite) break;
+
+				decodeJsonBinary(reader, array.emplaceBack(), element, depth + 1);
+			}
+
+			json = value_type(std::move(array));
+			break;
+		}
+
+		case JsonBinaryType::object: {
+			if (depth >= maxDepth) LSD_THROW(JsonParseError("lsd::decodeJsonBinary(): Binary Syntax Error: Document exceeds the maximum nesting depth!"));
+
+			json = value_type(JsonObject { });
+
+			for (std::size_t i = 0; i < item.size; i++) {
+				auto key = reader.next();
+				if (key.type == JsonBinaryType::end && item.size == JsonBinaryItem::indefinite) break;
+				else if (key.type != JsonBinaryType::string) LSD_THROW(JsonParseError("lsd::decodeJsonBinary(): Binary Syntax Error: Keys of objects have to be strings!"));
+
+				JsonType child(key_type(toView(key.string)), value_type(JsonNull { }));
+				decodeJsonBinary(reader, child, reader.next(), depth + 1);
+
+				json.insert(std::move(child));
+			}
+
+			break;
+		}
+
+		case JsonBinaryType::end: LSD_THROW(JsonParseError("lsd::decodeJsonBinary(): Binary Syntax Error: Unexpected break outside of a container of indefinite size!"));
+	}
+}
+
+template <class JsonType, class Reader> JsonType decodeJsonBinaryDocument(Reader reader) {
+	JsonType json;
+	decodeJsonBinary(reader, json, reader.next(), 0);
+
+	if (!reader.done()) LSD_THROW(JsonParseError("lsd::decodeJsonBinary(): Binary Syntax Error: Unexpected data after the end of the document!"));
+
+	return json;
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Encode a JSON document as MessagePack
+ *
+ * @param json document to encode
+ *
+ * @return Encoded bytes
+ */
+template <class JsonType> [[nodiscard]] Vector<std::uint8_t> toMsgPack(const JsonType& json) {
+	Vector<std::uint8_t> r;
+	MsgPackWriter<> writer(r);
+	detail::encodeJsonBinary(writer, json);
+	return r;
+}
+/**
+ * @brief Decode a MessagePack encoded JSON document
+ *
+ * @param data pointer to the encoded bytes
+ * @param size number of encoded bytes
+ *
+ * @return Decoded document
+ */
+template <class JsonType = Json> [[nodiscard]] JsonType fromMsgPack(const std::uint8_t* data, std::size_t size) {
+	return detail::decodeJsonBinaryDocument<JsonType>(MsgPackReader(data, data + size));
+}
+template <class JsonType = Json, class Container> [[nodiscard]] JsonType fromMsgPack(const Container& bytes) {
+	return fromMsgPack<JsonType>(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size());
+}
+
+/**
+ * @brief Encode a JSON document as CBOR
+ *
+ * @param json document to encode
+ *
+ * @return Encoded bytes
+ */
+template <class JsonType> [[nodiscard]] Vector<std::uint8_t> toCbor(const JsonType& json) {
+	Vector<std::uint8_t> r;
+	CborWriter<> writer(r);
+	detail::encodeJsonBinary(writer, json);
+	return r;
+}
+/**
+ * @brief Decode a CBOR encoded JSON document
+ *
+ * @param data pointer to the encoded bytes
+ * @param size number of encoded bytes
+ *
+ * @return Decoded document
+ */
+template <class JsonType = Json> [[nodiscard]] JsonType fromCbor(const std::uint8_t* data, std::size_t size) {
+	return detail::decodeJsonBinaryDocument<JsonType>(CborReader(data, data + size));
+}
+template <class JsonType = Json, class Container> [[nodiscard]] JsonType fromCbor(const Container& bytes) {
+	return fromCbor<JsonType>(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size());
+}
+
+} // namespace lsd
@@ -0,0 +1,652 @@
+/**************************
+ * @file JsonBinding.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Declarative binding of structs to JSON text
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Array.h"
+#include "String.h"
+#include "StringView.h"
+#include "FromChars.h"
+#include "JSON.h"
+
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace lsd {
+
+/**
+ * @brief A named member of a bound struct
+ *
+ * @tparam Class struct containing the member
+ * @tparam Member type of the member
+ */
+template <class Class, class Member> struct JsonField {
+	using class_type = Class;
+	using member_type = Member;
+
+	StringView name;
+	Member Class::* member;
+};
+
+template <class Class, class Member> [[nodiscard]] constexpr JsonField<Class, Member> jsonField(StringView name, Member Class::* member) noexcept {
+	return { name, member };
+}
+template <class... Fields> [[nodiscard]] constexpr std::tuple<Fields...> jsonFields(Fields... fields) noexcept {
+	return { fields... };
+}
+
+/**
+ * @brief Binds the members of a struct to the keys of a JSON object
+ *
+ * @details Specializations have to provide a static constexpr tuple of JsonFields named fields, for example:
+ *
+ * template <> struct lsd::JsonBinding<Point> {
+ * 	static constexpr auto fields = lsd::jsonFields(JSON_FIELD(Point, x), JSON_FIELD(Point, y));
+ * };
+ *
+ * Members can be booleans, arithmetic types, strings, sequences with emplaceBack() or emplace_back(), std::optional and other bound structs.
+ *
+ * @tparam Ty struct to bind
+ */
+template <class Ty> struct JsonBinding;
+
+template <class Ty> concept JsonBound = requires {
+	JsonBinding<Ty>::fields;
+	std::tuple_size<std::remove_cvref_t<decltype(JsonBinding<Ty>::fields)>>::value;
+};
+
+#define JSON_FIELD(type, member) ::lsd::jsonField(#member, &type::member)
+
+
+namespace detail {
+
+template <class Ty> inline constexpr auto& jsonBindingFields = JsonBinding<Ty>::fields;
+template <class Ty> inline constexpr std::size_t jsonBindingFieldCount = std::tuple_size_v<std::remove_cvref_t<decltype(JsonBinding<Ty>::fields)>>;
+
+template <class> struct IsOptional : std::false_type { };
+template <class Ty> struct IsOptional<std::optional<Ty>> : std::true_type { };
+
+template <class Ty> concept JsonBindingString = std::same_as<typename Ty::value_type, char> && requires(Ty s, const char* p, std::size_t n) {
+	s.append(p, n);
+	s.clear();
+	s.data();
+	s.size();
+};
+template <class Ty> concept JsonBindingSequence = requires(Ty s) {
+	s.clear();
+	s.begin();
+	s.end();
+} && (requires(Ty s) { s.emplaceBack(); } || requires(Ty s) { s.emplace_back(); });
+
+
+// perfect hash over the field names of a binding, computed at compile time
+
+constexpr std::uint64_t jsonFieldHash(const char* data, std::size_t size, std::uint64_t seed) noexcept {
+	std::uint64_t hash = seed ^ (size * 0x9E3779B97F4A7C15ull);
+	for (std::size_t i = 0; i < size; i++) hash = (hash ^ static_cast<unsigned char>(data[i])) * 0x100000001B3ull;
+
+	return hash ^ (hash >> 32);
+}
+
+template <std::size_t Count> struct JsonFieldTable {
+	static constexpr std::size_t capacity = std::bit_ceil(Count == 0 ? 1 : Count) * 4;
+	static constexpr std::size_t empty = Count;
+
+	Array<std::size_t, capacity> slots { };
+	std::uint64_t seed = 0;
+	std::size_t mask = 0;
+	bool perfect = false;
+};
+
+template <class Ty, std::size_t... Is> consteval Array<StringView, sizeof...(Is)> jsonFieldNames(std::index_sequence<Is...>) {
+	return { std::get<Is>(jsonBindingFields<Ty>).name... };
+}
+
+template <class Ty> inline constexpr auto jsonBindingFieldNames = jsonFieldNames<Ty>(std::make_index_sequence<jsonBindingFieldCount<Ty>>());
+
+template <class Ty> consteval bool jsonFieldNamesUnique() {
+	constexpr auto count = jsonBindingFieldCount<Ty>;
+	auto& names = jsonBindingFieldNames<Ty>;
+
+	for (std::size_t i = 0; i < count; i++)
+		for (std::size_t j = i + 1; j < count; j++)
+			if (names[i] == names[j]) return false;
+
+	return true;
+}
+
+template <class Ty> consteval auto makeJsonFieldTable() {
+	constexpr auto count = jsonBindingFieldCount<Ty>;
+	using table_type = JsonFieldTable<count>;
+
+	auto& names = jsonBindingFieldNames<Ty>;
+	table_type table;
+
+	for (std::size_t size = table_type::capacity / 4; size <= table_type::capacity; size *= 2) {
+		for (std::uint64_t seed = 0; seed < 1024; seed++) {
+			for (auto& slot : table.slots) slot = table_type::empty;
+
+			bool collision = false;
+			for (std::size_t i = 0; i < count && !collision; i++) {
+				auto& slot = table.slots[jsonFieldHash(names[i].data(), names[i].size(), seed) & (size - 1)];
+
+				if (slot != table_type::empty) collision = true;
+				else slot = i;
+			}
+
+			if (!collision) {
+				table.seed = seed;
+				table.mask = size - 1;
+				table.perfect = true;
+
+				return table;
+			}
+		}
+	}
+
+	return table;
+}
+
+template <class Ty> inline constexpr auto jsonFieldTable = makeJsonFieldTable<Ty>();
+
+
+/**
+ * @brief Parses JSON text directly into bound structs without building a document
+ */
+class JsonBindingReader {
+public:
+	using size_type = std::size_t;
+
+	static constexpr size_type maxDepth = 1024;
+
+	constexpr JsonBindingReader(const char* begin, const char* end) noexcept : m_begin(begin), m_end(end) { }
+
+	template <class Ty> void parseDocument(Ty& value) {
+		skipWhitespace();
+		read(value);
+
+		skipWhitespace();
+		if (m_begin != m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol after the end of the document!"));
+	}
+
+private:
+	const char* m_begin;
+	const char* m_end;
+	size_type m_depth = 0;
+
+	String m_keyBuffer;
+
+	constexpr void skipWhitespace() noexcept {
+		while (m_begin != m_end && (*m_begin == ' ' || *m_begin == '\n' || *m_begin == '\r' || *m_begin == '\t'))
+			++m_begin;
+	}
+	void expect(char c, const char* message) {
+		skipWhitespace();
+		if (m_begin == m_end || *m_begin != c) LSD_THROW(JsonParseError(message));
+		++m_begin;
+	}
+	bool consumeLiteral(const char* literal, size_type length) noexcept {
+		if (static_cast<size_type>(m_end - m_begin) < length || std::memcmp(m_begin, literal, length) != 0) return false;
+
+		m_begin += length;
+		return true;
+	}
+	bool consumeNull() noexcept {
+		return m_begin != m_end && *m_begin == 'n' && consumeLiteral("null", 4);
+	}
+
+	template <class Ty> void read(Ty& value) {
+		if (m_begin == m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected end of the document, expected a value!"));
+
+		if constexpr (IsOptional<Ty>::value) {
+			if (consumeNull()) value.reset();
+			else read(value.emplace());
+		} else if constexpr (std::same_as<Ty, bool>) {
+			if (consumeLiteral("true", 4)) value = true;
+			else if (consumeLiteral("false", 5)) value = false;
+			else LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected a boolean!"));
+		} else if constexpr (std::is_arithmetic_v<Ty>) {
+			readNumber(value);
+		} else if constexpr (JsonBindingString<Ty>) {
+			if (*m_begin != '\"') LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected a string!"));
+
+			value.clear();
+			readString(value);
+		} else if constexpr (JsonBound<Ty>) {
+			readObject(value);
+		} else if constexpr (JsonBindingSequence<Ty>) {
+			readArray(value);
+		} else static_assert(sizeof(Ty) == 0, "lsd::fromJson(): Member type can not be bound to JSON!");
+	}
+
+	template <class Ty> void readNumber(Ty& value) {
+		auto token = scanJsonNumber(m_begin, m_end);
+		if (!token.valid) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Invalid number!"));
+
+		auto numberEnd = token.end;
+
+		if constexpr (std::is_integral_v<Ty>) {
+			if (token.isFloat) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Expected an integer, got a floating point number!"));
+		}
+
+		if (auto res = fromChars(m_begin, numberEnd, value); res.ec == std::errc { } && res.ptr == numberEnd) {
+			m_begin = numberEnd;
+			return;
+		} else if (res.ec == std::errc::result_out_of_range) {
+			LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Number out of range of the member type!"));
+		}
+
+		LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Invalid number!"));
+	}
+
+	template <class Ty> void readObject(Ty& value) {
+		static_assert(jsonFieldNamesUnique<Ty>(), "lsd::JsonBinding: Field names of a binding must be unique!");
+
+		if (*m_begin != '{') LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected an object!"));
+		if (++m_depth > maxDepth) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Document exceeds the maximum nesting depth!"));
+
+		++m_begin;
+		skipWhitespace();
+
+		if (m_begin != m_end && *m_begin == '}') {
+			++m_begin;
+			--m_depth;
+			return;
+		}
+
+		while (true) {
+			skipWhitespace();
+			if (m_begin == m_end || *m_begin != '\"') LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected quotation marks!"));
+
+			auto index = findField<Ty>(readKey());
+
+			expect(':', "lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected colon after member name!");
+			skipWhitespace();
+
+			if (index == jsonBindingFieldCount<Ty>) skipValue();
+			else dispatchField(value, index, std::make_index_sequence<jsonBindingFieldCount<Ty>>());
+
+			skipWhitespace();
+			if (m_begin == m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Missing symbol, expected closing bracket!"));
+			else if (*m_begin == ',') ++m_begin;
+			else if (*m_begin == '}') {
+				++m_begin;
+				break;
+			} else LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected comma or closing bracket!"));
+		}
+
+		--m_depth;
+	}
+
+	template <class Ty> void readArray(Ty& value) {
+		if (*m_begin != '[') LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected an array!"));
+		if (++m_depth > maxDepth) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Document exceeds the maximum nesting depth!"));
+
+		value.clear();
+
+		++m_begin;
+		skipWhitespace();
+
+		if (m_begin != m_end && *m_begin == ']') {
+			++m_begin;
+			--m_depth;
+			return;
+		}
+
+		while (true) {
+			skipWhitespace();
+
+			if constexpr (requires { value.emplaceBack(); }) read(value.emplaceBack());
+			else read(value.emplace_back());
+
+			skipWhitespace();
+			if (m_begin == m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Missing symbol, expected closing bracket!"));
+			else if (*m_begin == ',') ++m_begin;
+			else if (*m_begin == ']') {
+				++m_begin;
+				break;
+			} else LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected comma or closing bracket!"));
+		}
+
+		--m_depth;
+	}
+
+	template <class Ty> static size_type findField(StringView key) noexcept {
+		constexpr auto count = jsonBindingFieldCount<Ty>;
+		constexpr auto& table = jsonFieldTable<Ty>;
+
+		if constexpr (count == 0) {
+			return 0;
+		} else if constexpr (table.perfect) {
+			auto index = table.slots[jsonFieldHash(key.data(), key.size(), table.seed) & table.mask];
+			return (index != count && jsonBindingFieldNames<Ty>[index] == key) ? index : count;
+		} else {
+			for (size_type i = 0; i < count; i++)
+				if (jsonBindingFieldNames<Ty>[i] == key) return i;
+
+			return count;
+		}
+	}
+
+	template <class Ty, std::size_t... Is> void dispatchField(Ty& value, size_type index, std::index_sequence<Is...>) {
+		(void)((index == Is && (read(value.*std::get<Is>(jsonBindingFields<Ty>).member), true)) || ...);
+	}
+
+	StringView readKey() {
+		auto begin = ++m_begin;
+
+		for (; m_begin != m_end; ++m_begin) {
+			if (*m_begin == '\"') return StringView(begin, m_begin++);
+			else if (*m_begin == '\\') break;
+		}
+
+		m_keyBuffer.clear();
+		m_begin = begin - 1;
+		readString(m_keyBuffer);
+
+		return StringView(m_keyBuffer.data(), m_keyBuffer.size());
+	}
+
+	template <class Str> void readString(Str& string) {
+		auto run = ++m_begin;
+
+		for (; m_begin != m_end; ++m_begin) {
+			auto c = *m_begin;
+
+			if (c == '\"') {
+				string.append(run, m_begin - run);
+				++m_begin;
+
+				return;
+			} else if (c == '\\') {
+				string.append(run, m_begin - run);
+				if (++m_begin == m_end) break;
+
+				switch (*m_begin) {
+					case 'b': appendChar(string, '\b'); break;
+					case 't': appendChar(string, '\t'); break;
+					case 'n': appendChar(string, '\n'); break;
+					case 'f': appendChar(string, '\f'); break;
+					case 'r': appendChar(string, '\r'); break;
+					case '\"': case '\\': case '/': appendChar(string, *m_begin); break;
+					case 'u': readUnicodeEscape(string); break;
+					default: LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Invalid escape sequence!"));
+				}
+
+				run = m_begin + 1;
+			} else if (static_cast<unsigned char>(c) < 0x20) {
+				LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unescaped control character in string!"));
+			}
+		}
+
+		LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Missing symbol, string not terminated!"));
+	}
+	template <class Str> static void appendChar(Str& string, char c) {
+		string.append(&c, 1);
+	}
+
+	char32_t readHex4() {
+		if (m_end - m_begin < 5) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Incomplete unicode escape sequence!"));
+
+		char32_t r = 0;
+		for (int i = 0; i < 4; i++) {
+			auto c = *++m_begin;
+			r <<= 4;
+
+			if (c >= '0' && c <= '9') r |= c - '0';
+			else if (c >= 'a' && c <= 'f') r |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') r |= c - 'A' + 10;
+			else LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Invalid hexadecimal digit in unicode escape sequence!"));
+		}
+
+		return r;
+	}
+	template <class Str> void readUnicodeEscape(Str& string) {
+		char32_t code = readHex4();
+
+		if (code >= 0xD800 && code <= 0xDBFF) {
+			if (m_end - m_begin < 7 || m_begin[1] != '\\' || m_begin[2] != 'u')
+				LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+			m_begin += 2;
+			char32_t low = readHex4();
+			if (low < 0xDC00 || low > 0xDFFF)
+				LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+			code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+		} else if (code >= 0xDC00 && code <= 0xDFFF)
+			LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+		char buffer[4];
+		size_type size;
+
+		if (code < 0x80) {
+			buffer[0] = static_cast<char>(code);
+			size = 1;
+		} else if (code < 0x800) {
+			buffer[0] = static_cast<char>(0xC0 | (code >> 6));
+			buffer[1] = static_cast<char>(0x80 | (code & 0x3F));
+			size = 2;
+		} else if (code < 0x10000) {
+			buffer[0] = static_cast<char>(0xE0 | (code >> 12));
+			buffer[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			buffer[2] = static_cast<char>(0x80 | (code & 0x3F));
+			size = 3;
+		} else {
+			buffer[0] = static_cast<char>(0xF0 | (code >> 18));
+			buffer[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+			buffer[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			buffer[3] = static_cast<char>(0x80 | (code & 0x3F));
+			size = 4;
+		}
+
+		string.append(buffer, size);
+	}
+
+	void skipValue() {
+		if (m_begin == m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected end of the document, expected a value!"));
+
+		switch (*m_begin) {
+			case '{':
+			case '[': {
+				auto close = (*m_begin == '{') ? '}' : ']';
+
+				if (++m_depth > maxDepth) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Document exceeds the maximum nesting depth!"));
+
+				++m_begin;
+				skipWhitespace();
+
+				if (m_begin != m_end && *m_begin == close) {
+					++m_begin;
+					--m_depth;
+					return;
+				}
+
+				while (true) {
+					skipWhitespace();
+
+					if (close == '}') {
+						if (m_begin == m_end || *m_begin != '\"') LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected quotation marks!"));
+						skipString();
+
+						expect(':', "lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected colon after member name!");
+						skipWhitespace();
+					}
+
+					skipValue();
+
+					skipWhitespace();
+					if (m_begin == m_end) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Missing symbol, expected closing bracket!"));
+					else if (*m_begin == ',') ++m_begin;
+					else if (*m_begin == close) {
+						++m_begin;
+						break;
+					} else LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, expected comma or closing bracket!"));
+				}
+
+				--m_depth;
+				break;
+			}
+
+			case '\"':
+				skipString();
+				break;
+
+			case 't':
+				if (!consumeLiteral("true", 4)) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+				break;
+
+			case 'f':
+				if (!consumeLiteral("false", 5)) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+				break;
+
+			case 'n':
+				if (!consumeLiteral("null", 4)) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+				break;
+
+			default: {
+				auto token = scanJsonNumber(m_begin, m_end);
+				if (!token.valid) LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Invalid number!"));
+
+				m_begin = token.end;
+			}
+		}
+	}
+	void skipString() {
+		for (++m_begin; m_begin != m_end; ++m_begin) {
+			if (*m_begin == '\"') {
+				++m_begin;
+				return;
+			} else if (*m_begin == '\\') {
+				if (++m_begin == m_end) break;
+			} else if (static_cast<unsigned char>(*m_begin) < 0x20) {
+				LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Unescaped control character in string!"));
+			}
+		}
+
+		LSD_THROW(JsonParseError("lsd::fromJson(): JSON Syntax Error: Missing symbol, string not terminated!"));
+	}
+};
+
+
+/**
+ * @brief Writes bound structs as compact JSON text
+ */
+template <class Str> class JsonBindingWriter {
+public:
+	constexpr JsonBindingWriter(Str& out) noexcept : m_out(out) { }
+
+	template <class Ty> void write(const Ty& value) {
+		if constexpr (IsOptional<Ty>::value) {
+			if (value) write(*value);
+			else m_out.append("null", 4);
+		} else if constexpr (std::same_as<Ty, bool>) {
+			if (value) m_out.append("true", 4);
+			else m_out.append("false", 5);
+		} else if constexpr (std::is_arithmetic_v<Ty>) {
+			writeNumber(value);
+		} else if constexpr (JsonBindingString<Ty> || std::convertible_to<const Ty&, StringView>) {
+			writeString(StringView(value.data(), value.size()));
+		} else if constexpr (JsonBound<Ty>) {
+			writeObject(value, std::make_index_sequence<jsonBindingFieldCount<Ty>>());
+		} else if constexpr (JsonBindingSequence<Ty>) {
+			m_out.append("[", 1);
+
+			bool first = true;
+			for (const auto& element : value) {
+				if (!first) m_out.append(",", 1);
+				first = false;
+
+				write(element);
+			}
+
+			m_out.append("]", 1);
+		} else static_assert(sizeof(Ty) == 0, "lsd::toJson(): Member type can not be bound to JSON!");
+	}
+
+private:
+	Str& m_out;
+
+	template <class Ty, std::size_t... Is> void writeObject(const Ty& value, std::index_sequence<Is...>) {
+		m_out.append("{", 1);
+		(writeField<Is>(value, std::get<Is>(jsonBindingFields<Ty>)), ...);
+		m_out.append("}", 1);
+	}
+	template <std::size_t I, class Ty, class Field> void writeField(const Ty& value, const Field& field) {
+		if constexpr (I != 0) m_out.append(",", 1);
+
+		writeString(field.name);
+		m_out.append(":", 1);
+		write(value.*field.member);
+	}
+
+	template <class Ty> void writeNumber(Ty value) {
+		if constexpr (std::is_floating_point_v<Ty>) {
+			if (!std::isfinite(value)) {
+				m_out.append("null", 4);
+				return;
+			}
+		}
+
+		char buffer[64];
+		auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		m_out.append(buffer, res.ptr - buffer);
+	}
+
+	void writeString(StringView string) {
+		appendJsonString(m_out, string.data(), string.size());
+	}
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Parse JSON text directly into a bound struct
+ *
+ * @details Keys are dispatched with a perfect hash generated from the binding at compile time, unknown keys are skipped and missing keys leave their members untouched.
+ *
+ * @param text JSON text
+ * @param value struct to parse into
+ */
+template <JsonBound Ty> void fromJson(StringView text, Ty& value) {
+	detail::JsonBindingReader(text.data(), text.data() + text.size()).parseDocument(value);
+}
+template <JsonBound Ty> [[nodiscard]] Ty fromJson(StringView text) {
+	Ty value { };
+	fromJson(text, value);
+	return value;
+}
+
+/**
+ * @brief Append a bound struct as compact JSON text to a string
+ *
+ * @param value struct to write
+ * @param out string to append to
+ */
+template <JsonBound Ty, class Str> void toJson(const Ty& value, Str& out) {
+	detail::JsonBindingWriter<Str>(out).write(value);
+}
+template <JsonBound Ty> [[nodiscard]] String toJson(const Ty& value) {
+	String r;
+	toJson(value, r);
+	return r;
+}
+
+} // namespace lsd
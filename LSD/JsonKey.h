@@ -0,0 +1,34 @@
+/**************************
+ * @file JsonKey.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Interned keys for JSON objects
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "InternedString.h"
+
+namespace lsd {
+
+/**
+ * @brief Handle to a key interned in a BasicJsonKeyPool
+ *
+ * @details JSON keys are ordinary interned strings, so they share their pool with every other interned string by default.
+ * BasicJsonKeyPool::Scope can give each document a pool of its own.
+ *
+ * @tparam Literal character type
+ */
+template <class Literal> using BasicJsonKey = BasicInternedString<Literal>;
+template <class Literal> using BasicJsonKeyPool = BasicStringInternPool<Literal>;
+
+using JsonKey = BasicJsonKey<char>;
+using WJsonKey = BasicJsonKey<wchar_t>;
+using JsonKeyPool = BasicJsonKeyPool<char>;
+using WJsonKeyPool = BasicJsonKeyPool<wchar_t>;
+
+} // namespace lsd
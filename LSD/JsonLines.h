@@ -0,0 +1,333 @@
+/**************************
+ * @file JsonLines.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief A parallel parser for newline delimited JSON (JSON Lines/NDJSON)
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "StringView.h"
+#include "JSON.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+namespace lsd {
+
+enum class JsonLinesOrder {
+	ordered,
+	unordered
+};
+
+namespace detail {
+
+template <class Literal> struct JsonLinesChunk {
+	const Literal* begin;
+	const Literal* end;
+};
+
+template <class Literal> constexpr bool jsonLinesIsBlank(const Literal* begin, const Literal* end) noexcept {
+	for (; begin != end; begin++) {
+		switch (*begin) {
+			case ' ': case '\f': case '\r': case '\t': case '\v': case '\0':
+				continue;
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+// split the buffer into chunks of roughly chunkSize literals, each ending directly behind a record separator
+template <class Literal> Vector<JsonLinesChunk<Literal>> jsonLinesSplit(const Literal* begin, const Literal* end, std::size_t chunkSize) {
+	Vector<JsonLinesChunk<Literal>> chunks;
+	chunks.reserve(static_cast<std::size_t>(end - begin) / chunkSize + 1);
+
+	while (begin != end) {
+		auto split = (static_cast<std::size_t>(end - begin) > chunkSize) ? begin + chunkSize : end;
+		split = std::find(split, end, static_cast<Literal>('\n'));
+		if (split != end) ++split;
+
+		chunks.pushBack({ begin, split });
+		begin = split;
+	}
+
+	return chunks;
+}
+
+// interned keys are created in the pool active on the calling thread, which is thread local and therefore has to be activated on every worker as well
+
+template <class Key> struct JsonLinesPoolScope {
+	static constexpr std::nullptr_t activePool() noexcept {
+		return nullptr;
+	}
+
+	constexpr explicit JsonLinesPoolScope(std::nullptr_t) noexcept { }
+};
+template <class Key> requires requires { typename Key::pool_type::Scope; } struct JsonLinesPoolScope<Key> {
+	using pool_type = typename Key::pool_type;
+
+	static pool_type* activePool() {
+		return &pool_type::current();
+	}
+
+	typename pool_type::Scope scope;
+
+	explicit JsonLinesPoolScope(pool_type* pool) noexcept : scope(*pool) { }
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Parses a buffer of newline delimited JSON documents on a pool of worker threads without throwing on malformed records
+ *
+ * @details The buffer is split at record boundaries into chunks, which are parsed independently of each other.
+ * The callback is either invoked with the parsed document alone or with the offset of the record in the buffer and the document.
+ * In ordered mode, the documents are delivered in the order they appear in the buffer on the calling thread.
+ * In unordered mode, they are delivered as soon as they are parsed from the worker threads, but never concurrently.
+ * Blank lines are skipped. Parsing stops at the first malformed record: every record in front of it is still delivered and its error is returned with the offset and line counted from the beginning of the buffer.
+ * In unordered mode, records behind the malformed one may have been delivered already.
+ * If exceptions are enabled, an exception thrown by the callback stops all workers as well and is rethrown on the calling thread.
+ * Interned keys are created in the pool active on the calling thread, see BasicStringInternPool::Scope.
+ *
+ * @tparam JsonType json type to parse the records into
+ * @tparam Callback callback type
+ *
+ * @param buffer buffer containing the records, for example a mapped file
+ * @param callback callback invoked for every parsed record
+ * @param order order in which the records are delivered
+ * @param threadCount number of worker threads, 0 to use the hardware concurrency
+ *
+ * @return Nothing or the first parse error
+ */
+template <class JsonType = Json, class Callback> [[nodiscard]] JsonParseResult<void> tryParseJsonLines(
+	BasicStringView<typename JsonType::literal_type> buffer,
+	Callback&& callback,
+	JsonLinesOrder order = JsonLinesOrder::ordered,
+	std::size_t threadCount = 0
+) {
+	using literal_type = typename JsonType::literal_type;
+	using chunk_type = detail::JsonLinesChunk<literal_type>;
+	using pool_scope = detail::JsonLinesPoolScope<typename JsonType::key_type>;
+
+	struct Record {
+		std::size_t offset;
+		JsonType json;
+	};
+
+	static constexpr std::size_t minChunkSize = 1 << 16;
+
+	if (buffer.empty()) return { };
+
+	if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	const literal_type* const bufferBegin = buffer.data();
+	const literal_type* const bufferEnd = bufferBegin + buffer.size();
+
+	auto chunks = detail::jsonLinesSplit(bufferBegin, bufferEnd, std::max(buffer.size() / (threadCount * 4), minChunkSize));
+	threadCount = std::min(threadCount, chunks.size());
+
+	auto deliver = [&callback](Record& record) {
+		if constexpr (std::is_invocable_v<Callback, std::size_t, JsonType&&>) callback(record.offset, std::move(record.json));
+		else callback(std::move(record.json));
+	};
+
+	auto pool = pool_scope::activePool();
+
+	std::atomic<std::size_t> nextChunk = 0;
+	std::atomic<std::size_t> failedChunk = chunks.size(); // chunks behind the first failed one are not parsed anymore, the ones in front of it may still hold an earlier error
+	std::atomic<bool> stop = false;
+	JsonError error;
+#if LSD_EXCEPTIONS
+	std::exception_ptr exception;
+#endif
+
+	std::mutex mutex;
+	std::condition_variable workerCondition;
+	std::condition_variable consumerCondition;
+
+	auto stopAll = [&]() { // expects the mutex to be locked
+		stop = true;
+		workerCondition.notify_all();
+		consumerCondition.notify_all();
+	};
+	auto fail = [&](std::size_t index, const literal_type* recordBegin, JsonError recordError) {
+		// the position of the error inside the record is converted to a position inside the buffer
+		recordError.offset += static_cast<std::size_t>(recordBegin - bufferBegin);
+		recordError.line += static_cast<std::size_t>(std::count(bufferBegin, recordBegin, static_cast<literal_type>('\n')));
+
+		std::lock_guard lock(mutex);
+		if (index < failedChunk) { // a chunk only fails at its first malformed record, so the lowest failed chunk holds the lowest offset
+			failedChunk = index;
+			error = recordError;
+		}
+
+		workerCondition.notify_all();
+		consumerCondition.notify_all();
+	};
+	auto guard = [&](auto&& body) { // stops all workers if the callback throws
+#if LSD_EXCEPTIONS
+		try {
+			body();
+		} catch (...) {
+			std::lock_guard lock(mutex);
+			if (!exception) exception = std::current_exception();
+			stopAll();
+		}
+#else
+		body();
+#endif
+	};
+
+	// parses the records of a chunk up to its first malformed record
+	auto parseChunk = [&](std::size_t index, Vector<Record>& records) {
+		const chunk_type& chunk = chunks[index];
+
+		for (auto lineBegin = chunk.begin; lineBegin != chunk.end; ) {
+			auto lineEnd = std::find(lineBegin, chunk.end, static_cast<literal_type>('\n'));
+
+			if (!detail::jsonLinesIsBlank(lineBegin, lineEnd)) {
+				auto result = JsonType::tryParse(lineBegin, lineEnd);
+				if (!result) {
+					fail(index, lineBegin, result.error());
+					return false;
+				}
+
+				records.pushBack({ static_cast<std::size_t>(lineBegin - bufferBegin), std::move(*result) });
+			}
+
+			lineBegin = (lineEnd == chunk.end) ? lineEnd : lineEnd + 1;
+		}
+
+		return true;
+	};
+
+	// parsed chunks waiting for delivery in ordered mode, these outlive the workers since a stopped consumer does not wait for them
+	Vector<Vector<Record>> results;
+	Vector<char> ready;
+	std::size_t delivered = 0;
+
+	Vector<std::thread> workers;
+	workers.reserve(threadCount);
+
+	if (order == JsonLinesOrder::unordered) {
+		for (std::size_t i = 0; i < threadCount; i++) {
+			workers.emplaceBack([&]() {
+				pool_scope scope(pool);
+
+				guard([&]() {
+					for (auto index = nextChunk++; index < failedChunk && !stop; index = nextChunk++) {
+						Vector<Record> records;
+						auto parsed = parseChunk(index, records);
+
+						{
+							std::lock_guard lock(mutex);
+							for (auto& record : records) deliver(record);
+						}
+
+						if (!parsed) return;
+					}
+				});
+			});
+		}
+	} else {
+		// the window bounds how far the workers may run ahead of the consumer
+		const std::size_t window = threadCount * 2;
+
+		results.resize(chunks.size());
+		ready.resize(chunks.size(), 0);
+
+		for (std::size_t i = 0; i < threadCount; i++) {
+			workers.emplaceBack([&]() {
+				pool_scope scope(pool);
+
+				guard([&]() {
+					for (auto index = nextChunk++; index < chunks.size(); index = nextChunk++) {
+						{
+							std::unique_lock lock(mutex);
+							workerCondition.wait(lock, [&]() { return stop || index > failedChunk || index < delivered + window; });
+							if (stop || index > failedChunk) return;
+						}
+
+						// the records in front of a malformed one are handed to the consumer as well
+						Vector<Record> records;
+						auto parsed = parseChunk(index, records);
+
+						std::lock_guard lock(mutex);
+						results[index] = std::move(records);
+						ready[index] = 1;
+						consumerCondition.notify_one();
+
+						if (!parsed) return;
+					}
+				});
+			});
+		}
+
+		guard([&]() {
+			while (delivered < chunks.size() && delivered <= failedChunk) {
+				Vector<Record> records;
+
+				{
+					std::unique_lock lock(mutex);
+					consumerCondition.wait(lock, [&]() { return stop || ready[delivered]; });
+					if (stop) break;
+
+					records = std::move(results[delivered]);
+				}
+
+				for (auto& record : records) deliver(record);
+
+				std::lock_guard lock(mutex);
+				++delivered;
+				workerCondition.notify_all();
+			}
+		});
+	}
+
+	for (auto& worker : workers) worker.join();
+
+#if LSD_EXCEPTIONS
+	if (exception) std::rethrow_exception(exception);
+#endif
+
+	if (error) return std::unexpected(error);
+	return { };
+}
+
+/**
+ * @brief Parses a buffer of newline delimited JSON documents on a pool of worker threads
+ *
+ * @details Behaves like tryParseJsonLines(), but throws a JsonParseError for the first malformed record.
+ *
+ * @tparam JsonType json type to parse the records into
+ * @tparam Callback callback type
+ *
+ * @param buffer buffer containing the records, for example a mapped file
+ * @param callback callback invoked for every parsed record
+ * @param order order in which the records are delivered
+ * @param threadCount number of worker threads, 0 to use the hardware concurrency
+ */
+template <class JsonType = Json, class Callback> void parseJsonLines(
+	BasicStringView<typename JsonType::literal_type> buffer,
+	Callback&& callback,
+	JsonLinesOrder order = JsonLinesOrder::ordered,
+	std::size_t threadCount = 0
+) {
+	auto result = tryParseJsonLines<JsonType>(buffer, std::forward<Callback>(callback), order, threadCount);
+	if (!result) LSD_THROW(JsonParseError(result.error()));
+}
+
+} // namespace lsd
@@ -0,0 +1,182 @@
+/**************************
+ * @file JsonPath.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief A precompiled path into a JSON document
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Array.h"
+#include "StringView.h"
+#include "Hash.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace lsd {
+
+/**
+ * @brief A path into a JSON document, split into prehashed segments on construction
+ *
+ * @details Accepts both the "::" separated syntax of BasicJson::child() and RFC 6901 JSON pointers, which are recognized by their leading slash.
+ * Segments consisting only of digits (without leading zeros) are additionally parsed into an array index.
+ * All storage is inline, so paths constructed from literals can be evaluated at compile time.
+ *
+ * @tparam CharTy character type
+ * @tparam Capacity maximum number of characters in the path, including the null terminator of literals
+ * @tparam SegmentCapacity maximum number of segments, by default enough for every path whose segments are not empty
+ */
+template <class CharTy, std::size_t Capacity, std::size_t SegmentCapacity = (Capacity + 1) / 2> class BasicJsonPath {
+public:
+	static_assert(Capacity > 0, "lsd::BasicJsonPath: Capacity of a path must be at least 1!");
+	static_assert(SegmentCapacity > 0, "lsd::BasicJsonPath: Segment capacity of a path must be at least 1!");
+
+	using size_type = std::size_t;
+	using value_type = CharTy;
+	using view_type = BasicStringView<value_type>;
+
+	static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+	class Segment {
+	public:
+		[[nodiscard]] constexpr size_type hash() const noexcept {
+			return m_hash;
+		}
+		[[nodiscard]] constexpr size_type index() const noexcept {
+			return m_index;
+		}
+		[[nodiscard]] constexpr bool isIndex() const noexcept {
+			return m_index != npos;
+		}
+
+	private:
+		size_type m_begin = 0;
+		size_type m_size = 0;
+		size_type m_hash = 0;
+		size_type m_index = npos;
+
+		friend class BasicJsonPath;
+	};
+
+	using segment_type = Segment;
+	using const_iterator = const segment_type*;
+
+	constexpr BasicJsonPath() noexcept = default;
+	constexpr BasicJsonPath(const value_type (&path)[Capacity]) : BasicJsonPath(view_type(path, (path[Capacity - 1] == '\0') ? Capacity - 1 : Capacity)) { }
+	explicit constexpr BasicJsonPath(view_type path) {
+		if (path.size() > Capacity) LSD_THROW(std::out_of_range("lsd::BasicJsonPath::BasicJsonPath(): Path exceeds the capacity of the path object!"));
+
+		if (path.empty()) return;
+		else if (path.front() == '/') compilePointer(path);
+		else compileScoped(path);
+	}
+
+	[[nodiscard]] constexpr const_iterator begin() const noexcept {
+		return m_segments.data();
+	}
+	[[nodiscard]] constexpr const_iterator end() const noexcept {
+		return m_segments.data() + m_segmentCount;
+	}
+
+	[[nodiscard]] constexpr size_type size() const noexcept {
+		return m_segmentCount;
+	}
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return m_segmentCount == 0;
+	}
+
+	[[nodiscard]] constexpr const segment_type& operator[](size_type index) const noexcept {
+		return m_segments[index];
+	}
+
+	[[nodiscard]] constexpr view_type key(const segment_type& segment) const noexcept {
+		return view_type(m_chars.data() + segment.m_begin, segment.m_size);
+	}
+
+private:
+	Array<value_type, Capacity> m_chars { };
+	Array<segment_type, SegmentCapacity> m_segments { };
+	size_type m_charCount = 0;
+	size_type m_segmentCount = 0;
+
+	constexpr void compileScoped(view_type path) {
+		size_type beg = 0;
+
+		for (size_type cur = 0; cur + 1 < path.size(); cur++) {
+			if (path[cur] == ':' && path[cur + 1] == ':') {
+				pushSegment(path.substr(beg, cur - beg));
+				beg = ++cur + 1;
+			}
+		}
+
+		pushSegment(path.substr(beg));
+	}
+	constexpr void compilePointer(view_type path) {
+		for (size_type i = 1; i <= path.size(); i++) {
+			auto& segment = nextSegment();
+			segment.m_begin = m_charCount;
+
+			for (; i < path.size() && path[i] != '/'; i++) {
+				if (path[i] == '~') {
+					if (++i == path.size() || (path[i] != '0' && path[i] != '1'))
+						LSD_THROW(std::invalid_argument("lsd::BasicJsonPath::compilePointer(): Invalid escape sequence in JSON pointer!"));
+
+					m_chars[m_charCount++] = (path[i] == '0') ? '~' : '/';
+				} else m_chars[m_charCount++] = path[i];
+			}
+
+			finishSegment(segment);
+		}
+	}
+
+	constexpr void pushSegment(view_type key) {
+		auto& segment = nextSegment();
+		segment.m_begin = m_charCount;
+
+		for (auto c : key) m_chars[m_charCount++] = c;
+
+		finishSegment(segment);
+	}
+	constexpr segment_type& nextSegment() {
+		if (m_segmentCount == SegmentCapacity) LSD_THROW(std::out_of_range("lsd::BasicJsonPath::nextSegment(): Path exceeds the segment capacity of the path object!"));
+		return m_segments[m_segmentCount++];
+	}
+	constexpr void finishSegment(segment_type& segment) noexcept {
+		segment.m_size = m_charCount - segment.m_begin;
+
+		auto k = key(segment);
+		segment.m_hash = Hash<view_type>{}(k);
+
+		if (k.empty() || (k.size() > 1 && k.front() == '0')) return;
+
+		size_type index = 0;
+		for (auto c : k) {
+			if (c < '0' || c > '9' || index > (npos - 9) / 10) return;
+			index = index * 10 + static_cast<size_type>(c - '0');
+		}
+
+		segment.m_index = index;
+	}
+};
+
+template <class CharTy, std::size_t Capacity> BasicJsonPath(const CharTy (&)[Capacity]) -> BasicJsonPath<CharTy, Capacity>;
+
+template <std::size_t Capacity, std::size_t SegmentCapacity = (Capacity + 1) / 2> using JsonPath = BasicJsonPath<char, Capacity, SegmentCapacity>;
+template <std::size_t Capacity, std::size_t SegmentCapacity = (Capacity + 1) / 2> using WJsonPath = BasicJsonPath<wchar_t, Capacity, SegmentCapacity>;
+
+
+namespace detail {
+
+template <class> struct IsJsonPath : std::false_type { };
+template <class CharTy, std::size_t Capacity, std::size_t SegmentCapacity> struct IsJsonPath<BasicJsonPath<CharTy, Capacity, SegmentCapacity>> : std::true_type { };
+
+template <class Ty> concept JsonPathType = IsJsonPath<std::remove_cvref_t<Ty>>::value;
+
+} // namespace detail
+
+} // namespace lsd
@@ -0,0 +1,646 @@
+/**************************
+ * @file JsonTape.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief A compact, read only JSON document stored as a tape of tagged words
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "StringView.h"
+#include "FromChars.h"
+#include "JSON.h"
+#include "JsonPath.h"
+#include "Unicode.h"
+
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+namespace lsd {
+
+enum class JsonTapeType : std::uint8_t {
+	null = 'n',
+	trueValue = 't',
+	falseValue = 'f',
+	signedInteger = 'l',
+	unsignedInteger = 'u',
+	floating = 'd',
+	string = '"',
+	objectBegin = '{',
+	objectEnd = '}',
+	arrayBegin = '[',
+	arrayEnd = ']'
+};
+
+/**
+ * @brief JSON document stored as a contiguous tape of 64 bit words and a side buffer for strings
+ *
+ * @details Every word carries its type in the top 8 bits and a 56 bit payload.
+ * Literals take a single word, numbers and strings take two: the tag word and the raw value or the string length.
+ * The payload of a string word is the offset of its characters in the string buffer.
+ * The begin word of an object or array stores the index one past its end word in the lower 32 bits and the number of elements in the upper 24 bits,
+ * so whole subtrees can be skipped in constant time. Keys of objects are stored as strings directly in front of their values.
+ *
+ * @tparam Literal character type
+ */
+template <class Literal = char> class BasicJsonTape {
+public:
+	using size_type = std::size_t;
+	using word_type = std::uint64_t;
+	using literal_type = Literal;
+	using signed_type = std::int64_t;
+	using unsigned_type = std::uint64_t;
+	using floating_type = double;
+	using view_type = BasicStringView<literal_type>;
+	using tape_type = Vector<word_type>;
+	using string_buffer = Vector<literal_type>;
+
+	using container = BasicJsonTape;
+	using const_container_reference = const container&;
+	using container_rvreference = container&&;
+
+	static constexpr word_type payloadMask = (word_type(1) << 56) - 1;
+	static constexpr word_type indexMask = (word_type(1) << 32) - 1;
+	static constexpr word_type countMask = (word_type(1) << 24) - 1;
+
+	class Cursor;
+	class Iterator;
+	class Field;
+
+	constexpr BasicJsonTape() = default;
+
+	template <lsd::ContinuousIteratorType Iterator> [[nodiscard]] static BasicJsonTape parse(Iterator begin, Iterator end) {
+		BasicJsonTape tape;
+
+		const literal_type* first = &*begin;
+		const literal_type* last = first + (end - begin);
+
+		if (findInvalidUnicode(first, static_cast<size_type>(last - first)) != static_cast<size_type>(last - first))
+			LSD_THROW(JsonParseError("lsd::JsonTape::parse(): JSON Syntax Error: Document contains an invalid unicode sequence!"));
+
+		tape.m_tape.reserve(static_cast<size_type>(last - first) / 4 + 2);
+
+		skipWhitespace(first, last);
+		if (first == last) {
+			tape.m_tape.pushBack(makeWord(JsonTapeType::objectBegin, 2));
+			tape.m_tape.pushBack(makeWord(JsonTapeType::objectEnd, 0));
+
+			return tape;
+		}
+
+		tape.parseValue(first, last, 0);
+
+		skipWhitespace(first, last);
+		if (first != last) LSD_THROW(JsonParseError("lsd::JsonTape::parse(): JSON Syntax Error: Unexpected symbol after the end of the document!"));
+
+		return tape;
+	}
+	template <lsd::IteratableContainer Container> [[nodiscard]] static BasicJsonTape parse(const Container& container) {
+		return parse(std::begin(container), std::end(container));
+	}
+	[[nodiscard]] static BasicJsonTape parse(view_type string) {
+		return parse(string.data(), string.data() + string.size());
+	}
+	[[nodiscard]] static BasicJsonTape parse(const literal_type* string) {
+		return parse(view_type(string));
+	}
+
+	[[nodiscard]] constexpr Cursor root() const noexcept {
+		return Cursor(this, 0);
+	}
+
+	[[nodiscard]] constexpr const tape_type& tape() const noexcept {
+		return m_tape;
+	}
+	[[nodiscard]] constexpr const string_buffer& strings() const noexcept {
+		return m_strings;
+	}
+	/**
+	 * @brief Calculate the memory used by the document
+	 *
+	 * @return Number of bytes allocated for the tape and the string buffer
+	 */
+	[[nodiscard]] constexpr size_type memoryUsage() const noexcept {
+		return m_tape.capacity() * sizeof(word_type) + m_strings.capacity() * sizeof(literal_type);
+	}
+
+	constexpr void shrinkToFit() {
+		m_tape.shrinkToFit();
+		m_strings.shrinkToFit();
+	}
+
+
+	/**
+	 * @brief Lightweight read only reference to a value on the tape
+	 */
+	class Cursor {
+	public:
+		constexpr Cursor() noexcept = default;
+
+		[[nodiscard]] constexpr JsonTapeType type() const noexcept {
+			return tagOf(word());
+		}
+
+		[[nodiscard]] constexpr bool isNull() const noexcept {
+			return type() == JsonTapeType::null;
+		}
+		[[nodiscard]] constexpr bool isBool() const noexcept {
+			return type() == JsonTapeType::trueValue || type() == JsonTapeType::falseValue;
+		}
+		[[nodiscard]] constexpr bool isSigned() const noexcept {
+			return type() == JsonTapeType::signedInteger;
+		}
+		[[nodiscard]] constexpr bool isUnsigned() const noexcept {
+			return type() == JsonTapeType::unsignedInteger;
+		}
+		[[nodiscard]] constexpr bool isFloating() const noexcept {
+			return type() == JsonTapeType::floating;
+		}
+		[[nodiscard]] constexpr bool isNumber() const noexcept {
+			return isSigned() || isUnsigned() || isFloating();
+		}
+		[[nodiscard]] constexpr bool isString() const noexcept {
+			return type() == JsonTapeType::string;
+		}
+		[[nodiscard]] constexpr bool isObject() const noexcept {
+			return type() == JsonTapeType::objectBegin;
+		}
+		[[nodiscard]] constexpr bool isArray() const noexcept {
+			return type() == JsonTapeType::arrayBegin;
+		}
+
+		[[nodiscard]] constexpr bool boolean() const {
+			if (!isBool()) LSD_THROW(std::runtime_error("lsd::JsonTape::Cursor::boolean(): Value is not a boolean!"));
+			return type() == JsonTapeType::trueValue;
+		}
+		[[nodiscard]] constexpr signed_type signedInteger() const {
+			if (isSigned()) return std::bit_cast<signed_type>(next());
+			else if (isUnsigned() && next() <= static_cast<word_type>(std::numeric_limits<signed_type>::max())) return static_cast<signed_type>(next());
+			LSD_THROW(std::runtime_error("lsd::JsonTape::Cursor::signedInteger(): Value is not representable as a signed integer!"));
+		}
+		[[nodiscard]] constexpr unsigned_type unsignedInteger() const {
+			if (isUnsigned()) return next();
+			else if (isSigned() && std::bit_cast<signed_type>(next()) >= 0) return next();
+			LSD_THROW(std::runtime_error("lsd::JsonTape::Cursor::unsignedInteger(): Value is not representable as an unsigned integer!"));
+		}
+		[[nodiscard]] constexpr floating_type floating() const {
+			switch (type()) {
+				case JsonTapeType::floating:
+					return std::bit_cast<floating_type>(next());
+				case JsonTapeType::signedInteger:
+					return static_cast<floating_type>(std::bit_cast<signed_type>(next()));
+				case JsonTapeType::unsignedInteger:
+					return static_cast<floating_type>(next());
+				default:
+					LSD_THROW(std::runtime_error("lsd::JsonTape::Cursor::floating(): Value is not a number!"));
+			}
+		}
+		[[nodiscard]] constexpr view_type string() const {
+			if (!isString()) LSD_THROW(std::runtime_error("lsd::JsonTape::Cursor::string(): Value is not a string!"));
+			return view_type(m_tape->m_strings.data() + (word() & payloadMask), static_cast<size_type>(next()));
+		}
+
+		/**
+		 * @brief Get the number of elements of an object or array
+		 *
+		 * @return Number of elements, saturated at 2^24 - 1, 0 for scalar values
+		 */
+		[[nodiscard]] constexpr size_type size() const noexcept {
+			return (isObject() || isArray()) ? static_cast<size_type>((word() >> 32) & countMask) : 0;
+		}
+		[[nodiscard]] constexpr bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		[[nodiscard]] constexpr Iterator begin() const noexcept {
+			return Iterator(m_tape, (isObject() || isArray()) ? m_index + 1 : m_index, isObject());
+		}
+		[[nodiscard]] constexpr Iterator end() const noexcept {
+			return Iterator(m_tape, (isObject() || isArray()) ? (word() & indexMask) - 1 : m_index, isObject());
+		}
+
+		/**
+		 * @brief Find a member of an object by linearly scanning its keys
+		 *
+		 * @param key key of the member
+		 *
+		 * @return Cursor to the member value, invalid cursor if not found
+		 */
+		[[nodiscard]] constexpr Cursor find(view_type key) const noexcept {
+			if (!isObject()) return Cursor();
+
+			for (auto field : *this)
+				if (field.key() == key) return field.value();
+
+			return Cursor();
+		}
+		[[nodiscard]] constexpr Cursor at(view_type key) const {
+			auto c = find(key);
+			if (!c) LSD_THROW(std::out_of_range("lsd::JsonTape::Cursor::at(): Specified key could not be found in object!"));
+			return c;
+		}
+		[[nodiscard]] constexpr Cursor at(size_type index) const {
+			if (!isArray() || index >= size()) LSD_THROW(std::out_of_range("lsd::JsonTape::Cursor::at(): Index exceded array bounds!"));
+
+			auto it = begin();
+			while (index-- > 0) ++it;
+			return *it;
+		}
+		[[nodiscard]] constexpr Cursor operator[](view_type key) const {
+			return at(key);
+		}
+		[[nodiscard]] constexpr Cursor operator[](size_type index) const {
+			return at(index);
+		}
+
+		template <std::size_t Capacity, std::size_t SegmentCapacity> [[nodiscard]] constexpr Cursor resolve(const BasicJsonPath<literal_type, Capacity, SegmentCapacity>& path) const noexcept {
+			Cursor c = *this;
+
+			for (const auto& segment : path) {
+				if (segment.isIndex() && c.isArray()) {
+					if (segment.index() >= c.size()) return Cursor();
+
+					auto it = c.begin();
+					for (auto i = segment.index(); i > 0; i--) ++it;
+					c = *it;
+				} else {
+					c = c.find(path.key(segment));
+					if (!c) return Cursor();
+				}
+			}
+
+			return c;
+		}
+
+		[[nodiscard]] constexpr size_type index() const noexcept {
+			return m_index;
+		}
+		[[nodiscard]] constexpr explicit operator bool() const noexcept {
+			return m_tape != nullptr;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const Cursor& first, const Cursor& second) noexcept {
+			return first.m_tape == second.m_tape && first.m_index == second.m_index;
+		}
+
+	private:
+		const BasicJsonTape* m_tape = nullptr;
+		size_type m_index = 0;
+
+		constexpr Cursor(const BasicJsonTape* tape, size_type index) noexcept : m_tape(tape), m_index(index) { }
+
+		constexpr word_type word() const noexcept {
+			return m_tape->m_tape[m_index];
+		}
+		constexpr word_type next() const noexcept {
+			return m_tape->m_tape[m_index + 1];
+		}
+
+		friend class BasicJsonTape;
+		friend class Iterator;
+		friend class Field;
+	};
+
+	/**
+	 * @brief Element of an array or member of an object, the key of array elements is empty
+	 */
+	class Field {
+	public:
+		[[nodiscard]] constexpr view_type key() const noexcept {
+			return m_object ? m_cursor.string() : view_type();
+		}
+		[[nodiscard]] constexpr Cursor value() const noexcept {
+			return m_object ? Cursor(m_cursor.m_tape, m_cursor.m_index + 2) : m_cursor;
+		}
+
+		[[nodiscard]] constexpr operator Cursor() const noexcept {
+			return value();
+		}
+
+	private:
+		Cursor m_cursor;
+		bool m_object;
+
+		constexpr Field(Cursor cursor, bool object) noexcept : m_cursor(cursor), m_object(object) { }
+
+		friend class Iterator;
+	};
+
+	/**
+	 * @brief Forward iterator over the elements of an array or the fields of an object
+	 */
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr Iterator() noexcept = default;
+
+		[[nodiscard]] constexpr Field operator*() const noexcept {
+			return Field(Cursor(m_tape, m_index), m_object);
+		}
+
+		constexpr Iterator& operator++() noexcept {
+			if (m_object) m_index += 2;
+			m_index = skip(m_index);
+			return *this;
+		}
+		constexpr Iterator operator++(int) noexcept {
+			auto t = *this;
+			++(*this);
+			return t;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const Iterator& first, const Iterator& second) noexcept {
+			return first.m_index == second.m_index;
+		}
+
+	private:
+		const BasicJsonTape* m_tape = nullptr;
+		size_type m_index = 0;
+		bool m_object = false;
+
+		constexpr Iterator(const BasicJsonTape* tape, size_type index, bool object) noexcept : m_tape(tape), m_index(index), m_object(object) { }
+
+		constexpr size_type skip(size_type index) const noexcept {
+			auto word = m_tape->m_tape[index];
+
+			switch (tagOf(word)) {
+				case JsonTapeType::objectBegin:
+				case JsonTapeType::arrayBegin:
+					return static_cast<size_type>(word & indexMask);
+				case JsonTapeType::signedInteger:
+				case JsonTapeType::unsignedInteger:
+				case JsonTapeType::floating:
+				case JsonTapeType::string:
+					return index + 2;
+				default:
+					return index + 1;
+			}
+		}
+
+		friend class Cursor;
+	};
+
+private:
+	tape_type m_tape;
+	string_buffer m_strings;
+
+	static constexpr word_type makeWord(JsonTapeType type, word_type payload) noexcept {
+		return (static_cast<word_type>(type) << 56) | (payload & payloadMask);
+	}
+	static constexpr JsonTapeType tagOf(word_type word) noexcept {
+		return static_cast<JsonTapeType>(word >> 56);
+	}
+
+
+	// parsing functions
+
+	static constexpr void skipWhitespace(const literal_type*& begin, const literal_type* end) noexcept {
+		while (begin != end && (*begin == ' ' || *begin == '\n' || *begin == '\r' || *begin == '\t'))
+			++begin;
+	}
+
+	void parseValue(const literal_type*& begin, const literal_type* end, size_type depth) {
+		static constexpr size_type maxDepth = 1024;
+
+		switch (*begin) {
+			case '{':
+				if (depth >= maxDepth) LSD_THROW(JsonParseError("lsd::JsonTape::parseValue(): JSON Syntax Error: Document exceeds the maximum nesting depth!"));
+				parseContainer(begin, end, depth, JsonTapeType::objectBegin, JsonTapeType::objectEnd, '}');
+				break;
+
+			case '[':
+				if (depth >= maxDepth) LSD_THROW(JsonParseError("lsd::JsonTape::parseValue(): JSON Syntax Error: Document exceeds the maximum nesting depth!"));
+				parseContainer(begin, end, depth, JsonTapeType::arrayBegin, JsonTapeType::arrayEnd, ']');
+				break;
+
+			case '\"':
+				parseString(begin, end);
+				break;
+
+			case 't':
+				parseLiteral(begin, end, "true", JsonTapeType::trueValue);
+				break;
+
+			case 'f':
+				parseLiteral(begin, end, "false", JsonTapeType::falseValue);
+				break;
+
+			case 'n':
+				parseLiteral(begin, end, "null", JsonTapeType::null);
+				break;
+
+			default:
+				parseNumber(begin, end);
+		}
+	}
+
+	void parseContainer(const literal_type*& begin, const literal_type* end, size_type depth, JsonTapeType open, JsonTapeType close, literal_type closeSymbol) {
+		auto start = m_tape.size();
+		m_tape.pushBack(0);
+
+		word_type count = 0;
+		bool closed = false;
+
+		++begin;
+		skipWhitespace(begin, end);
+
+		if (begin != end && *begin == closeSymbol) {
+			++begin;
+			closed = true;
+		}
+
+		while (!closed && begin != end) {
+			if (open == JsonTapeType::objectBegin) {
+				if (*begin != '\"') LSD_THROW(JsonParseError("lsd::JsonTape::parseContainer(): JSON Syntax Error: Unexpected symbol, expected quotation marks!"));
+				parseString(begin, end);
+
+				skipWhitespace(begin, end);
+				if (begin == end || *begin != ':') LSD_THROW(JsonParseError("lsd::JsonTape::parseContainer(): JSON Syntax Error: Unexpected symbol, expected colon after member name!"));
+
+				++begin;
+				skipWhitespace(begin, end);
+				if (begin == end) break;
+			}
+
+			parseValue(begin, end, depth + 1);
+			++count;
+
+			skipWhitespace(begin, end);
+			if (begin == end) break;
+			else if (*begin == ',') {
+				++begin;
+				skipWhitespace(begin, end);
+			} else if (*begin == closeSymbol) {
+				++begin;
+				closed = true;
+			} else LSD_THROW(JsonParseError("lsd::JsonTape::parseContainer(): JSON Syntax Error: Unexpected symbol, expected comma or closing bracket!"));
+		}
+
+		if (!closed) LSD_THROW(JsonParseError("lsd::JsonTape::parseContainer(): JSON Syntax Error: Missing symbol, expected closing bracket!"));
+
+		if (m_tape.size() + 1 > indexMask) LSD_THROW(JsonParseError("lsd::JsonTape::parseContainer(): Document exceeds the maximum size of the tape!"));
+
+		m_tape.pushBack(makeWord(close, start));
+		m_tape[start] = makeWord(open, (std::min(count, countMask) << 32) | m_tape.size());
+	}
+
+	void parseString(const literal_type*& begin, const literal_type* end) {
+		auto offset = m_strings.size();
+
+		for (++begin; begin != end; ++begin) {
+			auto c = *begin;
+
+			if (c == '\"') {
+				++begin;
+
+				m_tape.pushBack(makeWord(JsonTapeType::string, offset));
+				m_tape.pushBack(m_strings.size() - offset);
+
+				return;
+			} else if (c == '\\') {
+				if (++begin == end) break;
+
+				switch (*begin) {
+					case 'b': m_strings.pushBack('\b'); break;
+					case 't': m_strings.pushBack('\t'); break;
+					case 'n': m_strings.pushBack('\n'); break;
+					case 'f': m_strings.pushBack('\f'); break;
+					case 'r': m_strings.pushBack('\r'); break;
+					case '\"': case '\\': case '/': m_strings.pushBack(*begin); break;
+					case 'u': parseUnicodeEscape(begin, end); break;
+					default: LSD_THROW(JsonParseError("lsd::JsonTape::parseString(): JSON Syntax Error: Invalid escape sequence!"));
+				}
+			} else if (static_cast<std::make_unsigned_t<literal_type>>(c) < 0x20) {
+				LSD_THROW(JsonParseError("lsd::JsonTape::parseString(): JSON Syntax Error: Unescaped control character in string!"));
+			} else m_strings.pushBack(c);
+		}
+
+		LSD_THROW(JsonParseError("lsd::JsonTape::parseString(): JSON Syntax Error: Missing symbol, string not terminated!"));
+	}
+
+	static char32_t parseHex4(const literal_type*& begin, const literal_type* end) {
+		if (end - begin < 5) LSD_THROW(JsonParseError("lsd::JsonTape::parseHex4(): JSON Syntax Error: Incomplete unicode escape sequence!"));
+
+		char32_t r = 0;
+		for (int i = 0; i < 4; i++) {
+			auto c = *++begin;
+			r <<= 4;
+
+			if (c >= '0' && c <= '9') r |= c - '0';
+			else if (c >= 'a' && c <= 'f') r |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') r |= c - 'A' + 10;
+			else LSD_THROW(JsonParseError("lsd::JsonTape::parseHex4(): JSON Syntax Error: Invalid hexadecimal digit in unicode escape sequence!"));
+		}
+
+		return r;
+	}
+	void parseUnicodeEscape(const literal_type*& begin, const literal_type* end) {
+		char32_t code = parseHex4(begin, end);
+
+		if (code >= 0xD800 && code <= 0xDBFF) {
+			if (end - begin < 7 || begin[1] != '\\' || begin[2] != 'u')
+				LSD_THROW(JsonParseError("lsd::JsonTape::parseUnicodeEscape(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+			begin += 2;
+			char32_t low = parseHex4(begin, end);
+			if (low < 0xDC00 || low > 0xDFFF)
+				LSD_THROW(JsonParseError("lsd::JsonTape::parseUnicodeEscape(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+			code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+		} else if (code >= 0xDC00 && code <= 0xDFFF)
+			LSD_THROW(JsonParseError("lsd::JsonTape::parseUnicodeEscape(): JSON Syntax Error: Unpaired surrogate in unicode escape sequence!"));
+
+		if constexpr (sizeof(literal_type) == 1) {
+			if (code < 0x80) m_strings.pushBack(static_cast<literal_type>(code));
+			else if (code < 0x800) {
+				m_strings.pushBack(static_cast<literal_type>(0xC0 | (code >> 6)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+			} else if (code < 0x10000) {
+				m_strings.pushBack(static_cast<literal_type>(0xE0 | (code >> 12)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | ((code >> 6) & 0x3F)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+			} else {
+				m_strings.pushBack(static_cast<literal_type>(0xF0 | (code >> 18)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | ((code >> 12) & 0x3F)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | ((code >> 6) & 0x3F)));
+				m_strings.pushBack(static_cast<literal_type>(0x80 | (code & 0x3F)));
+			}
+		} else if constexpr (sizeof(literal_type) == 2) {
+			if (code < 0x10000) m_strings.pushBack(static_cast<literal_type>(code));
+			else {
+				m_strings.pushBack(static_cast<literal_type>(0xD800 + ((code - 0x10000) >> 10)));
+				m_strings.pushBack(static_cast<literal_type>(0xDC00 + ((code - 0x10000) & 0x3FF)));
+			}
+		} else m_strings.pushBack(static_cast<literal_type>(code));
+	}
+
+	void parseLiteral(const literal_type*& begin, const literal_type* end, const char* literal, JsonTapeType type) {
+		auto length = std::strlen(literal);
+
+		if (static_cast<size_type>(end - begin) < length) LSD_THROW(JsonParseError("lsd::JsonTape::parseLiteral(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+		for (size_type i = 0; i < length; i++)
+			if (begin[i] != literal[i]) LSD_THROW(JsonParseError("lsd::JsonTape::parseLiteral(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+
+		begin += length;
+		m_tape.pushBack(makeWord(type, 0));
+	}
+
+	void parseNumber(const literal_type*& begin, const literal_type* end) {
+		auto token = detail::scanJsonNumber(begin, end);
+
+		if (token.end == begin) LSD_THROW(JsonParseError("lsd::JsonTape::parseNumber(): JSON Syntax Error: Unexpected symbol, couldn't match identifier with any type!"));
+		else if (!token.valid) LSD_THROW(JsonParseError("lsd::JsonTape::parseNumber(): JSON Syntax Error: Invalid number!"));
+
+		auto numberEnd = token.end;
+		auto isFloat = token.isFloat;
+
+		if (!isFloat) {
+			if (*begin == '-') {
+				signed_type s { };
+				if (auto res = fromChars(begin, numberEnd, s); res.ec == std::errc { } && res.ptr == numberEnd) {
+					m_tape.pushBack(makeWord(JsonTapeType::signedInteger, 0));
+					m_tape.pushBack(std::bit_cast<word_type>(s));
+					begin = numberEnd;
+
+					return;
+				}
+			} else {
+				unsigned_type u { };
+				if (auto res = fromChars(begin, numberEnd, u); res.ec == std::errc { } && res.ptr == numberEnd) {
+					m_tape.pushBack(makeWord(JsonTapeType::unsignedInteger, 0));
+					m_tape.pushBack(u);
+					begin = numberEnd;
+
+					return;
+				}
+			}
+		}
+
+		// floating point values and integers which are out of range
+		floating_type f { };
+		if (auto res = fromChars(begin, numberEnd, f); res.ec == std::errc { } && res.ptr == numberEnd) {
+			m_tape.pushBack(makeWord(JsonTapeType::floating, 0));
+			m_tape.pushBack(std::bit_cast<word_type>(f));
+			begin = numberEnd;
+
+			return;
+		}
+
+		LSD_THROW(JsonParseError("lsd::JsonTape::parseNumber(): JSON Syntax Error: Invalid number!"));
+	}
+};
+
+using JsonTape = BasicJsonTape<>;
+using WJsonTape = BasicJsonTape<wchar_t>;
+
+} // namespace lsd
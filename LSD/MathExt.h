@@ -64,11 +64,71 @@ template <std::integral Type> inline constexpr std::size_t i64LenDec(Type x) {
 
 // prime number utility
 
+namespace detail {
+
+// modular arithmetic for the deterministic Miller-Rabin test, which is exact for every 64 bit number with the first twelve primes as bases
+
+inline constexpr std::uint64_t mulMod(std::uint64_t a, std::uint64_t b, std::uint64_t m) noexcept {
+#if defined(__SIZEOF_INT128__)
+	return static_cast<std::uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+#else
+	std::uint64_t result = 0;
+	a %= m;
+
+	for (; b != 0; b >>= 1) {
+		if (b & 1) result = (result >= m - a) ? result - (m - a) : result + a;
+		a = (a >= m - a) ? a - (m - a) : a + a;
+	}
+
+	return result;
+#endif
+}
+
+inline constexpr std::uint64_t powMod(std::uint64_t base, std::uint64_t exponent, std::uint64_t m) noexcept {
+	std::uint64_t result = 1;
+	base %= m;
+
+	for (; exponent != 0; exponent >>= 1) {
+		if (exponent & 1) result = mulMod(result, base, m);
+		base = mulMod(base, base, m);
+	}
+
+	return result;
+}
+
+inline constexpr bool millerRabin(std::uint64_t n) noexcept { // n has to be odd and larger than 37
+	auto d = n - 1;
+	unsigned s = 0;
+	for (; (d & 1) == 0; d >>= 1, s++)
+	;
+
+	constexpr std::uint64_t bases[] { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+
+	for (auto a : bases) {
+		auto x = powMod(a, d, n);
+		if (x == 1 || x == n - 1) continue;
+
+		bool composite = true;
+		for (unsigned r = 1; r < s && composite; r++) {
+			x = mulMod(x, x, n);
+			composite = (x != n - 1);
+		}
+
+		if (composite) return false;
+	}
+
+	return true;
+}
+
+} // namespace detail
+
 template <class Integer> inline constexpr bool isPrime(Integer n) noexcept requires std::is_integral_v<Integer> {
 	if (n == 2 || n == 3)
 		return true;
 	else if (n <= 1 || n % 2 == 0 || n % 3 == 0)
 		return false;
+	else if (sizeof(Integer) <= sizeof(std::uint64_t) && n > 65536)
+		return detail::millerRabin(static_cast<std::uint64_t>(n));
 	else for (Integer i = 5; i * i <= n; i += 6)
 		if (n % i == 0 || n % (i + 2) == 0)
 			return false;
@@ -100,6 +160,102 @@ template <class Integer> inline constexpr Integer lastPrime(Integer n) noexcept
 };
 
 
+// fast modulo by a runtime constant
+
+/**
+ * @brief Divisor with a precomputed reciprocal, which reduces numbers modulo the divisor with multiplications instead of a division
+ *
+ * @details Uses Lemire's fastmod with a 128 bit reciprocal, which is exact for every 64 bit number and divisor.
+ * Falls back to the modulo operator if the compiler has no 128 bit integers.
+ */
+class FastModulus {
+public:
+	constexpr FastModulus() noexcept = default;
+	/**
+	 * @brief Compute the reciprocal of a divisor, which must not be 0
+	 *
+	 * @param divisor divisor
+	 */
+	constexpr explicit FastModulus(std::uint64_t divisor) noexcept : 
+		m_divisor(divisor)
+#if defined(__SIZEOF_INT128__)
+		, m_magic((divisor == 0) ? 0 : ~static_cast<unsigned __int128>(0) / divisor + 1) // wraps to 0 for 1, which correctly reduces everything to 0
+#endif
+		{ }
+
+	[[nodiscard]] constexpr std::uint64_t divisor() const noexcept {
+		return m_divisor;
+	}
+	/**
+	 * @brief Calculate n modulo the divisor
+	 */
+	[[nodiscard]] constexpr std::uint64_t reduce(std::uint64_t n) const noexcept {
+#if defined(__SIZEOF_INT128__)
+		auto low = m_magic * n;
+		auto bottom = ((low & ~std::uint64_t { }) * m_divisor) >> 64;
+		auto top = (low >> 64) * m_divisor;
+
+		return static_cast<std::uint64_t>((bottom + top) >> 64);
+#else
+		return n % m_divisor;
+#endif
+	}
+
+private:
+	std::uint64_t m_divisor = 1;
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 m_magic = 0;
+#endif
+};
+
+namespace detail {
+
+// primes which roughly double with their reciprocals, used as bucket counts by the hash containers
+
+struct PrimeModulusTable {
+	FastModulus entries[64];
+	std::size_t size;
+};
+
+inline constexpr PrimeModulusTable primeModulusTable = []() {
+	constexpr std::uint64_t largestPrime = 18446744073709551557ULL; // largest prime below 2^64
+
+	PrimeModulusTable table { };
+	std::uint64_t prime = 2;
+
+	for (; prime < largestPrime; table.size++) {
+		table.entries[table.size] = FastModulus(prime);
+		prime = (prime >= largestPrime / 2) ? largestPrime : nextPrime(prime * 2);
+	}
+	table.entries[table.size++] = FastModulus(largestPrime);
+
+	return table;
+}();
+
+} // namespace detail
+
+/**
+ * @brief Get the smallest prime from the table of roughly doubling primes that is not smaller than n together with its reciprocal
+ *
+ * @param n lower bound of the prime
+ *
+ * @return The prime as a FastModulus, or the largest 64 bit prime if n is larger
+ */
+inline constexpr const FastModulus& tablePrimeAtLeast(std::uint64_t n) noexcept {
+	const auto& table = detail::primeModulusTable;
+
+	std::size_t first = 0, last = table.size - 1;
+	while (first < last) {
+		auto middle = first + (last - first) / 2;
+
+		if (table.entries[middle].divisor() < n) first = middle + 1;
+		else last = middle;
+	}
+
+	return table.entries[first];
+}
+
+
 // count digits of a number
 
 template <std::integral Type> inline constexpr std::size_t decNumLen(Type value) {
@@ -0,0 +1,458 @@
+/*************************
+ * @file MultiSearcher.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Searching a text for many patterns in a single pass
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "StringView.h"
+
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace lsd {
+
+/**
+ * @brief A single match of a MultiSearcher
+ */
+struct MultiSearchMatch {
+	static constexpr std::size_t npos = std::size_t(-1);
+
+	std::size_t pattern = npos; // index of the pattern in the list the searcher was built from
+	std::size_t position = npos;
+	std::size_t length = 0;
+
+	constexpr explicit operator bool() const noexcept {
+		return pattern != npos;
+	}
+	friend constexpr bool operator==(const MultiSearchMatch&, const MultiSearchMatch&) = default;
+};
+
+
+/**
+ * @brief Searches a text for a fixed set of patterns in a single pass
+ *
+ * @details Small pattern sets are searched with a Teddy style fingerprint filter using SSSE3 shuffles, which tests 16 positions at once and only verifies the candidates it finds.
+ * Larger sets, and every set when SSSE3 is not available, use an Aho-Corasick automaton with a dense transition table over the bytes which occur in the patterns.
+ * Empty patterns never match and identical patterns are reported with the index of the first one.
+ *
+ * @tparam CharTy character type, has to be one byte wide
+ */
+template <class CharTy> class BasicMultiSearcher {
+public:
+	static_assert(sizeof(CharTy) == 1, "lsd::BasicMultiSearcher: Only single byte character types are supported!");
+
+	using value_type = CharTy;
+	using size_type = std::size_t;
+	using view_type = BasicStringView<value_type>;
+	using match_type = MultiSearchMatch;
+
+	static constexpr size_type npos = match_type::npos;
+	static constexpr size_type teddyMaxPatterns = 16;
+
+	BasicMultiSearcher() = default;
+	BasicMultiSearcher(std::initializer_list<view_type> patterns) {
+		build(patterns.begin(), patterns.end());
+	}
+	template <class Range> explicit BasicMultiSearcher(const Range& patterns) requires requires(const Range& r) { view_type(*std::begin(r)); } {
+		build(std::begin(patterns), std::end(patterns));
+	}
+
+	/**
+	 * @brief Find the leftmost match, preferring the longest pattern if several start at the same position
+	 *
+	 * @param text text to search
+	 *
+	 * @return The match, which converts to false if nothing was found
+	 */
+	[[nodiscard]] match_type findFirst(view_type text) const {
+		match_type best;
+
+		if (m_teddy) {
+			scanTeddy(text, [&best](const match_type& m) {
+				if (!best || m.length > best.length) best = m;
+				return true;
+			}, true);
+		} else {
+			scanAutomaton(text, [&best, this](const match_type& m, size_type end) {
+				if (!best || m.position < best.position || (m.position == best.position && m.length > best.length)) best = m;
+				return end + 1 < best.position + m_maxLength; // later matches can not start before the current best anymore
+			});
+		}
+
+		return best;
+	}
+	/**
+	 * @brief Check if any pattern occurs in a text
+	 */
+	[[nodiscard]] bool contains(view_type text) const {
+		bool found = false;
+
+		if (m_teddy) scanTeddy(text, [&found](const match_type&) { return !(found = true); }, false);
+		else scanAutomaton(text, [&found](const match_type&, size_type) { return !(found = true); });
+
+		return found;
+	}
+	/**
+	 * @brief Call a function for every match including overlapping ones
+	 *
+	 * @details The order of the matches depends on the search strategy, use the overload returning a vector for matches sorted by position
+	 *
+	 * @param text text to search
+	 * @param function function called with every match, the search stops when it returns false
+	 */
+	template <class Function> void findAll(view_type text, Function&& function) const {
+		auto call = [&function](const match_type& m) {
+			if constexpr (std::is_same_v<std::invoke_result_t<Function&, const match_type&>, void>) {
+				function(m);
+				return true;
+			} else return static_cast<bool>(function(m));
+		};
+
+		if (m_teddy) scanTeddy(text, call, false);
+		else scanAutomaton(text, [&call](const match_type& m, size_type) { return call(m); });
+	}
+	/**
+	 * @brief Call a function for every match that findFirst() would return when searching again after the end of the previous one
+	 *
+	 * @details The matches are reported in order of their position and never overlap. The text is only scanned once.
+	 *
+	 * @param text text to search
+	 * @param function function called with every match
+	 */
+	template <class Function> void findLeftmostLongest(view_type text, Function&& function) const {
+		size_type next = 0; // matches starting before the end of the last reported one are skipped
+
+		if (m_teddy) { // matches are verified in order of their position, so a match is final as soon as one at a later position is found
+			match_type current;
+
+			scanTeddy(text, [&](const match_type& m) {
+				if (current && m.position != current.position) {
+					function(current);
+					next = current.position + current.length;
+					current = { };
+				}
+
+				if (m.position >= next && (!current || m.length > current.length)) current = m;
+				return true;
+			}, false);
+
+			if (current) function(current);
+		} else { // matches are found at their end, so a candidate is only final once no pattern can start before it and end at the current position
+			Vector<match_type> candidates; // longest candidate per position, sorted by position
+
+			auto flush = [&](size_type end) {
+				size_type count = 0;
+
+				for (; count < candidates.size() && candidates[count].position + m_maxLength <= end; count++) {
+					const auto& m = candidates[count];
+					if (m.position < next) continue;
+
+					function(m);
+					next = m.position + m.length;
+				}
+
+				candidates.erase(candidates.begin(), candidates.begin() + count);
+				while (!candidates.empty() && candidates.front().position < next) candidates.erase(candidates.begin());
+			};
+
+			scanAutomaton(text, [&](const match_type& m, size_type end) {
+				flush(end);
+				if (m.position < next) return true;
+
+				auto it = std::lower_bound(candidates.begin(), candidates.end(), m.position, [](const match_type& c, size_type position) { return c.position < position; });
+
+				if (it == candidates.end() || it->position != m.position) candidates.insert(it, m);
+				else if (m.length > it->length) *it = m;
+
+				return true;
+			});
+
+			flush(npos);
+		}
+	}
+	/**
+	 * @brief Get every match including overlapping ones, sorted by their position and then by pattern index
+	 */
+	[[nodiscard]] Vector<match_type> findAll(view_type text) const {
+		Vector<match_type> matches;
+		findAll(text, [&matches](const match_type& m) { matches.pushBack(m); });
+
+		std::sort(matches.begin(), matches.end(), [](const match_type& a, const match_type& b) {
+			return a.position < b.position || (a.position == b.position && a.pattern < b.pattern);
+		});
+
+		return matches;
+	}
+
+	[[nodiscard]] size_type patternCount() const noexcept {
+		return m_offsets.size();
+	}
+	[[nodiscard]] view_type pattern(size_type index) const noexcept {
+		return view_type(m_storage.data() + m_offsets[index], m_lengths[index]);
+	}
+	/**
+	 * @brief Check if the SIMD fingerprint search is used instead of the automaton
+	 */
+	[[nodiscard]] bool usesTeddy() const noexcept {
+		return m_teddy;
+	}
+
+private:
+	static constexpr std::uint32_t none = std::uint32_t(-1);
+
+	// pattern storage
+	Vector<value_type> m_storage; // not a string, patterns may contain null characters
+	Vector<size_type> m_offsets;
+	Vector<size_type> m_lengths;
+	size_type m_maxLength = 0;
+	size_type m_minLength = 0;
+
+	// Aho-Corasick automaton
+	std::uint8_t m_classes[256] { };
+	size_type m_classCount = 1;
+	Vector<std::uint32_t> m_transitions;
+	Vector<std::uint32_t> m_statePattern; // pattern ending in a state or none
+	Vector<std::uint32_t> m_outputLink; // nearest suffix state with a pattern, 0 if there is none
+
+	// Teddy
+	bool m_teddy = false;
+	size_type m_fingerprintSize = 0;
+	std::uint8_t m_low[3][16] { };
+	std::uint8_t m_high[3][16] { };
+	Vector<std::uint32_t> m_buckets[8];
+
+
+	[[nodiscard]] static std::uint8_t byteOf(value_type c) noexcept {
+		return static_cast<std::uint8_t>(c);
+	}
+	[[nodiscard]] bool matchesAt(view_type text, size_type position, size_type index) const noexcept {
+		auto length = m_lengths[index];
+		return length <= text.size() - position && std::memcmp(text.data() + position, m_storage.data() + m_offsets[index], length) == 0;
+	}
+
+	template <class It> void build(It first, It last) {
+		for (; first != last; ++first) {
+			view_type p(*first);
+
+			m_offsets.pushBack(m_storage.size());
+			m_lengths.pushBack(p.size());
+			m_storage.insert(m_storage.end(), p.data(), p.data() + p.size());
+		}
+
+		size_type active = 0;
+		m_minLength = npos;
+
+		for (auto length : m_lengths) {
+			if (length == 0) continue;
+
+			++active;
+			m_maxLength = std::max(m_maxLength, length);
+			m_minLength = std::min(m_minLength, length);
+		}
+
+		if (active == 0) { // without an automaton nothing is ever found
+			m_minLength = 0;
+			return;
+		}
+
+#if defined(__SSSE3__)
+		if (active <= teddyMaxPatterns) {
+			buildTeddy();
+			return;
+		}
+#endif
+
+		buildAutomaton();
+	}
+
+	void buildTeddy() {
+		m_teddy = true;
+		m_fingerprintSize = std::min<size_type>(3, m_minLength);
+
+		for (size_type i = 0; i < m_offsets.size(); i++) {
+			if (m_lengths[i] == 0 || isDuplicate(i)) continue;
+
+			auto bucket = i % 8; // sets of more than 8 patterns share buckets, which only costs additional verification
+			m_buckets[bucket].pushBack(static_cast<std::uint32_t>(i));
+
+			for (size_type j = 0; j < m_fingerprintSize; j++) {
+				auto c = byteOf(m_storage[m_offsets[i] + j]);
+
+				m_low[j][c & 0xF] |= std::uint8_t(1) << bucket;
+				m_high[j][c >> 4] |= std::uint8_t(1) << bucket;
+			}
+		}
+	}
+
+	[[nodiscard]] bool isDuplicate(size_type index) const noexcept {
+		for (size_type i = 0; i < index; i++)
+			if (pattern(i) == pattern(index)) return true;
+
+		return false;
+	}
+
+	void buildAutomaton() {
+		// compress the alphabet to the bytes which occur in the patterns, class 0 is every other byte
+		for (auto c : m_storage) {
+			auto& cls = m_classes[byteOf(c)];
+			if (cls == 0) cls = static_cast<std::uint8_t>(m_classCount++);
+		}
+
+		// trie
+		m_transitions.resize(m_classCount, 0);
+		m_statePattern.pushBack(none);
+
+		for (size_type i = 0; i < m_offsets.size(); i++) {
+			if (m_lengths[i] == 0) continue;
+
+			std::uint32_t state = 0;
+
+			for (size_type j = 0; j < m_lengths[i]; j++) {
+				auto& next = m_transitions[state * m_classCount + m_classes[byteOf(m_storage[m_offsets[i] + j])]];
+
+				if (next == 0) {
+					next = static_cast<std::uint32_t>(m_statePattern.size());
+					m_statePattern.pushBack(none);
+					m_transitions.resize(m_transitions.size() + m_classCount, 0);
+				}
+
+				state = m_transitions[state * m_classCount + m_classes[byteOf(m_storage[m_offsets[i] + j])]];
+			}
+
+			if (m_statePattern[state] == none) m_statePattern[state] = static_cast<std::uint32_t>(i);
+		}
+
+		// failure links in breadth first order, turning the trie into a complete automaton
+		Vector<std::uint32_t> failure(m_statePattern.size(), 0);
+		m_outputLink.resize(m_statePattern.size(), 0);
+
+		Vector<std::uint32_t> queue;
+		for (size_type c = 0; c < m_classCount; c++)
+			if (auto next = m_transitions[c]; next != 0) queue.pushBack(next);
+
+		for (size_type head = 0; head < queue.size(); head++) {
+			auto state = queue[head];
+
+			for (size_type c = 0; c < m_classCount; c++) {
+				auto& next = m_transitions[state * m_classCount + c];
+				auto fallback = m_transitions[failure[state] * m_classCount + c];
+
+				if (next == 0) next = fallback;
+				else {
+					failure[next] = fallback;
+					m_outputLink[next] = (m_statePattern[fallback] != none) ? fallback : m_outputLink[fallback];
+					queue.pushBack(next);
+				}
+			}
+		}
+	}
+
+	// the function returns false to stop the search
+	template <class Function> void scanAutomaton(view_type text, Function&& function) const {
+		if (m_transitions.empty()) return;
+
+		std::uint32_t state = 0;
+
+		for (size_type i = 0; i < text.size(); i++) {
+			state = m_transitions[state * m_classCount + m_classes[byteOf(text[i])]];
+
+			for (auto s = (m_statePattern[state] != none) ? state : m_outputLink[state]; s != 0; s = m_outputLink[s]) {
+				auto pattern = m_statePattern[s];
+				auto length = m_lengths[pattern];
+
+				if (!function(match_type { pattern, i + 1 - length, length }, i)) return;
+			}
+		}
+	}
+
+	// verifies all patterns of the buckets set in a candidate mask, stops at the first candidate position with a match if firstOnly is set
+	template <class Function> bool verifyTeddy(view_type text, size_type position, std::uint8_t buckets, Function& function, bool firstOnly) const {
+		bool found = false;
+
+		for (; buckets != 0; buckets &= buckets - 1) {
+			for (auto index : m_buckets[std::countr_zero(buckets)]) {
+				if (matchesAt(text, position, index)) {
+					found = true;
+					if (!function(match_type { index, position, m_lengths[index] })) return false;
+				}
+			}
+		}
+
+		return !(firstOnly && found);
+	}
+
+	template <class Function> void scanTeddy(view_type text, Function&& function, bool firstOnly) const {
+		auto data = reinterpret_cast<const std::uint8_t*>(text.data());
+		auto size = text.size();
+
+		if (size < m_minLength) return;
+
+		auto lastStart = size - m_minLength; // last position a pattern can start at
+		size_type position = 0;
+
+#if defined(__SSSE3__)
+		__m128i low[3], high[3];
+		for (size_type j = 0; j < m_fingerprintSize; j++) {
+			low[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_low[j]));
+			high[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_high[j]));
+		}
+
+		const auto nibble = _mm_set1_epi8(0x0F);
+
+		for (; position + m_fingerprintSize - 1 + 16 <= size; position += 16) {
+			auto candidates = _mm_set1_epi8(-1);
+
+			for (size_type j = 0; j < m_fingerprintSize; j++) {
+				auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + j));
+
+				candidates = _mm_and_si128(candidates, _mm_and_si128(
+					_mm_shuffle_epi8(low[j], _mm_and_si128(bytes, nibble)),
+					_mm_shuffle_epi8(high[j], _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble))
+				));
+			}
+
+			auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(candidates, _mm_setzero_si128()))) ^ 0xFFFFu;
+			if (mask == 0) continue;
+
+			alignas(16) std::uint8_t buckets[16];
+			_mm_store_si128(reinterpret_cast<__m128i*>(buckets), candidates);
+
+			for (; mask != 0; mask &= mask - 1) {
+				auto offset = static_cast<size_type>(std::countr_zero(mask));
+				if (position + offset > lastStart) return;
+
+				if (!verifyTeddy(text, position + offset, buckets[offset], function, firstOnly)) return;
+			}
+		}
+#endif
+
+		for (; position <= lastStart; position++) {
+			std::uint8_t buckets = 0xFF;
+
+			for (size_type j = 0; j < m_fingerprintSize; j++)
+				buckets &= m_low[j][data[position + j] & 0xF] & m_high[j][data[position + j] >> 4];
+
+			if (buckets != 0 && !verifyTeddy(text, position, buckets, function, firstOnly)) return;
+		}
+	}
+};
+
+using MultiSearcher = BasicMultiSearcher<char>;
+
+} // namespace lsd
@@ -0,0 +1,623 @@
+/*************************
+ * @file Rope.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Rope implementation for large editable text
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Detail/CoreUtility.h"
+#include "Iterators.h"
+#include "String.h"
+#include "StringView.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+namespace lsd {
+
+namespace detail {
+
+template <class String> struct RopeNode {
+	using size_type = std::size_t;
+
+	String chunk;
+
+	RopeNode* left = nullptr;
+	RopeNode* right = nullptr;
+	RopeNode* parent = nullptr;
+
+	std::uint64_t priority = 0;
+
+	size_type chunkLines = 0;
+	size_type length = 0; // characters in the subtree
+	size_type lines = 0; // line breaks in the subtree
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Text stored as a balanced tree of string chunks
+ *
+ * @details The chunks are kept in a treap ordered by their position in the text, each node caches the length and the amount of line breaks of its subtree.
+ * Inserting, erasing, indexing and converting between positions and lines are all logarithmic in the amount of chunks, independent from the length of the text.
+ *
+ * @tparam CharTy character type
+ * @tparam Traits character traits
+ * @tparam Alloc allocator
+ */
+template <class CharTy, class Traits = CharTraits<CharTy>, class Alloc = std::allocator<CharTy>> class BasicRope {
+public:
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+
+	using traits_type = Traits;
+	using allocator_type = Alloc;
+	using const_alloc_reference = const allocator_type&;
+	using allocator_traits = std::allocator_traits<allocator_type>;
+
+	using value_type = CharTy;
+
+	using string_type = BasicString<value_type, traits_type, allocator_type>;
+	using view_type = BasicStringView<value_type, traits_type>;
+
+	using container = BasicRope;
+	using container_reference = container&;
+	using const_container_reference = const container&;
+	using container_rvreference = container&&;
+
+	static constexpr size_type npos = -1;
+	static constexpr size_type maxChunkSize = 1024;
+
+private:
+	using node_type = detail::RopeNode<string_type>;
+	using node_pointer = node_type*;
+
+	using node_alloc = allocator_traits::template rebind_alloc<node_type>;
+	using node_traits = allocator_traits::template rebind_traits<node_type>;
+
+public:
+	/**
+	 * @brief Forward iterator over the chunks of the rope, dereferences to a view of the chunk
+	 */
+	class ChunkIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = view_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const view_type*;
+		using reference = view_type;
+
+		constexpr ChunkIterator() noexcept = default;
+
+		[[nodiscard]] constexpr view_type operator*() const noexcept {
+			return view_type(m_node->chunk.data(), m_node->chunk.size());
+		}
+
+		constexpr ChunkIterator& operator++() noexcept {
+			if (m_node->right) {
+				m_node = m_node->right;
+				while (m_node->left) m_node = m_node->left;
+			} else {
+				auto child = m_node;
+				m_node = m_node->parent;
+
+				while (m_node && m_node->right == child) {
+					child = m_node;
+					m_node = m_node->parent;
+				}
+			}
+
+			return *this;
+		}
+		constexpr ChunkIterator operator++(int) noexcept {
+			auto r = *this;
+			++*this;
+			return r;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const ChunkIterator&, const ChunkIterator&) noexcept = default;
+
+	private:
+		const node_type* m_node = nullptr;
+
+		constexpr ChunkIterator(const node_type* node) noexcept : m_node(node) { }
+
+		friend class BasicRope;
+	};
+
+	/**
+	 * @brief Range over all chunks of the rope
+	 */
+	class ChunkRange {
+	public:
+		[[nodiscard]] constexpr ChunkIterator begin() const noexcept {
+			return m_begin;
+		}
+		[[nodiscard]] constexpr ChunkIterator end() const noexcept {
+			return ChunkIterator();
+		}
+
+	private:
+		ChunkIterator m_begin;
+
+		constexpr ChunkRange(ChunkIterator begin) noexcept : m_begin(begin) { }
+
+		friend class BasicRope;
+	};
+
+	using chunk_iterator = ChunkIterator;
+
+	constexpr BasicRope() = default;
+	constexpr BasicRope(const_alloc_reference alloc) : m_alloc(alloc) { }
+	constexpr BasicRope(view_type text, const_alloc_reference alloc = allocator_type()) : m_alloc(alloc) {
+		m_root = build(text);
+	}
+	constexpr BasicRope(const value_type* text, const_alloc_reference alloc = allocator_type()) : BasicRope(view_type(text), alloc) { }
+	constexpr BasicRope(const_container_reference other) : m_alloc(other.m_alloc), m_seed(other.m_seed) {
+		m_root = copy(other.m_root, nullptr);
+	}
+	constexpr BasicRope(container_rvreference other) noexcept :
+		m_alloc(std::move(other.m_alloc)), m_root(std::exchange(other.m_root, nullptr)), m_seed(other.m_seed) { }
+
+	constexpr ~BasicRope() {
+		destroy(m_root);
+	}
+
+	constexpr container_reference operator=(const_container_reference other) {
+		if (this != &other) {
+			destroy(m_root);
+			m_root = copy(other.m_root, nullptr);
+		}
+
+		return *this;
+	}
+	constexpr container_reference operator=(container_rvreference other) noexcept {
+		if (this != &other) {
+			destroy(m_root);
+
+			m_alloc = std::move(other.m_alloc);
+			m_root = std::exchange(other.m_root, nullptr);
+		}
+
+		return *this;
+	}
+	constexpr container_reference operator=(view_type text) {
+		clear();
+		m_root = build(text);
+
+		return *this;
+	}
+
+	constexpr void swap(container_reference other) noexcept {
+		std::swap(m_alloc, other.m_alloc);
+		std::swap(m_root, other.m_root);
+		std::swap(m_seed, other.m_seed);
+	}
+
+	/**
+	 * @brief Insert text at a position
+	 *
+	 * @param pos position to insert the text at
+	 * @param text text to insert
+	 */
+	constexpr container_reference insert(size_type pos, view_type text) {
+		if (pos > size()) LSD_THROW(std::out_of_range("lsd::BasicRope::insert(): Position exceeded rope bounds!"));
+		if (text.empty()) return *this;
+
+		if (!m_root || !insertIntoChunk(m_root, pos, text)) {
+			auto [left, right] = split(m_root, pos);
+			m_root = merge(merge(left, build(text)), right);
+		}
+
+		m_root->parent = nullptr;
+
+		return *this;
+	}
+	constexpr container_reference append(view_type text) {
+		return insert(size(), text);
+	}
+	constexpr container_reference pushBack(value_type c) {
+		return insert(size(), view_type(&c, 1));
+	}
+	[[deprecated]] constexpr container_reference push_back(value_type c) {
+		return pushBack(c);
+	}
+
+	/**
+	 * @brief Erase a range of text
+	 *
+	 * @param pos beginning of the range
+	 * @param count length of the range, clamped to the end of the rope
+	 */
+	constexpr container_reference erase(size_type pos, size_type count = npos) {
+		auto s = size();
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicRope::erase(): Position exceeded rope bounds!"));
+
+		count = std::min(count, s - pos);
+		if (count == 0) return *this;
+
+		auto [left, rest] = split(m_root, pos);
+		auto [middle, right] = split(rest, count);
+
+		destroy(middle);
+		m_root = merge(left, right);
+		if (m_root) m_root->parent = nullptr;
+
+		return *this;
+	}
+	constexpr container_reference replace(size_type pos, size_type count, view_type text) {
+		return erase(pos, count).insert(pos, text);
+	}
+
+	constexpr void clear() noexcept {
+		destroy(m_root);
+		m_root = nullptr;
+	}
+
+	[[nodiscard]] constexpr value_type at(size_type pos) const {
+		if (pos >= size()) LSD_THROW(std::out_of_range("lsd::BasicRope::at(): Position exceeded rope bounds!"));
+		return (*this)[pos];
+	}
+	[[nodiscard]] constexpr value_type operator[](size_type pos) const noexcept {
+		auto node = m_root;
+
+		while (true) {
+			auto leftLength = length(node->left);
+
+			if (pos < leftLength) node = node->left;
+			else if ((pos -= leftLength) < node->chunk.size()) return node->chunk[pos];
+			else {
+				pos -= node->chunk.size();
+				node = node->right;
+			}
+		}
+	}
+	[[nodiscard]] constexpr value_type front() const noexcept {
+		return (*this)[0];
+	}
+	[[nodiscard]] constexpr value_type back() const noexcept {
+		return (*this)[size() - 1];
+	}
+
+	/**
+	 * @brief Call a function with views of all chunk pieces covering a range of text, in order
+	 *
+	 * @param pos beginning of the range
+	 * @param count length of the range, clamped to the end of the rope
+	 * @param function function to call with every piece
+	 */
+	template <class Function> constexpr void forEachSlice(size_type pos, size_type count, Function&& function) const {
+		auto s = size();
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicRope::forEachSlice(): Position exceeded rope bounds!"));
+
+		count = std::min(count, s - pos);
+		if (count > 0) forEachSlice(m_root, pos, count, function);
+	}
+
+	[[nodiscard]] constexpr string_type substr(size_type pos = 0, size_type count = npos) const {
+		string_type r;
+
+		forEachSlice(pos, count, [&r](view_type slice) {
+			r.append(slice.data(), slice.size());
+		});
+
+		return r;
+	}
+	[[nodiscard]] constexpr string_type str() const {
+		return substr();
+	}
+
+	/**
+	 * @brief Get the zero based line a position is on
+	 *
+	 * @param pos position in the text
+	 *
+	 * @return Amount of line breaks before the position
+	 */
+	[[nodiscard]] constexpr size_type lineOf(size_type pos) const {
+		if (pos > size()) LSD_THROW(std::out_of_range("lsd::BasicRope::lineOf(): Position exceeded rope bounds!"));
+
+		size_type line = 0;
+
+		for (auto node = m_root; node; ) {
+			auto leftLength = length(node->left);
+
+			if (pos <= leftLength) node = node->left;
+			else {
+				line += lines(node->left);
+				pos -= leftLength;
+
+				if (pos <= node->chunk.size()) return line + countLines(view_type(node->chunk.data(), pos));
+
+				line += node->chunkLines;
+				pos -= node->chunk.size();
+				node = node->right;
+			}
+		}
+
+		return line;
+	}
+	/**
+	 * @brief Get the position a zero based line starts at
+	 *
+	 * @param line line to search for
+	 *
+	 * @return Position of the first character of the line
+	 */
+	[[nodiscard]] constexpr size_type lineStart(size_type line) const {
+		if (line >= lineCount()) LSD_THROW(std::out_of_range("lsd::BasicRope::lineStart(): Line exceeded rope bounds!"));
+		if (line == 0) return 0;
+
+		size_type pos = 0;
+
+		for (auto node = m_root; node; ) { // searches for the line break which ends the previous line
+			auto leftLines = lines(node->left);
+
+			if (line <= leftLines) node = node->left;
+			else {
+				line -= leftLines;
+				pos += length(node->left);
+
+				if (line <= node->chunkLines) {
+					auto data = node->chunk.data();
+					for (size_type i = 0; ; i++)
+						if (data[i] == '\n' && --line == 0) return pos + i + 1;
+				}
+
+				line -= node->chunkLines;
+				pos += node->chunk.size();
+				node = node->right;
+			}
+		}
+
+		return pos;
+	}
+	[[nodiscard]] constexpr string_type line(size_type line) const {
+		auto begin = lineStart(line);
+		auto end = (line + 1 < lineCount()) ? lineStart(line + 1) - 1 : size();
+
+		return substr(begin, end - begin);
+	}
+
+	[[nodiscard]] constexpr ChunkIterator chunksBegin() const noexcept {
+		auto node = m_root;
+		if (node) while (node->left) node = node->left;
+
+		return ChunkIterator(node);
+	}
+	[[nodiscard]] constexpr ChunkIterator chunksEnd() const noexcept {
+		return ChunkIterator();
+	}
+	[[nodiscard]] constexpr ChunkRange chunks() const noexcept {
+		return ChunkRange(chunksBegin());
+	}
+
+	[[nodiscard]] constexpr size_type size() const noexcept {
+		return length(m_root);
+	}
+	[[nodiscard]] constexpr size_type length() const noexcept {
+		return length(m_root);
+	}
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return m_root == nullptr;
+	}
+	/**
+	 * @brief Get the amount of lines, which is one more than the amount of line breaks
+	 */
+	[[nodiscard]] constexpr size_type lineCount() const noexcept {
+		return lines(m_root) + 1;
+	}
+	[[nodiscard]] constexpr allocator_type allocator() const noexcept {
+		return allocator_type(m_alloc);
+	}
+
+	[[nodiscard]] friend constexpr bool operator==(const_container_reference first, view_type second) noexcept {
+		if (first.size() != second.size()) return false;
+
+		size_type offset = 0;
+		for (auto chunk : first.chunks()) {
+			if (traits_type::compare(chunk.data(), second.data() + offset, chunk.size()) != 0) return false;
+			offset += chunk.size();
+		}
+
+		return true;
+	}
+	[[nodiscard]] friend constexpr bool operator==(const_container_reference first, const_container_reference second) noexcept {
+		return first == view_type(second.str());
+	}
+
+private:
+	[[no_unique_address]] node_alloc m_alloc { };
+	node_pointer m_root = nullptr;
+	std::uint64_t m_seed = 0x9E3779B97F4A7C15;
+
+
+	[[nodiscard]] static constexpr size_type length(const node_type* node) noexcept {
+		return node ? node->length : 0;
+	}
+	[[nodiscard]] static constexpr size_type lines(const node_type* node) noexcept {
+		return node ? node->lines : 0;
+	}
+	[[nodiscard]] static constexpr size_type countLines(view_type text) noexcept {
+		size_type count = 0;
+		for (auto c : text) count += (c == '\n');
+
+		return count;
+	}
+
+	static constexpr void update(node_pointer node) noexcept {
+		node->length = length(node->left) + node->chunk.size() + length(node->right);
+		node->lines = lines(node->left) + node->chunkLines + lines(node->right);
+
+		if (node->left) node->left->parent = node;
+		if (node->right) node->right->parent = node;
+	}
+
+	[[nodiscard]] constexpr std::uint64_t nextPriority() noexcept { // splitmix64
+		auto z = (m_seed += 0x9E3779B97F4A7C15);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+
+		return z ^ (z >> 31);
+	}
+
+	[[nodiscard]] constexpr node_pointer createNode(view_type text) {
+		auto node = node_traits::allocate(m_alloc, 1);
+		node_traits::construct(m_alloc, node);
+
+		node->chunk = string_type(text.data(), text.size());
+		node->chunkLines = countLines(text);
+		node->priority = nextPriority();
+		update(node);
+
+		return node;
+	}
+	constexpr void destroy(node_pointer node) noexcept {
+		if (!node) return;
+
+		destroy(node->left);
+		destroy(node->right);
+
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+	}
+	[[nodiscard]] constexpr node_pointer copy(const node_type* node, node_pointer parent) {
+		if (!node) return nullptr;
+
+		auto r = node_traits::allocate(m_alloc, 1);
+		node_traits::construct(m_alloc, r, *node);
+
+		r->parent = parent;
+		r->left = copy(node->left, r);
+		r->right = copy(node->right, r);
+
+		return r;
+	}
+
+	// builds a subtree out of text split into chunks of the maximum size
+	[[nodiscard]] constexpr node_pointer build(view_type text) {
+		node_pointer root = nullptr;
+
+		for (size_type i = 0; i < text.size(); i += maxChunkSize)
+			root = merge(root, createNode(text.substr(i, maxChunkSize)));
+
+		if (root) root->parent = nullptr;
+		return root;
+	}
+
+	[[nodiscard]] static constexpr node_pointer merge(node_pointer left, node_pointer right) noexcept {
+		if (!left) return right;
+		if (!right) return left;
+
+		if (left->priority > right->priority) {
+			left->right = merge(left->right, right);
+			update(left);
+
+			return left;
+		} else {
+			right->left = merge(left, right->left);
+			update(right);
+
+			return right;
+		}
+	}
+
+	// splits a subtree into the first pos characters and the rest, splitting a chunk if necessary
+	[[nodiscard]] constexpr std::pair<node_pointer, node_pointer> split(node_pointer node, size_type pos) {
+		if (!node) return { nullptr, nullptr };
+
+		auto leftLength = length(node->left);
+
+		if (pos <= leftLength) {
+			auto [left, right] = split(node->left, pos);
+			node->left = right;
+			update(node);
+
+			return { left, node };
+		}
+
+		pos -= leftLength;
+
+		if (pos >= node->chunk.size()) {
+			auto [left, right] = split(node->right, pos - node->chunk.size());
+			node->right = left;
+			update(node);
+
+			return { node, right };
+		}
+
+		view_type chunk(node->chunk.data(), node->chunk.size());
+		auto suffix = createNode(chunk.substr(pos));
+
+		node->chunk = string_type(chunk.data(), pos);
+		node->chunkLines -= suffix->chunkLines;
+
+		auto right = merge(suffix, node->right);
+		node->right = nullptr;
+		update(node);
+
+		return { node, right };
+	}
+
+	// inserts small edits into an existing chunk instead of creating a new one, the lengths are updated on the way back up
+	constexpr bool insertIntoChunk(node_pointer node, size_type pos, view_type text) {
+		auto leftLength = length(node->left);
+
+		bool inserted = false;
+
+		if (pos < leftLength || (pos == leftLength && node->left))
+			inserted = insertIntoChunk(node->left, pos, text);
+		else if (pos - leftLength <= node->chunk.size()) {
+			pos -= leftLength;
+
+			if (node->chunk.size() + text.size() > maxChunkSize) return false;
+
+			string_type chunk;
+			chunk.reserve(node->chunk.size() + text.size());
+			chunk.append(node->chunk.data(), pos).append(text.data(), text.size()).append(node->chunk.data() + pos, node->chunk.size() - pos);
+
+			node->chunk = std::move(chunk);
+			node->chunkLines += countLines(text);
+			inserted = true;
+		} else if (node->right)
+			inserted = insertIntoChunk(node->right, pos - leftLength - node->chunk.size(), text);
+
+		if (inserted) update(node);
+		return inserted;
+	}
+
+	template <class Function> static constexpr void forEachSlice(const node_type* node, size_type pos, size_type& count, Function& function) {
+		if (!node || count == 0) return;
+
+		auto leftLength = length(node->left);
+
+		if (pos < leftLength) forEachSlice(node->left, pos, count, function);
+		if (count == 0) return;
+
+		auto chunkPos = (pos > leftLength) ? pos - leftLength : 0;
+
+		if (chunkPos < node->chunk.size()) {
+			auto sliceSize = std::min(count, node->chunk.size() - chunkPos);
+			function(view_type(node->chunk.data() + chunkPos, sliceSize));
+			count -= sliceSize;
+		}
+
+		auto rightPos = leftLength + node->chunk.size();
+		forEachSlice(node->right, (pos > rightPos) ? pos - rightPos : 0, count, function);
+	}
+};
+
+using Rope = BasicRope<char>;
+using WRope = BasicRope<wchar_t>;
+
+} // namespace lsd
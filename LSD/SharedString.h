@@ -0,0 +1,312 @@
+/**************************
+ * @file SharedString.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Immutable reference counted strings with constant time copies
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "StringView.h"
+#include "Hash.h"
+#include "Detail/CoreUtility.h"
+
+#include <cstddef>
+#include <cassert>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <functional>
+#include <stdexcept>
+
+namespace lsd {
+
+namespace detail {
+
+struct SharedStringHeader { // the characters are stored directly behind the header
+	std::atomic<std::size_t> references;
+	std::size_t size;
+	std::atomic<std::size_t> hash; // 0 if it was not computed yet
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Immutable string sharing a single reference counted allocation between all of its copies
+ *
+ * @details The reference count, the size, the cached hash and the null terminated characters live in one allocation,
+ * so copying, moving and taking substrings never copies any characters. Substrings keep the whole allocation alive.
+ * Copies of the same string can be passed between threads freely.
+ *
+ * @tparam CharTy character type
+ * @tparam Traits character traits
+ * @tparam Alloc allocator, rebound to allocate the header and characters together
+ */
+template <class CharTy, class Traits = CharTraits<CharTy>, class Alloc = std::allocator<CharTy>> class BasicSharedString {
+public:
+	using value_type = CharTy;
+	using traits_type = Traits;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using const_reference = const value_type&;
+	using const_pointer = const value_type*;
+
+	using view_type = BasicStringView<value_type, traits_type>;
+	using const_iterator = typename view_type::const_iterator;
+	using iterator = const_iterator;
+
+	using allocator_type = Alloc;
+	using const_alloc_reference = const allocator_type&;
+
+	static constexpr size_type npos = view_type::npos;
+
+	constexpr BasicSharedString() noexcept(noexcept(allocator_type())) = default;
+	explicit BasicSharedString(const_alloc_reference alloc) noexcept : m_alloc(alloc) { }
+	/**
+	 * @brief Copy a string into a new shared allocation
+	 *
+	 * @param string string to copy
+	 * @param alloc allocator
+	 */
+	explicit BasicSharedString(view_type string, const_alloc_reference alloc = allocator_type()) : m_alloc(alloc) {
+		if (string.empty()) return;
+
+		m_header = allocateHeader(string.size());
+		m_size = string.size();
+
+		auto characters = charactersOf(m_header);
+		traits_type::copy(characters, string.data(), m_size);
+		traits_type::assign(characters[m_size], value_type { });
+
+		m_data = characters;
+	}
+	explicit BasicSharedString(const_pointer string, const_alloc_reference alloc = allocator_type()) : BasicSharedString(view_type(string), alloc) { }
+	template <class StringLike> explicit BasicSharedString(const StringLike& string, const_alloc_reference alloc = allocator_type())
+		requires (std::is_convertible_v<const StringLike&, view_type> && !std::is_convertible_v<const StringLike&, const_pointer>) :
+		BasicSharedString(view_type(string), alloc) { }
+
+	BasicSharedString(const BasicSharedString& other) noexcept : m_alloc(other.m_alloc), m_header(other.m_header), m_data(other.m_data), m_size(other.m_size) {
+		if (m_header) m_header->references.fetch_add(1, std::memory_order_relaxed);
+	}
+	BasicSharedString(BasicSharedString&& other) noexcept :
+		m_alloc(other.m_alloc),
+		m_header(std::exchange(other.m_header, nullptr)),
+		m_data(std::exchange(other.m_data, emptyData())),
+		m_size(std::exchange(other.m_size, 0)) { }
+	~BasicSharedString() {
+		release();
+	}
+
+	BasicSharedString& operator=(const BasicSharedString& other) noexcept {
+		if (this != &other) {
+			if (other.m_header) other.m_header->references.fetch_add(1, std::memory_order_relaxed);
+			release();
+
+			m_alloc = other.m_alloc;
+			m_header = other.m_header;
+			m_data = other.m_data;
+			m_size = other.m_size;
+		}
+
+		return *this;
+	}
+	BasicSharedString& operator=(BasicSharedString&& other) noexcept {
+		if (this != &other) {
+			release();
+
+			m_alloc = other.m_alloc;
+			m_header = std::exchange(other.m_header, nullptr);
+			m_data = std::exchange(other.m_data, emptyData());
+			m_size = std::exchange(other.m_size, 0);
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]] const_reference at(size_type index) const {
+		if (index >= m_size) LSD_THROW(std::out_of_range("lsd::BasicSharedString::at(): Index exceded string bounds!"));
+		return m_data[index];
+	}
+	[[nodiscard]] const_reference operator[](size_type index) const noexcept {
+		assert((index < m_size) && "lsd::BasicSharedString::operator[]: Index exceded string bounds!");
+		return m_data[index];
+	}
+	[[nodiscard]] const_reference front() const noexcept {
+		return m_data[0];
+	}
+	[[nodiscard]] const_reference back() const noexcept {
+		return m_data[m_size - 1];
+	}
+
+	[[nodiscard]] const_iterator begin() const noexcept {
+		return view().begin();
+	}
+	[[nodiscard]] const_iterator cbegin() const noexcept {
+		return begin();
+	}
+	[[nodiscard]] const_iterator end() const noexcept {
+		return view().end();
+	}
+	[[nodiscard]] const_iterator cend() const noexcept {
+		return end();
+	}
+
+	[[nodiscard]] view_type view() const noexcept {
+		return view_type(m_data, m_size);
+	}
+	[[nodiscard]] operator view_type() const noexcept {
+		return view();
+	}
+	/**
+	 * @brief Get the characters, which are only null terminated if the string is not a substring ending before its parent
+	 */
+	[[nodiscard]] const_pointer data() const noexcept {
+		return m_data;
+	}
+	[[nodiscard]] size_type size() const noexcept {
+		return m_size;
+	}
+	[[nodiscard]] size_type length() const noexcept {
+		return m_size;
+	}
+	[[nodiscard]] bool empty() const noexcept {
+		return m_size == 0;
+	}
+
+	/**
+	 * @brief Get a substring sharing the allocation of this string
+	 *
+	 * @param pos position of the first character
+	 * @param count maximum amount of characters
+	 *
+	 * @return The substring
+	 */
+	[[nodiscard]] BasicSharedString substr(size_type pos = 0, size_type count = npos) const {
+		if (pos > m_size) LSD_THROW(std::out_of_range("lsd::BasicSharedString::substr(): Position exceded string bounds!"));
+
+		BasicSharedString result(*this);
+		result.m_data += pos;
+		result.m_size = std::min(count, m_size - pos);
+
+		return result;
+	}
+
+	/**
+	 * @brief Get the hash of the string, which is computed only once for every string that is not a substring
+	 */
+	[[nodiscard]] size_type hash() const noexcept {
+		if (!m_header || m_data != charactersOf(m_header) || m_size != m_header->size) return Hash<view_type>{}(view());
+
+		auto hash = m_header->hash.load(std::memory_order_relaxed);
+
+		if (hash == 0) {
+			hash = Hash<view_type>{}(view());
+			m_header->hash.store(hash, std::memory_order_relaxed); // racing threads store the same value
+		}
+
+		return hash;
+	}
+	/**
+	 * @brief Get the amount of strings sharing the allocation, 0 for an empty string
+	 */
+	[[nodiscard]] size_type useCount() const noexcept {
+		return m_header ? m_header->references.load(std::memory_order_relaxed) : 0;
+	}
+
+	[[nodiscard]] allocator_type getAllocator() const noexcept {
+		return m_alloc;
+	}
+
+	[[nodiscard]] friend bool operator==(const BasicSharedString& first, const BasicSharedString& second) noexcept {
+		return (first.m_data == second.m_data && first.m_size == second.m_size) || first.view() == second.view();
+	}
+	[[nodiscard]] friend bool operator==(const BasicSharedString& first, view_type second) noexcept {
+		return first.view() == second;
+	}
+	[[nodiscard]] friend auto operator<=>(const BasicSharedString& first, const BasicSharedString& second) noexcept {
+		return first.view().compare(second.view()) <=> 0;
+	}
+	[[nodiscard]] friend auto operator<=>(const BasicSharedString& first, view_type second) noexcept {
+		return first.view().compare(second) <=> 0;
+	}
+
+private:
+	using header_type = detail::SharedStringHeader;
+	using header_allocator = typename std::allocator_traits<allocator_type>::template rebind_alloc<header_type>;
+	using header_traits = std::allocator_traits<header_allocator>;
+
+	[[no_unique_address]] allocator_type m_alloc { };
+	header_type* m_header = nullptr;
+	const_pointer m_data = emptyData();
+	size_type m_size = 0;
+
+	[[nodiscard]] static constexpr const_pointer emptyData() noexcept {
+		static constexpr value_type empty[1] { };
+		return empty;
+	}
+	[[nodiscard]] static constexpr size_type blockCount(size_type size) noexcept { // the allocation is counted in headers to keep it aligned
+		return 1 + ((size + 1) * sizeof(value_type) + sizeof(header_type) - 1) / sizeof(header_type);
+	}
+	[[nodiscard]] static value_type* charactersOf(header_type* header) noexcept {
+		return reinterpret_cast<value_type*>(header + 1);
+	}
+
+	[[nodiscard]] header_type* allocateHeader(size_type size) {
+		header_allocator alloc(m_alloc);
+
+		auto header = header_traits::allocate(alloc, blockCount(size));
+		header_traits::construct(alloc, header);
+		header->references.store(1, std::memory_order_relaxed);
+		header->size = size;
+		header->hash.store(0, std::memory_order_relaxed);
+
+		return header;
+	}
+	void release() noexcept {
+		if (m_header && m_header->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			header_allocator alloc(m_alloc);
+
+			header_traits::destroy(alloc, m_header);
+			header_traits::deallocate(alloc, m_header, blockCount(m_header->size));
+		}
+	}
+};
+
+template <class C, class T, class A> struct Hash<BasicSharedString<C, T, A>> {
+	using is_transparent = void;
+
+	std::size_t operator()(const BasicSharedString<C, T, A>& string) const noexcept {
+		return string.hash();
+	}
+	std::size_t operator()(BasicStringView<C, T> string) const noexcept {
+		return Hash<BasicStringView<C, T>>{}(string);
+	}
+};
+
+using SharedString = BasicSharedString<char>;
+using WSharedString = BasicSharedString<wchar_t>;
+
+} // namespace lsd
+
+
+// shared strings and views are compared by content, which allows looking up views in containers of shared strings
+
+template <class C, class T, class A> struct std::equal_to<lsd::BasicSharedString<C, T, A>> {
+	using is_transparent = void;
+
+	bool operator()(const lsd::BasicSharedString<C, T, A>& first, const lsd::BasicSharedString<C, T, A>& second) const noexcept {
+		return first == second;
+	}
+	bool operator()(const lsd::BasicSharedString<C, T, A>& first, lsd::BasicStringView<C, T> second) const noexcept {
+		return first.view() == second;
+	}
+	bool operator()(lsd::BasicStringView<C, T> first, const lsd::BasicSharedString<C, T, A>& second) const noexcept {
+		return first == second.view();
+	}
+};
@@ -0,0 +1,502 @@
+/*************************
+ * @file SoAVector.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Vector storing each field of its elements in a separate array
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Detail/CoreUtility.h"
+#include "Detail/BulkCopy.h"
+#include "Iterators.h"
+
+#include <cstddef>
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <span>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace lsd {
+
+namespace detail {
+
+struct alignas(64) SoABlock { // unit of allocation, which keeps the start of every field array aligned to a cache line
+	std::byte bytes[64];
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Structure of arrays container with the interface of a vector
+ *
+ * @details Every field is stored in its own contiguous array aligned to a cache line, all of which live in a single allocation.
+ * Loops over a single field through field<I>() or fieldBegin<I>() only touch the memory of that field and vectorize like loops over a plain array.
+ * Rows are accessed through proxy references, which are tuples of references to the fields of the row.
+ *
+ * @tparam Alloc allocator, rebound to allocate the arrays and to construct the fields
+ * @tparam Fields types of the fields of an element
+ */
+template <class Alloc, class... Fields> class BasicSoAVector {
+public:
+	static_assert(sizeof...(Fields) > 0, "lsd::BasicSoAVector: At least one field is required!");
+	static_assert(((alignof(Fields) <= alignof(detail::SoABlock)) && ...), "lsd::BasicSoAVector: Fields may not be aligned stricter than a cache line!");
+
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+
+	using allocator_type = Alloc;
+	using const_alloc_reference = const allocator_type&;
+
+	using value_type = std::tuple<Fields...>;
+	using reference = std::tuple<Fields&...>;
+	using const_reference = std::tuple<const Fields&...>;
+
+	template <std::size_t I> using field_type = std::tuple_element_t<I, value_type>;
+	template <std::size_t I> using field_iterator = Iterator<field_type<I>>;
+	template <std::size_t I> using const_field_iterator = Iterator<const field_type<I>>;
+
+	static constexpr size_type fieldCount = sizeof...(Fields);
+	static constexpr size_type fieldAlignment = alignof(detail::SoABlock);
+
+	/**
+	 * @brief Random access iterator over the rows, which dereferences to a proxy reference
+	 */
+	template <bool Const> class RowIterator {
+	public:
+		using difference_type = std::ptrdiff_t;
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = typename BasicSoAVector::value_type;
+		using reference = std::conditional_t<Const, typename BasicSoAVector::const_reference, typename BasicSoAVector::reference>;
+		using container_pointer = std::conditional_t<Const, const BasicSoAVector*, BasicSoAVector*>;
+
+		RowIterator() noexcept = default;
+		RowIterator(container_pointer container, size_type index) noexcept : m_container(container), m_index(index) { }
+
+		operator RowIterator<true>() const noexcept requires (!Const) {
+			return RowIterator<true>(m_container, m_index);
+		}
+
+		[[nodiscard]] reference operator*() const noexcept {
+			return (*m_container)[m_index];
+		}
+		[[nodiscard]] reference operator[](difference_type n) const noexcept {
+			return (*m_container)[m_index + n];
+		}
+		[[nodiscard]] size_type index() const noexcept {
+			return m_index;
+		}
+
+		RowIterator& operator++() noexcept {
+			++m_index;
+			return *this;
+		}
+		RowIterator operator++(int) noexcept {
+			auto tmp = *this;
+			++m_index;
+			return tmp;
+		}
+		RowIterator& operator--() noexcept {
+			--m_index;
+			return *this;
+		}
+		RowIterator operator--(int) noexcept {
+			auto tmp = *this;
+			--m_index;
+			return tmp;
+		}
+		RowIterator& operator+=(difference_type n) noexcept {
+			m_index += n;
+			return *this;
+		}
+		RowIterator& operator-=(difference_type n) noexcept {
+			m_index -= n;
+			return *this;
+		}
+
+		[[nodiscard]] friend RowIterator operator+(RowIterator it, difference_type n) noexcept {
+			return it += n;
+		}
+		[[nodiscard]] friend RowIterator operator+(difference_type n, RowIterator it) noexcept {
+			return it += n;
+		}
+		[[nodiscard]] friend RowIterator operator-(RowIterator it, difference_type n) noexcept {
+			return it -= n;
+		}
+		[[nodiscard]] friend difference_type operator-(const RowIterator& first, const RowIterator& second) noexcept {
+			return static_cast<difference_type>(first.m_index) - static_cast<difference_type>(second.m_index);
+		}
+
+		[[nodiscard]] friend bool operator==(const RowIterator& first, const RowIterator& second) noexcept {
+			return first.m_index == second.m_index;
+		}
+		[[nodiscard]] friend auto operator<=>(const RowIterator& first, const RowIterator& second) noexcept {
+			return first.m_index <=> second.m_index;
+		}
+
+	private:
+		container_pointer m_container = nullptr;
+		size_type m_index = 0;
+	};
+
+	using iterator = RowIterator<false>;
+	using const_iterator = RowIterator<true>;
+
+	BasicSoAVector() noexcept(noexcept(allocator_type())) = default;
+	explicit BasicSoAVector(const_alloc_reference alloc) noexcept : m_alloc(alloc) { }
+	explicit BasicSoAVector(size_type count, const_alloc_reference alloc = allocator_type()) : m_alloc(alloc) {
+		resize(count);
+	}
+	BasicSoAVector(size_type count, const value_type& value, const_alloc_reference alloc = allocator_type()) : m_alloc(alloc) {
+		resize(count, value);
+	}
+	BasicSoAVector(const BasicSoAVector& other) : BasicSoAVector(other, other.m_alloc) { }
+	BasicSoAVector(const BasicSoAVector& other, const_alloc_reference alloc) : m_alloc(alloc) {
+		copyFrom(other);
+	}
+	BasicSoAVector(BasicSoAVector&& other) noexcept :
+		m_alloc(other.m_alloc),
+		m_fields(std::exchange(other.m_fields, { })),
+		m_size(std::exchange(other.m_size, 0)),
+		m_cap(std::exchange(other.m_cap, 0)) { }
+	~BasicSoAVector() {
+		clear();
+		deallocate();
+	}
+
+	BasicSoAVector& operator=(const BasicSoAVector& other) {
+		if (this != &other) {
+			clear();
+			copyFrom(other);
+		}
+
+		return *this;
+	}
+	BasicSoAVector& operator=(BasicSoAVector&& other) noexcept {
+		if (this != &other) {
+			clear();
+			deallocate();
+
+			m_alloc = other.m_alloc;
+			m_fields = std::exchange(other.m_fields, { });
+			m_size = std::exchange(other.m_size, 0);
+			m_cap = std::exchange(other.m_cap, 0);
+		}
+
+		return *this;
+	}
+
+	void swap(BasicSoAVector& other) noexcept {
+		std::swap(m_alloc, other.m_alloc);
+		std::swap(m_fields, other.m_fields);
+		std::swap(m_size, other.m_size);
+		std::swap(m_cap, other.m_cap);
+	}
+
+	[[nodiscard]] iterator begin() noexcept {
+		return iterator(this, 0);
+	}
+	[[nodiscard]] const_iterator begin() const noexcept {
+		return const_iterator(this, 0);
+	}
+	[[nodiscard]] const_iterator cbegin() const noexcept {
+		return begin();
+	}
+	[[nodiscard]] iterator end() noexcept {
+		return iterator(this, m_size);
+	}
+	[[nodiscard]] const_iterator end() const noexcept {
+		return const_iterator(this, m_size);
+	}
+	[[nodiscard]] const_iterator cend() const noexcept {
+		return end();
+	}
+
+	/**
+	 * @brief Get the array of a single field
+	 *
+	 * @tparam I index of the field
+	 *
+	 * @return Span over the field of every element
+	 */
+	template <std::size_t I> [[nodiscard]] std::span<field_type<I>> field() noexcept {
+		return { std::get<I>(m_fields), m_size };
+	}
+	template <std::size_t I> [[nodiscard]] std::span<const field_type<I>> field() const noexcept {
+		return { std::get<I>(m_fields), m_size };
+	}
+	template <std::size_t I> [[nodiscard]] field_type<I>* fieldData() noexcept {
+		return std::get<I>(m_fields);
+	}
+	template <std::size_t I> [[nodiscard]] const field_type<I>* fieldData() const noexcept {
+		return std::get<I>(m_fields);
+	}
+	template <std::size_t I> [[nodiscard]] field_iterator<I> fieldBegin() noexcept {
+		return std::get<I>(m_fields);
+	}
+	template <std::size_t I> [[nodiscard]] const_field_iterator<I> fieldBegin() const noexcept {
+		return std::get<I>(m_fields);
+	}
+	template <std::size_t I> [[nodiscard]] field_iterator<I> fieldEnd() noexcept {
+		return std::get<I>(m_fields) + m_size;
+	}
+	template <std::size_t I> [[nodiscard]] const_field_iterator<I> fieldEnd() const noexcept {
+		return std::get<I>(m_fields) + m_size;
+	}
+
+	[[nodiscard]] reference operator[](size_type index) noexcept {
+		assert((index < m_size) && "lsd::BasicSoAVector::operator[]: Index exceded array bounds!");
+		return row<reference>(m_fields, index);
+	}
+	[[nodiscard]] const_reference operator[](size_type index) const noexcept {
+		assert((index < m_size) && "lsd::BasicSoAVector::operator[]: Index exceded array bounds!");
+		return row<const_reference>(m_fields, index);
+	}
+	[[nodiscard]] reference at(size_type index) {
+		if (index >= m_size) LSD_THROW(std::out_of_range("lsd::BasicSoAVector::at(): Index exceded array bounds!"));
+		return (*this)[index];
+	}
+	[[nodiscard]] const_reference at(size_type index) const {
+		if (index >= m_size) LSD_THROW(std::out_of_range("lsd::BasicSoAVector::at(): Index exceded array bounds!"));
+		return (*this)[index];
+	}
+	/**
+	 * @brief Get a single field of an element
+	 *
+	 * @tparam I index of the field
+	 */
+	template <std::size_t I> [[nodiscard]] field_type<I>& get(size_type index) noexcept {
+		assert((index < m_size) && "lsd::BasicSoAVector::get(): Index exceded array bounds!");
+		return std::get<I>(m_fields)[index];
+	}
+	template <std::size_t I> [[nodiscard]] const field_type<I>& get(size_type index) const noexcept {
+		assert((index < m_size) && "lsd::BasicSoAVector::get(): Index exceded array bounds!");
+		return std::get<I>(m_fields)[index];
+	}
+	[[nodiscard]] reference front() noexcept {
+		return (*this)[0];
+	}
+	[[nodiscard]] const_reference front() const noexcept {
+		return (*this)[0];
+	}
+	[[nodiscard]] reference back() noexcept {
+		return (*this)[m_size - 1];
+	}
+	[[nodiscard]] const_reference back() const noexcept {
+		return (*this)[m_size - 1];
+	}
+
+	/**
+	 * @brief Construct an element at the end, with one argument per field
+	 *
+	 * @param args arguments from which the fields are constructed in order
+	 *
+	 * @return Proxy reference to the new element
+	 */
+	template <class... Args> reference emplaceBack(Args&&... args) requires (sizeof...(Args) == fieldCount) {
+		smartReserve(m_size + 1);
+
+		auto arguments = std::forward_as_tuple(std::forward<Args>(args)...);
+		forEachField([this, &arguments]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+			auto alloc = fieldAllocator<I>();
+			std::allocator_traits<field_allocator<I>>::construct(alloc, std::get<I>(m_fields) + m_size, std::get<I>(std::move(arguments)));
+		});
+
+		return (*this)[m_size++];
+	}
+	void pushBack(const value_type& value) {
+		std::apply([this](const Fields&... fields) { emplaceBack(fields...); }, value);
+	}
+	void pushBack(value_type&& value) {
+		std::apply([this](Fields&... fields) { emplaceBack(std::move(fields)...); }, value);
+	}
+	void popBack() noexcept {
+		assert((m_size != 0) && "lsd::BasicSoAVector::popBack(): Container was empty!");
+		destroyRows(m_size - 1, m_size);
+		--m_size;
+	}
+
+	iterator erase(const_iterator pos) noexcept {
+		return erase(pos, pos + 1);
+	}
+	/**
+	 * @brief Erase a range of elements, moving the elements behind it forward field by field
+	 */
+	iterator erase(const_iterator first, const_iterator last) noexcept {
+		auto index = first.index();
+		auto count = last.index() - index;
+
+		if (count != 0) {
+			forEachField([this, index, count]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+				auto data = std::get<I>(m_fields);
+				std::move(data + index + count, data + m_size, data + index);
+			});
+
+			destroyRows(m_size - count, m_size);
+			m_size -= count;
+		}
+
+		return iterator(this, index);
+	}
+	void clear() noexcept {
+		destroyRows(0, m_size);
+		m_size = 0;
+	}
+
+	void resize(size_type count) {
+		if (count > m_size) {
+			reserve(count);
+
+			forEachField([this, count]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+				auto alloc = fieldAllocator<I>();
+				for (auto it = std::get<I>(m_fields) + m_size; it != std::get<I>(m_fields) + count; it++)
+					std::allocator_traits<field_allocator<I>>::construct(alloc, it);
+			});
+		} else destroyRows(count, m_size);
+
+		m_size = count;
+	}
+	void resize(size_type count, const value_type& value) {
+		if (count > m_size) {
+			reserve(count);
+
+			forEachField([this, count, &value]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+				auto alloc = fieldAllocator<I>();
+				detail::uninitializedFill(alloc, std::get<I>(m_fields) + m_size, count - m_size, std::get<I>(value));
+			});
+		} else destroyRows(count, m_size);
+
+		m_size = count;
+	}
+	void reserve(size_type count) {
+		if (count > m_cap) {
+			if (count > maxSize()) LSD_THROW(std::length_error("lsd::BasicSoAVector::reserve(): Count exceded maximum allocation size"));
+			reallocate(count);
+		}
+	}
+	void shrinkToFit() {
+		if (m_size < m_cap) reallocate(m_size);
+	}
+
+	[[nodiscard]] size_type size() const noexcept {
+		return m_size;
+	}
+	[[nodiscard]] size_type capacity() const noexcept {
+		return m_cap;
+	}
+	[[nodiscard]] size_type maxSize() const noexcept {
+		block_allocator alloc(m_alloc);
+		return std::allocator_traits<block_allocator>::max_size(alloc) * sizeof(detail::SoABlock) / (sizeof(Fields) + ...);
+	}
+	[[nodiscard]] bool empty() const noexcept {
+		return m_size == 0;
+	}
+	[[nodiscard]] allocator_type allocator() const noexcept {
+		return m_alloc;
+	}
+
+private:
+	using block_allocator = typename std::allocator_traits<allocator_type>::template rebind_alloc<detail::SoABlock>;
+	using block_traits = std::allocator_traits<block_allocator>;
+	template <std::size_t I> using field_allocator = typename std::allocator_traits<allocator_type>::template rebind_alloc<field_type<I>>;
+	using field_pointers = std::tuple<Fields*...>;
+
+	[[no_unique_address]] allocator_type m_alloc { };
+
+	field_pointers m_fields { };
+	size_type m_size = 0;
+	size_type m_cap = 0;
+
+	template <class Function> static void forEachField(Function&& function) {
+		[&function]<std::size_t... I>(std::index_sequence<I...>) {
+			(function(std::integral_constant<std::size_t, I> { }), ...);
+		}(std::index_sequence_for<Fields...> { });
+	}
+	template <class Reference> [[nodiscard]] static Reference row(const field_pointers& fields, size_type index) noexcept {
+		return std::apply([index](auto... data) { return Reference(data[index]...); }, fields);
+	}
+	template <std::size_t I> [[nodiscard]] field_allocator<I> fieldAllocator() const noexcept {
+		return field_allocator<I>(m_alloc);
+	}
+
+	// the arrays are laid out in order of the fields, each starting on a multiple of the field alignment
+	[[nodiscard]] static size_type blockCount(size_type capacity) noexcept {
+		size_type offset = 0;
+		((offset = alignedOffset(offset + capacity * sizeof(Fields))), ...);
+
+		return offset / sizeof(detail::SoABlock);
+	}
+	[[nodiscard]] static constexpr size_type alignedOffset(size_type offset) noexcept {
+		return (offset + fieldAlignment - 1) / fieldAlignment * fieldAlignment;
+	}
+	[[nodiscard]] static field_pointers layout(detail::SoABlock* blocks, size_type capacity) noexcept {
+		auto bytes = reinterpret_cast<std::byte*>(blocks);
+		size_type offset = 0;
+
+		field_pointers fields;
+		forEachField([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+			std::get<I>(fields) = reinterpret_cast<field_type<I>*>(bytes + offset);
+			offset = alignedOffset(offset + capacity * sizeof(field_type<I>));
+		});
+
+		return fields;
+	}
+
+	void smartReserve(size_type count) {
+		if (count > m_cap) reserve(std::max(count, m_cap * 2));
+	}
+	void reallocate(size_type capacity) {
+		field_pointers fields { };
+
+		if (capacity != 0) {
+			block_allocator alloc(m_alloc);
+			fields = layout(block_traits::allocate(alloc, blockCount(capacity)), capacity);
+
+			forEachField([this, &fields]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+				auto alloc = fieldAllocator<I>();
+				detail::uninitializedRelocate(alloc, std::get<I>(m_fields), std::get<I>(m_fields) + m_size, std::get<I>(fields));
+			});
+		}
+
+		deallocate();
+
+		m_fields = fields;
+		m_cap = capacity;
+	}
+	void deallocate() noexcept { // the first array starts at the beginning of the allocation
+		if (m_cap != 0) {
+			block_allocator alloc(m_alloc);
+			block_traits::deallocate(alloc, reinterpret_cast<detail::SoABlock*>(std::get<0>(m_fields)), blockCount(m_cap));
+		}
+	}
+	void destroyRows(size_type first, size_type last) noexcept {
+		forEachField([this, first, last]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+			auto alloc = fieldAllocator<I>();
+			detail::destroyRange(alloc, std::get<I>(m_fields) + first, std::get<I>(m_fields) + last);
+		});
+	}
+	void copyFrom(const BasicSoAVector& other) {
+		reserve(other.m_size);
+
+		forEachField([this, &other]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+			auto alloc = fieldAllocator<I>();
+			detail::uninitializedCopy(alloc, std::get<I>(other.m_fields), std::get<I>(other.m_fields) + other.m_size, std::get<I>(m_fields));
+		});
+
+		m_size = other.m_size;
+	}
+};
+
+template <class... Fields> using SoAVector = BasicSoAVector<std::allocator<std::byte>, Fields...>;
+
+} // namespace lsd
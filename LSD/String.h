@@ -12,11 +12,14 @@
 #pragma once
 
 #include "Detail/CoreUtility.h"
+#include "Detail/BulkCopy.h"
 #include "Utility.h"
 #include "Hash.h"
 #include "Iterators.h"
 #include "CharTraits.h"
 #include "StringView.h"
+#include "FromChars.h"
+#include "ToChars.h"
 
 #include <cstdlib>
 #include <cassert>
@@ -25,6 +28,8 @@
 #include <initializer_list>
 #include <ostream>
 #include <istream>
+#include <expected>
+#include <string>
 
 namespace lsd {
 
@@ -38,7 +43,15 @@ namespace detail {
 }
 
 
-template <class CharTy, class Traits = CharTraits<CharTy>, class Alloc = std::allocator<CharTy>> class BasicString { // @todo custom compile time allocator implementation
+/**
+ * @brief Dynamically sized string with small string optimization
+ *
+ * @tparam CharTy character type
+ * @tparam Traits character traits
+ * @tparam Alloc allocator
+ * @tparam InlineCapacity minimum amount of characters stored without allocating, 0 uses the size of three pointers
+ */
+template <class CharTy, class Traits = CharTraits<CharTy>, class Alloc = std::allocator<CharTy>, std::size_t InlineCapacity = 0> class BasicString { // @todo custom compile time allocator implementation
 public: 
 	using size_type = std::size_t;
 	using difference_type = std::ptrdiff_t;
@@ -77,8 +90,12 @@ public:
 private:
 	// aggressive small string and padding calculation
 
-	static constexpr size_type paddingSize = 
+	static constexpr size_type defaultPaddingSize = 
 		static_cast<size_type>(sizeof(value_type) / (sizeof(pointer) * 4) + 1);
+	static constexpr size_type inlineStorageSize = (InlineCapacity + 1) * sizeof(value_type) + 1; // characters, null terminator and the tag
+	static constexpr size_type paddingSize = (inlineStorageSize > sizeof(pointer) * (3 + defaultPaddingSize)) ? 
+		(inlineStorageSize - sizeof(pointer) * 3 + sizeof(pointer) - 1) / sizeof(pointer) : 
+		defaultPaddingSize;
 	static constexpr size_type smallStringCap = 
 		static_cast<size_type>((sizeof(pointer) * 3 + sizeof(pointer) * paddingSize - 1) / sizeof(value_type)) - 1;
 	static constexpr size_type smallStringPaddingSize = 
@@ -134,11 +151,11 @@ public:
 		resize(count, value);
 	}
 	constexpr BasicString(const_container_reference other, size_type pos, const_alloc_reference alloc = allocator_type()) {
-		if (pos > other.size()) throw std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!");
+		if (pos > other.size()) LSD_THROW(std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!"));
 		else *this = std::move(BasicString(other.pBegin() + pos, other.pEnd(), alloc));
 	}
 	constexpr BasicString(container_rvreference other, size_type pos, const_alloc_reference alloc = allocator_type()) : m_alloc(alloc) {
-		if (pos > other.size()) throw std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!");
+		if (pos > other.size()) LSD_THROW(std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!"));
 		else {
 			if constexpr (allocator_traits::is_always_equal::value || !allocator_traits::propagate_on_container_move_assignment::value) 
 				*this = std::move(other);
@@ -150,11 +167,11 @@ public:
 		
 	}
 	constexpr BasicString(const_container_reference other, size_type pos, size_type count, const_alloc_reference alloc = allocator_type()) {
-		if (pos > other.size()) throw std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!");
+		if (pos > other.size()) LSD_THROW(std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!"));
 		else *this = std::move(BasicString(other.pBegin() + pos, other.pBegin() + pos + std::min(count, other.size() - pos), alloc));
 	}
 	constexpr BasicString(container_rvreference other, size_type pos, size_type count, const_alloc_reference alloc = allocator_type()) {
-		if (pos > other.size()) throw std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!");
+		if (pos > other.size()) LSD_THROW(std::out_of_range("lsd::BasicString::BasicString(): Position exceded string bounds!"));
 		else *this = std::move(BasicString(other.pBegin() + pos, other.pBegin() + pos + std::min(count, other.size() - pos), alloc));
 	}
 	constexpr BasicString(const_pointer s, size_type count, const_alloc_reference alloc = allocator_type())
@@ -164,13 +181,14 @@ public:
 	template <class It> constexpr BasicString(It first, It last, const_alloc_reference alloc = allocator_type()) requires isIteratorValue<It> : 
 		m_alloc(alloc) {
 		if (first != last) {
-			auto count = last - first;
-			reserve(count);
+			auto count = static_cast<size_type>(last - first);
 
-			if (smallStringMode())
-				for (auto it = m_short.data; first != last; it++, first++) traits_type::assign(*it, *first);
+			if (count <= smallStringCap) // the characters and the null terminator fit into the small string
+				detail::copyRange(first, last, m_short.data);
 			else {
-				for (; first != last; m_long.end++, first++) allocator_traits::construct(m_alloc, m_long.end, *first);
+				reserve(count);
+
+				m_long.end = detail::uninitializedCopy(m_alloc, first, last, m_long.end);
 				allocator_traits::construct(m_alloc, m_long.end, value_type { });
 			}
 		}
@@ -200,8 +218,7 @@ public:
 			if (count != 0) {
 				reserve(count);
 
-				for (auto it = other.m_long.begin; it != other.m_long.end; m_long.end++, it++) 
-					allocator_traits::construct(m_alloc, m_long.end, *it);
+				m_long.end = detail::uninitializedCopy(m_alloc, other.m_long.begin, other.m_long.end, m_long.end);
 				allocator_traits::construct(m_alloc, m_long.end, value_type { });
 			}
 		} else {
@@ -218,7 +235,7 @@ public:
 	}
 	template <class StringViewLike> constexpr BasicString(const StringViewLike& sv, size_type pos, size_type count, const_alloc_reference alloc = allocator_type()) requires isConvertibleToView<StringViewLike> {
 		view_type v(sv);
-		if (pos > v.size()) throw std::out_of_range("lsd::BasicString::BasicString(): Position exceded string view bounds!");
+		if (pos > v.size()) LSD_THROW(std::out_of_range("lsd::BasicString::BasicString(): Position exceded string view bounds!"));
 		else *this = std::move(BasicString(v.m_begin + pos, v.m_begin + pos + std::min(count, v.size() - pos), alloc));
 	}
 	
@@ -238,17 +255,23 @@ public:
 		return assign(other.pBegin(), other.pEnd(), other.m_alloc);
 	}
 	constexpr container_reference operator=(container_rvreference other) noexcept {
-		std::swap(other.m_short.tag[0], m_short.tag[0]);
+		if (this == &other) return *this;
 
-		if (smallStringMode())
-			traits_type::move(m_short.data, other.m_short.data, smallStringCap);
+		if (other.smallStringMode()) // small strings are copied, which keeps the buffer of this string if it has one
+			assign(other.m_short.data, other.m_short.data + other.smallStringSize());
 		else if (detail::allocatorPropagationNecessary(other.m_alloc, m_alloc))
 			assign(other.m_long.begin, other.m_long.end, other.m_alloc);
 		else {
+			if (!smallStringMode()) {
+				destructBehind(m_long.begin - 1);
+				allocator_traits::deallocate(m_alloc, m_long.begin, m_long.cap - m_long.begin);
+			}
+
 			std::swap(other.m_alloc, m_alloc);
-			std::swap(other.m_long.begin, m_long.begin);
-			std::swap(other.m_long.end, m_long.end);
-			std::swap(other.m_long.cap, m_long.cap);
+			m_long.begin = std::exchange(other.m_long.begin, pointer { });
+			m_long.end = std::exchange(other.m_long.end, pointer { });
+			m_long.cap = std::exchange(other.m_long.cap, pointer { });
+			m_short.tag[0] = std::exchange(other.m_short.tag[0], 1); // other is now practically in small string mode
 		}
 
 		return *this;
@@ -279,7 +302,7 @@ public:
 	}
 	constexpr container_reference assign(const_container_reference other, size_type pos, size_type count = npos) {
 		auto s = other.size(); // just in case to avoid traits_type::length()
-		if (pos > s) throw std::out_of_range("lsd::BasicString::operator=(): Requested position exceded string bounds!");
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicString::operator=(): Requested position exceded string bounds!"));
 
 		assign(other.pBegin() + pos, other.pBegin() + pos + std::min(count, s - pos), other.m_alloc);
 		return *this;
@@ -298,14 +321,15 @@ public:
 		clear();
 
 		if (first != last) {
-			auto count = last - first;
-			smartReserve(count);
+			auto count = static_cast<size_type>(last - first);
 
-			if (smallStringMode()) 
-				for (auto it = m_short.data; first != last; it++, first++) traits_type::assign(*it, *first);
+			if (smallStringMode() && count <= smallStringCap) // checked here instead of after smartReserve(), so the bounds of the small string copy are known
+				detail::copyRange(first, last, m_short.data);
 			else {
-				for (; first != last; first++, m_long.end++) allocator_traits::construct(m_alloc, m_long.end, *first);
-				allocator_traits::construct(m_alloc, m_long.end, '\0');
+				smartReserve(count);
+
+				m_long.end = detail::uninitializedCopy(m_alloc, first, last, m_long.end);
+				allocator_traits::construct(m_alloc, m_long.end, value_type { });
 			}
 		}
 
@@ -320,7 +344,7 @@ public:
 	}
 	template <class StringViewLike> constexpr container_reference assign(const StringViewLike& sv, size_type pos, size_type count = npos) requires isConvertibleToView<StringViewLike> {
 		view_type v(sv);
-		if (pos > v.size()) throw std::out_of_range("lsd::BasicString::operator=(): Requested position exceded string bounds!");
+		if (pos > v.size()) LSD_THROW(std::out_of_range("lsd::BasicString::operator=(): Requested position exceded string bounds!"));
 
 		return assign(v.m_begin + pos, v.m_begin + pos + std::min(count, v.size() - pos));
 	}
@@ -396,29 +420,27 @@ public:
 		if (count > s)
 			append(count - s, value_type { });
 		else if (count < s)
-			destructBehind(pBegin() + count);
+			destructBehind(pBegin() + count - 1);
 	}
 	constexpr void resize(size_type count, const_reference value) {
 		auto s = size();
 		if (count > s)
 			append(count - s, value);
 		else if (count < s) 
-			destructBehind(pBegin() + count);
+			destructBehind(pBegin() + count - 1);
 	}
 	constexpr void reserve(size_type count) {
-		++count; // null terminator
-
-		if (count > maxSize()) throw std::length_error("lsd::BasicString::reserve(): Count + 1 exceded maximum allocation size");
+		if (count >= maxSize()) LSD_THROW(std::length_error("lsd::BasicString::reserve(): Count + 1 exceded maximum allocation size"));
 		else {
-			if (smallStringMode() && count > smallStringCap) {
+			++count; // null terminator
+
+			if (smallStringMode() && count > smallStringCap + 1) { // the small string buffer has room for smallStringCap characters and the null terminator
 				auto ssSize = smallStringSize(); 
 
 				pointer begin { };
 				begin = allocator_traits::allocate(m_alloc, count);
 
-				auto beginIt = begin;
-				for (auto ssIt = m_short.data; ssIt <= (m_short.data + ssSize); ssIt++, beginIt++)  // <= because of null terminator
-					allocator_traits::construct(m_alloc, beginIt, *ssIt);
+				detail::uninitializedCopy(m_alloc, m_short.data, m_short.data + ssSize + 1, begin); // plus one for null terminator
 
 				m_long.begin = begin;
 				m_long.end = m_long.begin + ssSize;
@@ -432,8 +454,7 @@ public:
 					auto oldBegin = std::exchange(m_long.begin, allocator_traits::allocate(m_alloc, count));
 
 					if (oldBegin) {
-						for (auto beginIt = m_long.begin, oldBeginIt = oldBegin; oldBeginIt != m_long.end + 1; oldBeginIt++, beginIt++) // plus one for null terminator
-							allocator_traits::construct(m_alloc, beginIt, *oldBeginIt);
+						detail::uninitializedCopy(m_alloc, oldBegin, m_long.end + 1, m_long.begin); // plus one for null terminator
 
 						allocator_traits::deallocate(m_alloc, oldBegin, cap);
 					}
@@ -444,13 +465,37 @@ public:
 			}
 		}
 	}
+	/**
+	 * @brief Resize the string and let an operation write its contents directly into the buffer
+	 *
+	 * @details The operation is called with a pointer to the buffer and count and returns the final size, which must not exceed count.
+	 * Characters behind the old size are uninitialized when the operation is called.
+	 *
+	 * @param count maximum size of the string
+	 * @param op operation which writes the contents
+	 */
+	template <class Operation> constexpr void resizeAndOverwrite(size_type count, Operation op) {
+		reserve(count);
+
+		auto begin = pBegin();
+		size_type s = std::move(op)(begin, count);
+
+		assert(s <= count && "lsd::BasicString::resizeAndOverwrite(): Operation returned a size larger than count!");
+
+		if (smallStringMode()) {
+			for (auto it = begin + s; it != m_short.data + smallStringCap + 1; it++) traits_type::assign(*it, value_type { });
+		} else {
+			m_long.end = m_long.begin + s;
+			traits_type::assign(*m_long.end, value_type { });
+		}
+	}
 	constexpr void shrinkToFit() {
 		if (!smallStringMode()) {
 			auto s = size() + 1; // + 1 because of the null terminator
 			auto cap = capacity();
 
 			if (s < cap) {
-				if (s <= smallStringCap) { // returns string to small string mode
+				if (s <= smallStringCap + 1) { // returns string to small string mode
 					pointer oldBegin = m_long.begin;
 					pointer oldEnd = m_long.end + 1;
 					m_short.tag[0] = 1;
@@ -459,15 +504,14 @@ public:
 					m_long.end = nullptr;
 					m_long.cap = nullptr;
 
-					for (auto it = m_short.data, oldIt = oldBegin; oldIt != oldEnd; oldIt++, it++) traits_type::assign(*it, *oldIt);
+					traits_type::copy(m_short.data, oldBegin, oldEnd - oldBegin);
 
 					allocator_traits::deallocate(m_alloc, oldBegin, cap);
 				} else {
 					auto oldBegin = std::exchange(m_long.begin, allocator_traits::allocate(m_alloc, s));
 
 					if (oldBegin) {
-						for (auto beginIt = m_long.begin, oldBeginIt = oldBegin; oldBeginIt != m_long.end + 1; beginIt++, oldBeginIt++)
-							allocator_traits::construct(m_alloc, beginIt, *oldBeginIt);
+						detail::uninitializedCopy(m_alloc, oldBegin, m_long.end + 1, m_long.begin);
 
 						allocator_traits::deallocate(m_alloc, oldBegin, cap);
 					}
@@ -517,9 +561,9 @@ public:
 			auto info = eraseAndInsertGap(pos, 0, count);
 
 			if (info.isMemReady)
-				for (; count != 0; count--, info.result++) traits_type::assign(*info.result, value);
+				traits_type::assign(info.result, count, value);
 			else
-				for (; count != 0; count--, info.result++) allocator_traits::construct(m_alloc, info.result, value);
+				detail::uninitializedFill(m_alloc, info.result, count, value);
 		
 			return info.result;
 		} else return pos;
@@ -531,9 +575,9 @@ public:
 			auto info = eraseAndInsertGap(pos, 0, last - first);
 
 			if (info.isMemReady)
-				for (; first != last; first++, info.result++) traits_type::assign(*info.result, *first);
+				detail::copyRange(first, last, info.result);
 			else
-				for (; first != last; first++, info.result++) allocator_traits::construct(m_alloc, info.result, *first);
+				detail::uninitializedCopy(m_alloc, first, last, info.result);
 		
 			return info.result;
 		} else return pos;
@@ -566,7 +610,7 @@ public:
 		return replace(first, last, str.pBegin(), str.pEnd());
 	}
 	constexpr container_reference replace(size_type pos, size_type count, const_container_reference str, size_type sPos, size_type sCount = npos) {
-		if (sPos > str.size()) throw std::out_of_range("lsd::BasicString::replace(): Position exceded bounds of inserted string!");
+		if (sPos > str.size()) LSD_THROW(std::out_of_range("lsd::BasicString::replace(): Position exceded bounds of inserted string!"));
 
 		auto beg = pBegin() + pos;
 		auto sBeg = str.pBegin() + sPos;
@@ -601,9 +645,9 @@ public:
 			auto info = eraseAndInsertGap(pos, last - first, count);
 
 			if (info.isMemReady)
-				for (; count != 0; count--, info.result++) traits_type::assign(*info.result, c);
+				traits_type::assign(info.result, count, c);
 			else
-				for (; count != 0; count--, info.result++) allocator_traits::construct(m_alloc, info.result, c);
+				detail::uninitializedFill(m_alloc, info.result, count, c);
 		}
 
 		return *this;
@@ -615,9 +659,9 @@ public:
 			auto info = eraseAndInsertGap(pos, last - first, rLast - rFirst);
 
 			if (info.isMemReady)
-				for (; rFirst != rLast; rFirst++, info.result++) traits_type::assign(*info.result, *rFirst);
+				detail::copyRange(rFirst, rLast, info.result);
 			else
-				for (; rFirst != rLast; rFirst++, info.result++) allocator_traits::construct(m_alloc, info.result, *rFirst);
+				detail::uninitializedCopy(m_alloc, rFirst, rLast, info.result);
 		}
 
 		return *this;
@@ -639,7 +683,7 @@ public:
 	template <class StringViewLike> constexpr container_reference replace(size_type pos, size_type count, const StringViewLike& sv, size_type vPos, size_type vCount = npos) requires isConvertibleToView<StringViewLike> {
 		view_type v(sv);
 
-		if (vPos > sv.size()) throw std::out_of_range("lsd::BasicString::replace(): Position exceded bounds of inserted string view!");
+		if (vPos > sv.size()) LSD_THROW(std::out_of_range("lsd::BasicString::replace(): Position exceded bounds of inserted string view!"));
 
 		auto beg = pBegin() + pos;
 
@@ -651,9 +695,9 @@ public:
 		smartReserve(s + count);
 		
 		if (smallStringMode())
-			for (auto it = (m_short.data + s); count > 0; count--, it++) traits_type::assign(*it, value);
+			traits_type::assign(m_short.data + s, count, value);
 		else {
-			for (; count > 0; count--, m_long.end++) allocator_traits::construct(m_alloc, m_long.end, value);
+			m_long.end = detail::uninitializedFill(m_alloc, m_long.end, count, value);
 			allocator_traits::construct(m_alloc, m_long.end, value_type { });
 		}
 
@@ -664,7 +708,7 @@ public:
 	}
 	constexpr container_reference append(const_container_reference str, size_type pos, size_type count = npos) {
 		auto s = str.size();
-		if (pos > s) throw std::out_of_range("lsd::BasicString::append(): Position exceded string bounds!");
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicString::append(): Position exceded string bounds!"));
 
 		return append(str.begin() + pos, str.begin() + pos + std::min(count, s - pos));
 	}
@@ -675,15 +719,15 @@ public:
 		return append(s, s + traits_type::length(s));
 	}
 	template <class InputIt> constexpr container_reference append(InputIt first, InputIt last) requires isIteratorValue<InputIt> {
-		auto count = last - first;
+		auto count = static_cast<size_type>(last - first);
 		auto s = size();
 
-		smartReserve(s + count);
-
-		if (smallStringMode()) 
-			for (auto it = (m_short.data + s); first != last; first++, it++) traits_type::assign(*it, *first);
+		if (smallStringMode() && s + count <= smallStringCap) // checked here instead of after smartReserve(), so the bounds of the small string copy are known
+			detail::copyRange(first, last, m_short.data + s);
 		else {
-			for (; first != last; first++, m_long.end++) allocator_traits::construct(m_alloc, m_long.end, *first);
+			smartReserve(s + count);
+
+			m_long.end = detail::uninitializedCopy(m_alloc, first, last, m_long.end);
 			allocator_traits::construct(m_alloc, m_long.end, value_type { });
 		}
 
@@ -699,7 +743,7 @@ public:
 	template <class StringViewLike> constexpr container_reference append(const StringViewLike& sv, size_type pos, size_type count = npos) requires isConvertibleToView<StringViewLike> {
 		view_type view(sv);
 		auto s = view.size();
-		if (pos > s) throw std::out_of_range("lsd::BasicString::append(): Position exceded string view bounds!");
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicString::append(): Position exceded string view bounds!"));
 
 		return append(view.begin() + pos, view.begin() + pos + std::min(count, s - pos));
 	}
@@ -722,24 +766,26 @@ public:
 	}
 
 	constexpr container_reference erase(size_type index = 0, size_type count = npos) {
-		erase(m_long.begin + index, m_long.begin + index + std::min(count, size() - index));
+		erase(pBegin() + index, pBegin() + index + std::min(count, size() - index));
 		return *this;
 	}
 	constexpr iterator erase(const_iterator pos) {
 		assert((pos < end()) && "lsd::BasicString::erase: past-end iterator passed to erase!");
 
-		auto it = m_long.begin + (pos - m_long.begin);
-
-		traits_type::move(it++, it, (m_long.end - it));
+		auto it = pBegin() + (pos.get() - pBegin());
+		traits_type::move(it, it + 1, pEnd() - it - 1);
 
 		popBack();
 
 		return it;
 	}
 	constexpr iterator erase(const_iterator first, const_iterator last) {
-		auto it = std::move(last.get(), pEnd(), first.get());
+		auto it = pBegin() + (first.get() - pBegin());
+		auto end = pBegin() + (last.get() - pBegin());
+		auto newEnd = it + (pEnd() - end);
 
-		destructBehind(it);
+		traits_type::move(it, end, pEnd() - end);
+		destructBehind(newEnd - 1);
 
 		return it;
 	}
@@ -752,7 +798,7 @@ public:
 	}
 
 	constexpr void clear() {
-		if (smallStringMode()) std::fill_n(m_short.data, smallStringCap - 1, value_type { });
+		if (smallStringMode()) std::fill_n(m_short.data, smallStringCap + 1, value_type { });
 		else destructBehind(m_long.begin - 1);
 	}
 
@@ -763,9 +809,15 @@ public:
 		auto siz = size();
 		auto beg = pBegin();
 
-		if (siz >= count && pos <= siz - count)
-			for (auto it = beg + pos; it < (pEnd() - count); it++)
-				if (traits_type::compare(s, it, count) == 0) return it - beg;
+		if (count == 0) return (pos <= siz) ? pos : npos;
+		if (siz < count || pos > siz - count) return npos;
+
+		auto last = beg + (siz - count); // last position the pattern can start at
+
+		for (auto it = beg + pos; it <= last; it++) { // searches for the first character before comparing the rest
+			if (!(it = traits_type::find(it, last - it + 1, *s))) return npos;
+			if (traits_type::compare(s + 1, it + 1, count - 1) == 0) return it - beg;
+		}
 
 		return npos;
 	}
@@ -773,7 +825,11 @@ public:
 		return find(s, pos, traits_type::length(s));
 	}
 	constexpr size_type find(value_type c, size_type pos = 0) const noexcept {
-		return find(std::addressof(c), pos, 1);
+		auto siz = size();
+		auto beg = pBegin();
+
+		auto it = (pos < siz) ? traits_type::find(beg + pos, siz - pos, c) : nullptr;
+		return it ? it - beg : npos;
 	}
 	template <class StringViewLike> constexpr size_type find(const StringViewLike& sv, size_type pos = 0) const noexcept(std::is_nothrow_convertible_v<const StringViewLike&, view_type>) requires isConvertibleToView<StringViewLike> {
 		auto v = view_type(sv);
@@ -995,7 +1051,7 @@ public:
 	}
 	constexpr int compare(size_type pos, size_type count, const_pointer s, size_type sCount) const {
 		auto curSiz = size();
-		if (pos > curSiz) throw std::out_of_range("lsd::BasicString::compare(): Position exceded string bounds!");
+		if (pos > curSiz) LSD_THROW(std::out_of_range("lsd::BasicString::compare(): Position exceded string bounds!"));
 
 		auto siz = curSiz - pos;
 		count = std::min(count, std::min(sCount, siz));
@@ -1087,7 +1143,7 @@ public:
 
 	constexpr size_type copy(pointer dst, size_type count, size_type pos = 0) const {
 		auto s = size();
-		if (pos > s) throw std::out_of_range("lsd::BasicString::copy(): Position exceded string bounds!");
+		if (pos > s) LSD_THROW(std::out_of_range("lsd::BasicString::copy(): Position exceded string bounds!"));
 
 		count = std::min(count, s - pos);
 
@@ -1103,8 +1159,8 @@ public:
 		errno = 0;
 		auto res = caster(it, &endPtr, std::forward<Args>(args)...);
 
-		if (errno == ERANGE) throw std::out_of_range("lsd::BasicString::castTo: Number exceeded type limits!");
-		if (endPtr == it) throw std::invalid_argument("lsd::BasicString::castTo: No valid conversion!"); ///@todo may need more checks
+		if (errno == ERANGE) LSD_THROW(std::out_of_range("lsd::BasicString::castTo: Number exceeded type limits!"));
+		if (endPtr == it) LSD_THROW(std::invalid_argument("lsd::BasicString::castTo: No valid conversion!")); ///@todo may need more checks
 
 		if (pos) *pos = endPtr - it;
 		
@@ -1167,21 +1223,21 @@ public:
 
 	[[nodiscard]] constexpr const_reference at(size_type index) const {
 		if (smallStringMode()) {
-			if (index >= smallStringSize()) throw std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!");
+			if (index >= smallStringSize()) LSD_THROW(std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!"));
 			return m_short.data[index];
 		} else {
 			auto ptr = m_long.begin + index;
-			if (ptr >= m_long.end) throw std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!");
+			if (ptr >= m_long.end) LSD_THROW(std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!"));
 			return *ptr;
 		}
 	}
 	[[nodiscard]] constexpr reference at(size_type index) {
 		if (smallStringMode()) {
-			if (index >= smallStringSize()) throw std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!");
+			if (index >= smallStringSize()) LSD_THROW(std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!"));
 			return m_short.data[index];
 		} else {
 			auto ptr = m_long.begin + index;
-			if (ptr >= m_long.end) throw std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!");
+			if (ptr >= m_long.end) LSD_THROW(std::out_of_range("lsd::BasicString::at(): Index exceded array bounds!"));
 			return *ptr;
 		}
 	}
@@ -1205,52 +1261,53 @@ public:
 	}
 
 	friend constexpr container operator+(const_container_reference lhs, const_container_reference rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, rhs, lhs.m_alloc);
 	}
 	friend constexpr container operator+(const_container_reference lhs, const_pointer rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, rhs, lhs.m_alloc);
 	}
 	friend constexpr container operator+(const_container_reference lhs, value_type rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, view_type(&rhs, 1), lhs.m_alloc);
 	}
 	friend constexpr container operator+(const_container_reference lhs, std::type_identity_t<view_type> rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, rhs, lhs.m_alloc);
 	}
 	friend constexpr container operator+(const_pointer lhs, const_container_reference rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, rhs, rhs.m_alloc);
 	}
 	friend constexpr container operator+(value_type lhs, const_container_reference rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(view_type(&lhs, 1), rhs, rhs.m_alloc);
 	}
 	friend constexpr container operator+(std::type_identity_t<view_type> lhs, const_container_reference rhs) {
-		return container(lhs).append(rhs);
+		return concatenate(lhs, rhs, rhs.m_alloc);
 	}
+	// the overloads taking temporaries reuse their buffer instead of copying it
 	friend constexpr container operator+(container_rvreference lhs, container_rvreference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(lhs.append(rhs));
 	}
 	friend constexpr container operator+(container_rvreference lhs, const_container_reference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(lhs.append(rhs));
 	}
 	friend constexpr container operator+(container_rvreference lhs, const_pointer rhs) {
-		return container(lhs).append(rhs);
+		return std::move(lhs.append(rhs));
 	}
 	friend constexpr container operator+(container_rvreference lhs, value_type rhs) {
-		return container(lhs).append(rhs);
+		return std::move(lhs.append(1, rhs));
 	}
 	friend constexpr container operator+(container_rvreference lhs, std::type_identity_t<view_type> rhs) {
-		return container(lhs).append(rhs);
+		return std::move(lhs.append(rhs));
 	}
 	friend constexpr container operator+(const_container_reference lhs, container_rvreference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(rhs.insert(0, lhs));
 	}
 	friend constexpr container operator+(const_pointer lhs, container_rvreference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(rhs.insert(0, lhs));
 	}
 	friend constexpr container operator+(value_type lhs, container_rvreference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(rhs.insert(0, 1, lhs));
 	}
 	friend constexpr container operator+(std::type_identity_t<view_type> lhs, container_rvreference rhs) {
-		return container(lhs).append(rhs);
+		return std::move(rhs.insert(0, lhs));
 	}
 
 	friend constexpr bool operator==(const_container_reference s1, const_container_reference s2) {
@@ -1267,6 +1324,14 @@ public:
 		if constexpr (requires { typename traits_type::comparison_category; }) return static_cast<traits_type::comparison_category>(s1.compare(s2) <=> 0);
 		else return static_cast<std::weak_ordering>(s1.compare(s2) <=> 0);
 	}
+	// strings with different inline capacities are compared through their views
+	template <std::size_t OtherCapacity> friend constexpr bool operator==(const_container_reference s1, const BasicString<value_type, traits_type, allocator_type, OtherCapacity>& s2) requires (OtherCapacity != InlineCapacity) {
+		return s1.compare(view_type(s2)) == 0;
+	}
+	template <std::size_t OtherCapacity> friend constexpr auto operator<=>(const_container_reference s1, const BasicString<value_type, traits_type, allocator_type, OtherCapacity>& s2) requires (OtherCapacity != InlineCapacity) {
+		if constexpr (requires { typename traits_type::comparison_category; }) return static_cast<traits_type::comparison_category>(s1.compare(view_type(s2)) <=> 0);
+		else return static_cast<std::weak_ordering>(s1.compare(view_type(s2)) <=> 0);
+	}
 
 	friend ostream_type& operator<<(ostream_type& stream, const_container_reference string) {
 		stream << string.cStr();
@@ -1297,6 +1362,18 @@ private:
 		return it - m_short.data;
 	}
 
+	static constexpr container concatenate(view_type first, view_type second, const_alloc_reference alloc) {
+		container result(allocator_traits::select_on_container_copy_construction(alloc));
+		result.resizeAndOverwrite(first.size() + second.size(), [first, second](pointer data, size_type size) {
+			traits_type::copy(data, first.data(), first.size());
+			traits_type::copy(data + first.size(), second.data(), second.size());
+
+			return size;
+		});
+
+		return result;
+	}
+
 	constexpr pointer pBegin() noexcept {
 		if (smallStringMode()) return m_short.data;
 		else return m_long.begin;
@@ -1317,7 +1394,7 @@ private:
 	constexpr void smartReserve(size_type size) noexcept {
 		auto cap = capacity();
 
-		if (size >= smallStringCap && size > cap) { // attempts to keep small string mode
+		if (size >= smallStringCap && (smallStringMode() ? size > cap : size >= cap)) { // attempts to keep small string mode, the capacity of long strings includes the null terminator
 			auto newCap = std::max(cap * 2, static_cast<size_type>(2)) - 2;
 			reserve((newCap < size) ? size : newCap);
 		}
@@ -1328,14 +1405,15 @@ private:
 		m_alloc = alloc;
 
 		if (first != last) {
-			auto count = last - first;
-			smartReserve(count);
+			auto count = static_cast<size_type>(last - first);
 
-			if (smallStringMode()) 
-				for (auto it = m_short.data; first != last; it++, first++) traits_type::assign(*it, *first);
+			if (smallStringMode() && count <= smallStringCap) // checked here instead of after smartReserve(), so the bounds of the small string copy are known
+				detail::copyRange(first, last, m_short.data);
 			else {
-				for (; first != last; first++, m_long.end++) allocator_traits::construct(m_alloc, m_long.end, *first);
-				allocator_traits::construct(m_alloc, m_long.end, '\0');
+				smartReserve(count);
+
+				m_long.end = detail::uninitializedCopy(m_alloc, first, last, m_long.end);
+				allocator_traits::construct(m_alloc, m_long.end, value_type { });
 			}
 		}
 
@@ -1346,14 +1424,14 @@ private:
 		auto oldSize = size();
 		auto newSize = oldSize + gapSize - eraseCount + 1;
 
-		if (smallStringMode() && (newSize < smallStringCap)) { // small string mode
+		if (smallStringMode() && (newSize <= smallStringCap + 1)) { // small string mode, newSize includes the null terminator
 			auto moveSrc = position + eraseCount;
 			auto moveDst = moveSrc + gapSize;
 
 			traits_type::move(moveDst, moveSrc, pEnd() - moveSrc + 1);
 
 			return { position, true };
-		} else if (smallStringMode() && (newSize >= smallStringCap)) {
+		} else if (smallStringMode()) {
 			auto index = position - m_short.data;
 
 			// reserve memory without constructing new memory, similar to smartReserve()
@@ -1362,21 +1440,11 @@ private:
 			auto newBegin = allocator_traits::allocate(m_alloc, reserveCount);
 			auto newEnd = newBegin + newSize - 1;
 
-			// prepare some iterators for the following parts
-			auto it = newBegin;
-			auto pos = it + index;
-			auto begIt = pBegin();
-
-			// re-construct the string in front of pos/position
-			for (; it < pos; it++, begIt++) // does not need extra check for validity of begin, since if the string was empty, it would be in small string mode
-				allocator_traits::construct(m_alloc, it, *begIt);
-
-			it += gapSize;
-			begIt += eraseCount;
+			auto pos = newBegin + index;
 
-			// reconstruct the remaining parts of the string
-			for (; it <= newEnd; it++, begIt++)
-				allocator_traits::construct(m_alloc, it, *begIt);
+			// re-construct the string in front of pos/position and the remaining parts of the string including the null terminator behind the gap
+			detail::uninitializedCopy(m_alloc, m_short.data, position, newBegin);
+			detail::uninitializedCopy(m_alloc, position + eraseCount, m_short.data + oldSize + 1, pos + gapSize);
 
 			// assign everything after initialization is finished
 			m_short.tag[0] = 0;
@@ -1400,21 +1468,11 @@ private:
 				m_long.end = m_long.begin + newSize - 1;
 				m_long.cap = m_long.begin + reserveCount;
 
-				// prepare some iterators for the following parts
 				auto pos = m_long.begin + index;
-				auto it = m_long.begin;
-				auto begIt = oldBegin;
 
-				// re-construct the string in front of pos/position
-				for (; it < pos; it++, begIt++) // does not need extra check for validity of begin, since if the string was empty, it would be in small string mode
-					allocator_traits::construct(m_alloc, it, *begIt);
-				
-				it += gapSize;
-				begIt += eraseCount;
-
-				// reconstruct the remaining parts of the string
-				for (; it <= m_long.end; it++, begIt++)
-					allocator_traits::construct(m_alloc, it, *begIt);
+				// re-construct the string in front of pos/position and the remaining parts of the string including the null terminator behind the gap
+				detail::uninitializedCopy(m_alloc, oldBegin, oldBegin + index, m_long.begin);
+				detail::uninitializedCopy(m_alloc, oldBegin + index + eraseCount, oldBegin + oldSize + 1, pos + gapSize);
 
 				allocator_traits::deallocate(m_alloc, oldBegin, cap);
 
@@ -1459,6 +1517,15 @@ using U8String = BasicString<char8_t>;
 using U16String = BasicString<char16_t>;
 using U32String = BasicString<char32_t>;
 
+/**
+ * @brief String storing at least Capacity characters inline before it allocates
+ *
+ * @details Larger inline buffers suit workloads dominated by medium sized strings like UUIDs and paths, at the cost of a larger object.
+ */
+template <class CharTy, std::size_t Capacity> using BasicInlineString = BasicString<CharTy, CharTraits<CharTy>, std::allocator<CharTy>, Capacity>;
+template <std::size_t Capacity> using InlineString = BasicInlineString<char, Capacity>;
+template <std::size_t Capacity> using WInlineString = BasicInlineString<wchar_t, Capacity>;
+
 
 inline namespace literals {
 
@@ -1485,8 +1552,8 @@ constexpr WString operator""_s(const wchar_t* str, std::size_t len) {
 } // inline namespace string_literals
 
 
-template <class C> struct Hash<BasicString<C>> {
-	using string_type = BasicString<C>;
+template <class C, std::size_t N> struct Hash<BasicString<C, CharTraits<C>, std::allocator<C>, N>> {
+	using string_type = BasicString<C, CharTraits<C>, std::allocator<C>, N>;
 
 	constexpr std::size_t operator()(const string_type& s) const noexcept { // uses the djb2 instead of murmur- or CityHash
 		std::size_t hash = 5381; 
@@ -1510,122 +1577,254 @@ template <class C> struct Hash<BasicString<C>> {
 };
 
 
+namespace detail {
+
+constexpr bool isNumberSpace(auto c) noexcept {
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// parses a number with the same syntax as the sto* family of functions, without depending on the locale or errno
+
+template <class Numerical, class CharTy> constexpr std::expected<Numerical, std::errc> parseNumber(BasicStringView<CharTy> str, std::size_t* pos, int base) {
+	auto begin = str.data();
+	auto end = begin + str.size();
+
+	auto it = begin;
+	while (it != end && isNumberSpace(*it)) ++it;
+
+	bool negative = false;
+	if (it != end && (*it == '+' || *it == '-')) negative = (*it++ == '-');
+
+	if (it == end || *it == '+' || *it == '-') return std::unexpected(std::errc::invalid_argument);
+
+	if constexpr (std::is_integral_v<Numerical>) {
+		using unsigned_type = std::make_unsigned_t<Numerical>;
+
+		if ((base == 0 || base == 16) && *it == '0' && end - it > 2 && (it[1] == 'x' || it[1] == 'X') && isHexDigit(it[2])) {
+			it += 2;
+			base = 16;
+		} else if (base == 0) 
+			base = (*it == '0') ? 8 : 10;
+
+		unsigned_type magnitude { };
+		auto res = fromChars(it, end, magnitude, base);
+		if (res.ec != std::errc { }) return std::unexpected(res.ec);
+
+		Numerical result { };
+		if constexpr (std::is_signed_v<Numerical>) {
+			constexpr auto max = static_cast<unsigned_type>(std::numeric_limits<Numerical>::max());
+			if (magnitude > max + negative) return std::unexpected(std::errc::result_out_of_range);
+
+			result = static_cast<Numerical>(negative ? unsigned_type(0) - magnitude : magnitude);
+		} else result = negative ? unsigned_type(0) - magnitude : magnitude; // unsigned negation wraps around, as with strtoul
+
+		if (pos) *pos = res.ptr - begin;
+		return result;
+	} else {
+		auto fmt = CharsFormat::general;
+		if (*it == '0' && end - it > 2 && (it[1] == 'x' || it[1] == 'X') && (isHexDigit(it[2]) || it[2] == '.')) { // hexadecimal floating point numbers, as accepted by strtod
+			it += 2;
+			fmt = CharsFormat::hex;
+		}
+
+		// long double is not supported by fromChars(), so every floating point type goes through the shared standard library conversion
+		Numerical result { };
+		auto res = standardFloatFromChars(it, end, result, fmt);
+		if (res.ec != std::errc { }) return std::unexpected(res.ec);
+
+		if (pos) *pos = res.ptr - begin;
+		return negative ? -result : result;
+	}
+}
+
+template <class Numerical, class CharTy> Numerical stringToNumber(BasicStringView<CharTy> str, std::size_t* pos, int base, const char* function) {
+	auto res = parseNumber<Numerical>(str, pos, base);
+
+	if (!res) {
+		if (res.error() == std::errc::result_out_of_range) LSD_THROW(std::out_of_range(std::string(function) + "(): Number exceeded type limits!"));
+		else LSD_THROW(std::invalid_argument(std::string(function) + "(): No valid conversion!"));
+	}
+
+	return *res;
+}
+
+// formats the number into a stack buffer of the worst case size first, so the string only allocates if the result does not fit inline
+
+template <class String, class Numerical> String numberToString(Numerical value) {
+	typename String::value_type buffer[toCharsMaxSize<Numerical>];
+	auto count = static_cast<std::size_t>(toChars(buffer, buffer + toCharsMaxSize<Numerical>, value).ptr - buffer);
+
+	return String(buffer, std::min(count, toCharsMaxSize<Numerical>)); // toChars() never writes past the buffer, the bound lets the compiler see that as well
+}
+
+} // namespace detail
+
+
 [[nodiscard]] inline int stoi(const String& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<int>(std::strtol, pos, base);
+	return detail::stringToNumber<int>(StringView(str), pos, base, "lsd::stoi");
 }
 [[nodiscard]] inline int stoi(const WString& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<int>(std::wcstol, pos, base);
+	return detail::stringToNumber<int>(WStringView(str), pos, base, "lsd::stoi");
 }
 [[nodiscard]] inline long stol(const String& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long>(std::strtol, pos, base);
+	return detail::stringToNumber<long>(StringView(str), pos, base, "lsd::stol");
 }
 [[nodiscard]] inline long stol(const WString& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long>(std::wcstol, pos, base);
+	return detail::stringToNumber<long>(WStringView(str), pos, base, "lsd::stol");
 }
 [[nodiscard]] inline long long stoll(const String& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long long>(std::strtoll, pos, base);
+	return detail::stringToNumber<long long>(StringView(str), pos, base, "lsd::stoll");
 }
 [[nodiscard]] inline long long stoll(const WString& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long long>(std::wcstoll, pos, base);
+	return detail::stringToNumber<long long>(WStringView(str), pos, base, "lsd::stoll");
 }
-
-[[nodiscard]] inline long stoul(const String& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long>(std::strtoul, pos, base);
+[[nodiscard]] inline unsigned long stoul(const String& str, std::size_t* pos = nullptr, int base = 10) {
+	return detail::stringToNumber<unsigned long>(StringView(str), pos, base, "lsd::stoul");
 }
-[[nodiscard]] inline long stoul(const WString& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long>(std::wcstoul, pos, base);
+[[nodiscard]] inline unsigned long stoul(const WString& str, std::size_t* pos = nullptr, int base = 10) {
+	return detail::stringToNumber<unsigned long>(WStringView(str), pos, base, "lsd::stoul");
 }
-[[nodiscard]] inline long long stoull(const String& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long long>(std::strtoull, pos, base);
+[[nodiscard]] inline unsigned long long stoull(const String& str, std::size_t* pos = nullptr, int base = 10) {
+	return detail::stringToNumber<unsigned long long>(StringView(str), pos, base, "lsd::stoull");
 }
-[[nodiscard]] inline long long stoull(const WString& str, std::size_t* pos = nullptr, int base = 10) {
-	return str.castTo<long long>(std::wcstoull, pos, base);
+[[nodiscard]] inline unsigned long long stoull(const WString& str, std::size_t* pos = nullptr, int base = 10) {
+	return detail::stringToNumber<unsigned long long>(WStringView(str), pos, base, "lsd::stoull");
 }
 
-[[nodiscard]] inline float stof (const String& str, std::size_t* pos = nullptr) {
-	return str.castTo<float>(std::strtof, pos);
+[[nodiscard]] inline float stof(const String& str, std::size_t* pos = nullptr) {
+	return detail::stringToNumber<float>(StringView(str), pos, 10, "lsd::stof");
 }
-[[nodiscard]] inline float stof (const WString& str, std::size_t* pos = nullptr) {
-	return str.castTo<float>(std::wcstof, pos);
+[[nodiscard]] inline float stof(const WString& str, std::size_t* pos = nullptr) {
+	return detail::stringToNumber<float>(WStringView(str), pos, 10, "lsd::stof");
 }
-[[nodiscard]] inline double stod (const String& str, std::size_t* pos = nullptr) {
-	return str.castTo<double>(std::strtod, pos);
+[[nodiscard]] inline double stod(const String& str, std::size_t* pos = nullptr) {
+	return detail::stringToNumber<double>(StringView(str), pos, 10, "lsd::stod");
 }
-[[nodiscard]] inline double stod (const WString& str, std::size_t* pos = nullptr) {
-	return str.castTo<double>(std::wcstod, pos);
+[[nodiscard]] inline double stod(const WString& str, std::size_t* pos = nullptr) {
+	return detail::stringToNumber<double>(WStringView(str), pos, 10, "lsd::stod");
 }
 [[nodiscard]] inline long double stold(const String& str, std::size_t* pos = nullptr) {
-	return str.castTo<long double>(std::strtold, pos);
+	return detail::stringToNumber<long double>(StringView(str), pos, 10, "lsd::stold");
 }
 [[nodiscard]] inline long double stold(const WString& str, std::size_t* pos = nullptr) {
-	return str.castTo<long double>(std::wcstold, pos);
+	return detail::stringToNumber<long double>(WStringView(str), pos, 10, "lsd::stold");
+}
+
+[[nodiscard]] constexpr std::expected<int, std::errc> tryStoi(const String& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<int>(StringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<int, std::errc> tryStoi(const WString& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<int>(WStringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<long, std::errc> tryStol(const String& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<long>(StringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<long, std::errc> tryStol(const WString& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<long>(WStringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<long long, std::errc> tryStoll(const String& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<long long>(StringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<long long, std::errc> tryStoll(const WString& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<long long>(WStringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<unsigned long, std::errc> tryStoul(const String& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<unsigned long>(StringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<unsigned long, std::errc> tryStoul(const WString& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<unsigned long>(WStringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<unsigned long long, std::errc> tryStoull(const String& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<unsigned long long>(StringView(str), pos, base);
+}
+[[nodiscard]] constexpr std::expected<unsigned long long, std::errc> tryStoull(const WString& str, std::size_t* pos = nullptr, int base = 10) noexcept {
+	return detail::parseNumber<unsigned long long>(WStringView(str), pos, base);
+}
+
+[[nodiscard]] inline std::expected<float, std::errc> tryStof(const String& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<float>(StringView(str), pos, 10);
+}
+[[nodiscard]] inline std::expected<float, std::errc> tryStof(const WString& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<float>(WStringView(str), pos, 10);
+}
+[[nodiscard]] inline std::expected<double, std::errc> tryStod(const String& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<double>(StringView(str), pos, 10);
+}
+[[nodiscard]] inline std::expected<double, std::errc> tryStod(const WString& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<double>(WStringView(str), pos, 10);
+}
+[[nodiscard]] inline std::expected<long double, std::errc> tryStold(const String& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<long double>(StringView(str), pos, 10);
+}
+[[nodiscard]] inline std::expected<long double, std::errc> tryStold(const WString& str, std::size_t* pos = nullptr) noexcept {
+	return detail::parseNumber<long double>(WStringView(str), pos, 10);
 }
 
 
 [[nodiscard]] inline String toString(int value) {
-	return String::castFrom<int, SIGNED_SCALAR_DIGITS(int)>(value, "%i");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(long value) {
-	return String::castFrom<long, SIGNED_SCALAR_DIGITS(long)>(value, "%li");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(long long value) {
-	return String::castFrom<long long, SIGNED_SCALAR_DIGITS(long long)>(value, "%lli");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(unsigned value) {
-	return String::castFrom<unsigned, UNSIGNED_SCALAR_DIGITS(unsigned)>(value, "%u");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(unsigned long value) {
-	return String::castFrom<unsigned long, UNSIGNED_SCALAR_DIGITS(unsigned long)>(value, "%lu");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(unsigned long long value) {
-	return String::castFrom<unsigned long long, UNSIGNED_SCALAR_DIGITS(unsigned)>(value, "%llu");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(float value) {
-	return String::castFrom<float, sizeof(float) * 8 + 1>(value, "%g");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(double value) {
-	return String::castFrom<double, sizeof(double) * 8 + 1>(value, "%g");
+	return detail::numberToString<String>(value);
 }
 [[nodiscard]] inline String toString(long double value) {
-	return String::castFrom<long double, sizeof(long double) * 8 + 1>(value, "%g");
+	return detail::numberToString<String>(value);
 }
 
 [[nodiscard]] inline WString toWString(int value) {
-	return WString::castFrom<int, SIGNED_SCALAR_DIGITS(int)>(value, L"%i");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(long value) {
-	return WString::castFrom<long, SIGNED_SCALAR_DIGITS(long)>(value, L"%li");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(long long value) {
-	return WString::castFrom<long long, SIGNED_SCALAR_DIGITS(long long)>(value, L"%lli");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(unsigned value) {
-	return WString::castFrom<unsigned, UNSIGNED_SCALAR_DIGITS(unsigned)>(value, L"%u");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(unsigned long value) {
-	return WString::castFrom<unsigned long, UNSIGNED_SCALAR_DIGITS(unsigned long)>(value, L"%lu");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(unsigned long long value) {
-	return WString::castFrom<unsigned long long, UNSIGNED_SCALAR_DIGITS(unsigned)>(value, L"%llu");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(float value) {
-	return WString::castFrom<float, sizeof(float) * 8 + 1>(value, L"%g");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(double value) {
-	return WString::castFrom<double, sizeof(double) * 8 + 1>(value, L"%g");
+	return detail::numberToString<WString>(value);
 }
 [[nodiscard]] inline WString toWString(long double value) {
-	return WString::castFrom<long double, sizeof(long double) * 8 + 1>(value, L"%g");
+	return detail::numberToString<WString>(value);
 }
 template <EnumType Enum> [[nodiscard]] inline String toString(Enum e) {
 	return lsd::toString(static_cast<std::underlying_type_t<Enum>>(e));
 }
 template <EnumType Enum> [[nodiscard]] inline WString toWString(Enum e) {
-	return lsd::toString(static_cast<std::underlying_type_t<Enum>>(e));
+	return lsd::toWString(static_cast<std::underlying_type_t<Enum>>(e));
 }
 
 
-template <class CharTy, class Traits, class Alloc> auto quoted(const lsd::BasicString<CharTy, Traits, Alloc>& str, CharTy delim = CharTy('"'), CharTy escape = CharTy('\\')) {
+template <class CharTy, class Traits, class Alloc, std::size_t N> auto quoted(const lsd::BasicString<CharTy, Traits, Alloc, N>& str, CharTy delim = CharTy('"'), CharTy escape = CharTy('\\')) {
 	return quoted(str.data(), delim, escape);
 }
 
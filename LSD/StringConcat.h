@@ -0,0 +1,144 @@
+/*************************
+ * @file StringConcat.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Concatenating strings, characters and numbers with a single allocation
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "String.h"
+#include "StringView.h"
+#include "ToChars.h"
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace lsd {
+
+namespace detail {
+
+template <class Ty> inline constexpr bool isConcatCharacter =
+	std::is_same_v<Ty, char> ||
+	std::is_same_v<Ty, wchar_t> ||
+	std::is_same_v<Ty, char8_t> ||
+	std::is_same_v<Ty, char16_t> ||
+	std::is_same_v<Ty, char32_t>;
+
+// the character type of a concatenation is wchar_t as soon as one argument is wide
+
+template <class Arg> inline constexpr bool isWideConcatArgument = std::is_same_v<Arg, wchar_t> || std::is_convertible_v<const Arg&, BasicStringView<wchar_t>>;
+template <class... Args> using ConcatCharType = std::conditional_t<(isWideConcatArgument<Args> || ...), wchar_t, char>;
+
+
+// pieces know their exact size before anything is written
+
+template <class CharTy> struct ConcatViewPiece {
+	BasicStringView<CharTy> view;
+
+	constexpr std::size_t size() const noexcept {
+		return view.size();
+	}
+	constexpr CharTy* write(CharTy* out) const noexcept {
+		CharTraits<CharTy>::copy(out, view.data(), view.size());
+		return out + view.size();
+	}
+};
+
+template <class CharTy> struct ConcatCharPiece {
+	CharTy character;
+
+	constexpr std::size_t size() const noexcept {
+		return 1;
+	}
+	constexpr CharTy* write(CharTy* out) const noexcept {
+		*out = character;
+		return out + 1;
+	}
+};
+
+template <class CharTy, class Numerical> struct ConcatNumberPiece { // numbers are formatted into a local buffer first, so their length is known
+	CharTy buffer[toCharsMaxSize<Numerical>];
+	std::size_t length;
+
+	constexpr ConcatNumberPiece(Numerical value) : length(static_cast<std::size_t>(toChars(buffer, buffer + toCharsMaxSize<Numerical>, value).ptr - buffer)) { }
+
+	constexpr std::size_t size() const noexcept {
+		return length;
+	}
+	constexpr CharTy* write(CharTy* out) const noexcept {
+		CharTraits<CharTy>::copy(out, buffer, length);
+		return out + length;
+	}
+};
+
+template <class CharTy, class Arg> constexpr auto makeConcatPiece(const Arg& arg) {
+	static_assert(!std::is_same_v<Arg, bool>, "lsd::concat(): Booleans are not supported!");
+
+	if constexpr (isConcatCharacter<Arg>) {
+		static_assert(std::is_same_v<Arg, CharTy>, "lsd::concat(): Character type does not match the character type of the string!");
+		return ConcatCharPiece<CharTy> { arg };
+	} else if constexpr (std::is_arithmetic_v<Arg>) return ConcatNumberPiece<CharTy, Arg>(arg);
+	else {
+		static_assert(std::is_convertible_v<const Arg&, BasicStringView<CharTy>>, "lsd::concat(): Argument is neither a string, a character nor a number!");
+		return ConcatViewPiece<CharTy> { BasicStringView<CharTy>(arg) };
+	}
+}
+
+template <class String, class... Pieces> constexpr void appendConcatPieces(String& out, const Pieces&... pieces) {
+	auto oldSize = out.size();
+	auto newSize = (oldSize + ... + pieces.size());
+
+	if (newSize > out.capacity()) out.reserve(std::max(newSize, out.capacity() * 2)); // keeps appending in a loop amortized
+
+	out.resizeAndOverwrite(newSize, [oldSize, &pieces...](typename String::value_type* data, std::size_t size) {
+		data += oldSize;
+		((data = pieces.write(data)), ...);
+
+		return size;
+	});
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Concatenate strings, string views, C strings, characters and numbers into a new string
+ *
+ * @details The arguments are measured first, so the result is allocated exactly once. Numbers are written in base 10 or in their shortest round trip representation.
+ * The result is a wide string if any argument is wide.
+ *
+ * @param args arguments to concatenate
+ *
+ * @return The concatenated string
+ */
+template <class... Args> [[nodiscard]] constexpr BasicString<detail::ConcatCharType<Args...>> concat(const Args&... args) {
+	using char_type = detail::ConcatCharType<Args...>;
+
+	BasicString<char_type> result;
+	detail::appendConcatPieces(result, detail::makeConcatPiece<char_type>(args)...);
+
+	return result;
+}
+
+/**
+ * @brief Append the concatenation of the arguments to a string, growing it at most once
+ *
+ * @details Reusing the same string in a loop avoids allocating for every concatenation.
+ *
+ * @param out string to append to
+ * @param args arguments to concatenate, which may not refer to out
+ *
+ * @return Reference to out
+ */
+template <class CharTy, class Traits, class Alloc, std::size_t N, class... Args> constexpr BasicString<CharTy, Traits, Alloc, N>& appendConcat(BasicString<CharTy, Traits, Alloc, N>& out, const Args&... args) {
+	detail::appendConcatPieces(out, detail::makeConcatPiece<CharTy>(args)...);
+	return out;
+}
+
+} // namespace lsd
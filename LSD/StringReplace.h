@@ -0,0 +1,254 @@
+/*************************
+ * @file StringReplace.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Replacing every occurence of one or many substrings in a single pass
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Vector.h"
+#include "String.h"
+#include "StringView.h"
+#include "MultiSearcher.h"
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+
+namespace lsd {
+
+namespace detail {
+
+struct ReplaceMatch {
+	std::size_t position;
+	std::size_t length;
+	std::size_t replacement;
+};
+
+/**
+ * Rewrites a string from a list of non overlapping matches sorted by position.
+ * The string is rewritten in place from the front if no replacement before any point made the string longer and from the back if none made it shorter,
+ * otherwise the result is written into a new string.
+ */
+template <class String, class Replacements> void applyReplacements(String& string, const Vector<ReplaceMatch>& matches, const Replacements& replacements) {
+	using value_type = typename String::value_type;
+	using traits_type = typename String::traits_type;
+
+	auto oldSize = string.size();
+	auto newSize = oldSize;
+	bool canShrinkInPlace = true, canGrowInPlace = true;
+
+	for (const auto& m : matches) {
+		newSize = newSize - m.length + replacements[m.replacement].size();
+
+		if (newSize > oldSize) canShrinkInPlace = false;
+		if (newSize < oldSize) canGrowInPlace = false;
+	}
+
+	if (canShrinkInPlace) {
+		auto data = string.data();
+		std::size_t read = 0, write = 0;
+
+		for (const auto& m : matches) {
+			const auto& to = replacements[m.replacement];
+
+			traits_type::move(data + write, data + read, m.position - read);
+			write += m.position - read;
+			traits_type::copy(data + write, to.data(), to.size());
+			write += to.size();
+			read = m.position + m.length;
+		}
+
+		traits_type::move(data + write, data + read, oldSize - read);
+		string.resize(newSize);
+	} else if (canGrowInPlace) {
+		string.resizeAndOverwrite(newSize, [&matches, &replacements, oldSize](value_type* data, std::size_t size) {
+			auto read = oldSize, write = size;
+
+			for (auto it = matches.rbegin(); it != matches.rend(); it++) {
+				const auto& to = replacements[it->replacement];
+				auto tail = read - (it->position + it->length);
+
+				write -= tail;
+				traits_type::move(data + write, data + it->position + it->length, tail);
+				write -= to.size();
+				traits_type::copy(data + write, to.data(), to.size());
+				read = it->position;
+			}
+
+			return size;
+		});
+	} else {
+		String result;
+		result.resizeAndOverwrite(newSize, [&matches, &replacements, &string, oldSize](value_type* data, std::size_t size) {
+			auto source = string.data();
+			std::size_t read = 0;
+
+			for (const auto& m : matches) {
+				const auto& to = replacements[m.replacement];
+
+				traits_type::copy(data, source + read, m.position - read);
+				data += m.position - read;
+				traits_type::copy(data, to.data(), to.size());
+				data += to.size();
+				read = m.position + m.length;
+			}
+
+			traits_type::copy(data, source + read, oldSize - read);
+			return size;
+		});
+
+		string = std::move(result);
+	}
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Replace a fixed set of substrings, built once and applied to many strings
+ *
+ * @details The string is scanned once for all patterns at the same time with a MultiSearcher, at each position the longest pattern wins and replaced text is never searched again.
+ * The result is built in place whenever the replacements allow it.
+ *
+ * @tparam CharTy character type, has to be one byte wide like for BasicMultiSearcher
+ */
+template <class CharTy> class BasicStringReplacer {
+public:
+	static_assert(sizeof(CharTy) == 1, "lsd::BasicStringReplacer: Only single byte character types are supported!");
+
+	using value_type = CharTy;
+	using size_type = std::size_t;
+	using view_type = BasicStringView<value_type>;
+	using string_type = BasicString<value_type>;
+	using pair_type = std::pair<view_type, view_type>;
+
+	/**
+	 * @brief Construct the replacer from pairs of patterns and their replacements
+	 *
+	 * @param replacements pairs of a pattern and its replacement, empty patterns are ignored and of identical patterns the first is used
+	 */
+	BasicStringReplacer(std::initializer_list<pair_type> replacements) : BasicStringReplacer(replacements.begin(), replacements.end()) { }
+	template <class Range> explicit BasicStringReplacer(const Range& replacements) requires requires(const Range& r) { pair_type(*std::begin(r)); } :
+		BasicStringReplacer(std::begin(replacements), std::end(replacements)) { }
+
+	/**
+	 * @brief Replace every occurence of the patterns in a string
+	 *
+	 * @param string string to modify
+	 *
+	 * @return Reference to the string
+	 */
+	template <class Traits, class Alloc, std::size_t N> BasicString<value_type, Traits, Alloc, N>& apply(BasicString<value_type, Traits, Alloc, N>& string) const {
+		Vector<detail::ReplaceMatch> matches;
+		m_finder.findLeftmostLongest(view_type(string.data(), string.size()), [&matches](const MultiSearchMatch& m) {
+			matches.pushBack({ m.position, m.length, m.pattern });
+		});
+
+		if (!matches.empty()) detail::applyReplacements(string, matches, m_replacements);
+
+		return string;
+	}
+	/**
+	 * @brief Copy a text with every occurence of the patterns replaced
+	 */
+	[[nodiscard]] string_type replaced(view_type text) const {
+		string_type result(text);
+		apply(result);
+
+		return result;
+	}
+
+private:
+	Vector<string_type> m_replacements;
+	BasicMultiSearcher<value_type> m_finder;
+
+	template <class It> BasicStringReplacer(It first, It last) : m_finder(patternsOf(first, last)) {
+		for (; first != last; ++first) m_replacements.emplaceBack(pair_type(*first).second);
+	}
+
+	template <class It> [[nodiscard]] static Vector<view_type> patternsOf(It first, It last) {
+		Vector<view_type> patterns;
+		for (; first != last; ++first) patterns.pushBack(pair_type(*first).first);
+
+		return patterns;
+	}
+};
+
+using StringReplacer = BasicStringReplacer<char>;
+
+
+/**
+ * @brief Replace every occurence of a substring in a single pass
+ *
+ * @details Occurences are replaced from left to right without overlapping and the replacement is never searched again.
+ * The string is rewritten in place if the replacement is not longer than the pattern, otherwise it grows at most once.
+ *
+ * @param string string to modify
+ * @param from substring to replace, nothing is replaced if it is empty
+ * @param to replacement
+ *
+ * @return Reference to the string
+ */
+template <class CharTy, class Traits, class Alloc, std::size_t N> BasicString<CharTy, Traits, Alloc, N>& replaceAll(
+	BasicString<CharTy, Traits, Alloc, N>& string,
+	std::type_identity_t<BasicStringView<CharTy, Traits>> from,
+	std::type_identity_t<BasicStringView<CharTy, Traits>> to
+) {
+	using view_type = BasicStringView<CharTy, Traits>;
+
+	if (from.empty()) return string;
+
+	view_type text(string.data(), string.size());
+	auto pos = text.find(from);
+	if (pos == view_type::npos) return string;
+
+	if (to.size() <= from.size()) { // the string never grows, so it is rewritten in a single pass
+		auto data = string.data();
+		std::size_t read = 0, write = 0;
+
+		for (; pos != view_type::npos; pos = text.find(from, read)) {
+			Traits::move(data + write, data + read, pos - read);
+			write += pos - read;
+			Traits::copy(data + write, to.data(), to.size());
+			write += to.size();
+			read = pos + from.size();
+		}
+
+		Traits::move(data + write, data + read, text.size() - read);
+		string.resize(write + text.size() - read);
+	} else {
+		Vector<detail::ReplaceMatch> matches;
+		for (; pos != view_type::npos; pos = text.find(from, pos + from.size())) matches.pushBack({ pos, from.size(), 0 });
+
+		view_type replacements[1] { to };
+		detail::applyReplacements(string, matches, replacements);
+	}
+
+	return string;
+}
+
+/**
+ * @brief Replace every occurence of multiple substrings in a single pass
+ *
+ * @details See BasicStringReplacer, which should be constructed once instead if the same replacements are applied to many strings
+ *
+ * @param string string to modify
+ * @param replacements pairs of a pattern and its replacement
+ *
+ * @return Reference to the string
+ */
+template <class CharTy, class Traits, class Alloc, std::size_t N> BasicString<CharTy, Traits, Alloc, N>& replaceMany(
+	BasicString<CharTy, Traits, Alloc, N>& string,
+	std::type_identity_t<std::initializer_list<std::pair<BasicStringView<CharTy>, BasicStringView<CharTy>>>> replacements
+) {
+	return BasicStringReplacer<CharTy>(replacements).apply(string);
+}
+
+} // namespace lsd
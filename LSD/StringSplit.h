@@ -0,0 +1,358 @@
+/*************************
+ * @file StringSplit.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Lazy ranges splitting strings into string views
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Iterators.h"
+#include "String.h"
+#include "StringView.h"
+
+#include <cstdint>
+#include <climits>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+namespace lsd {
+
+namespace detail {
+
+// delimiters return the position and length of the next separator at or after pos, or npos if there is none
+
+template <class View> struct SplitCharDelimiter {
+	using view_type = View;
+	using value_type = typename view_type::value_type;
+	using size_type = typename view_type::size_type;
+
+	static constexpr bool skipEmpty = false;
+	static constexpr bool skipTrailingEmpty = false;
+
+	value_type delimiter;
+
+	constexpr std::pair<size_type, size_type> find(view_type source, size_type pos) const noexcept {
+		return { source.find(delimiter, pos), 1 };
+	}
+	constexpr view_type trim(view_type field) const noexcept {
+		return field;
+	}
+};
+
+template <class View> struct SplitStringDelimiter {
+	using view_type = View;
+	using size_type = typename view_type::size_type;
+
+	static constexpr bool skipEmpty = false;
+	static constexpr bool skipTrailingEmpty = false;
+
+	view_type delimiter;
+
+	constexpr std::pair<size_type, size_type> find(view_type source, size_type pos) const noexcept {
+		if (delimiter.empty()) return { (pos + 1 < source.size()) ? pos + 1 : view_type::npos, 0 }; // an empty delimiter splits into single characters
+
+		return { source.find(delimiter, pos), delimiter.size() };
+	}
+	constexpr view_type trim(view_type field) const noexcept {
+		return field;
+	}
+};
+
+template <class View> struct SplitAnyDelimiter {
+	using view_type = View;
+	using value_type = typename view_type::value_type;
+	using size_type = typename view_type::size_type;
+
+	static constexpr bool skipEmpty = false;
+	static constexpr bool skipTrailingEmpty = false;
+
+	static constexpr bool useTable = sizeof(value_type) == 1; // narrow characters are looked up in a bitmap instead of the set
+
+	view_type delimiters;
+	std::uint64_t table[4] { };
+
+	constexpr SplitAnyDelimiter(view_type set) noexcept : delimiters(set) {
+		if constexpr (useTable)
+			for (auto c : set) table[static_cast<unsigned char>(c) >> 6] |= std::uint64_t(1) << (static_cast<unsigned char>(c) & 63);
+	}
+
+	constexpr bool contains(value_type c) const noexcept {
+		if constexpr (useTable) return (table[static_cast<unsigned char>(c) >> 6] >> (static_cast<unsigned char>(c) & 63)) & 1;
+		else {
+			for (auto d : delimiters) if (d == c) return true;
+			return false;
+		}
+	}
+
+	constexpr std::pair<size_type, size_type> find(view_type source, size_type pos) const noexcept {
+		if (delimiters.size() == 1) return { source.find(delimiters.front(), pos), 1 };
+
+		for (auto it = source.data() + pos, end = source.data() + source.size(); it != end; it++)
+			if (contains(*it)) return { static_cast<size_type>(it - source.data()), 1 };
+
+		return { view_type::npos, 1 };
+	}
+	constexpr view_type trim(view_type field) const noexcept {
+		return field;
+	}
+};
+
+template <class View> struct LinesDelimiter {
+	using view_type = View;
+	using size_type = typename view_type::size_type;
+
+	static constexpr bool skipEmpty = false;
+	static constexpr bool skipTrailingEmpty = true;
+
+	constexpr std::pair<size_type, size_type> find(view_type source, size_type pos) const noexcept {
+		return { source.find('\n', pos), 1 };
+	}
+	constexpr view_type trim(view_type field) const noexcept {
+		if (!field.empty() && field.back() == '\r') field.removeSuffix(1);
+		return field;
+	}
+};
+
+template <class View, class Predicate> struct TokenizeDelimiter {
+	using view_type = View;
+	using size_type = typename view_type::size_type;
+
+	static constexpr bool skipEmpty = true;
+	static constexpr bool skipTrailingEmpty = true;
+
+	Predicate predicate;
+
+	constexpr std::pair<size_type, size_type> find(view_type source, size_type pos) const {
+		for (auto it = source.data() + pos, end = source.data() + source.size(); it != end; it++)
+			if (predicate(*it)) return { static_cast<size_type>(it - source.data()), 1 };
+
+		return { view_type::npos, 1 };
+	}
+	constexpr view_type trim(view_type field) const noexcept {
+		return field;
+	}
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Lazy range over the fields of a string, separated by a delimiter
+ *
+ * @details The fields are views into the source string, so nothing is allocated while iterating, but the source has to outlive the range.
+ *
+ * @tparam View string view type
+ * @tparam Delimiter delimiter searching for the separators
+ */
+template <class View, class Delimiter> class BasicSplitRange {
+public:
+	using view_type = View;
+	using size_type = typename view_type::size_type;
+	using delimiter_type = Delimiter;
+
+	static constexpr size_type npos = view_type::npos;
+
+	class Iterator {
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::input_iterator_tag; // the fields are returned by value, which only the C++20 iterator concepts allow for forward iterators
+		using value_type = view_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const view_type*;
+		using reference = view_type;
+
+		constexpr Iterator() noexcept = default;
+
+		[[nodiscard]] constexpr reference operator*() const noexcept {
+			return m_field;
+		}
+		[[nodiscard]] constexpr pointer operator->() const noexcept {
+			return &m_field;
+		}
+
+		constexpr Iterator& operator++() {
+			advance();
+			return *this;
+		}
+		constexpr Iterator operator++(int) {
+			auto r = *this;
+			advance();
+			return r;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const Iterator& first, const Iterator& second) noexcept {
+			if (!first.m_range || !second.m_range) return first.m_range == second.m_range;
+			return first.m_field.data() == second.m_field.data() && first.m_next == second.m_next;
+		}
+
+	private:
+		const BasicSplitRange* m_range = nullptr; // null for the end iterator
+		view_type m_field;
+		size_type m_next = 0;
+
+		constexpr Iterator(const BasicSplitRange* range) : m_range(range) {
+			advance();
+		}
+
+		constexpr void advance() {
+			const auto& source = m_range->m_source;
+
+			while (true) {
+				if (m_next == npos) {
+					m_range = nullptr;
+					return;
+				}
+
+				auto start = m_next;
+				auto [match, length] = m_range->m_delimiter.find(source, start);
+
+				if (match == npos) {
+					m_field = view_type(source.data() + start, source.size() - start);
+					m_next = npos;
+				} else {
+					m_field = view_type(source.data() + start, match - start);
+					m_next = match + length;
+				}
+
+				if (m_field.empty() && (delimiter_type::skipEmpty || (delimiter_type::skipTrailingEmpty && match == npos))) continue;
+
+				m_field = m_range->m_delimiter.trim(m_field);
+				return;
+			}
+		}
+
+		friend class BasicSplitRange;
+	};
+
+	using iterator = Iterator;
+	using const_iterator = Iterator;
+
+	constexpr BasicSplitRange(view_type source, delimiter_type delimiter) : m_source(source), m_delimiter(std::move(delimiter)) { }
+
+	[[nodiscard]] constexpr iterator begin() const {
+		return Iterator(this);
+	}
+	[[nodiscard]] constexpr iterator end() const noexcept {
+		return Iterator();
+	}
+
+	/**
+	 * @brief Check if the range has no fields
+	 */
+	[[nodiscard]] constexpr bool empty() const {
+		return begin() == end();
+	}
+	/**
+	 * @brief Count the fields, which walks the whole range
+	 */
+	[[nodiscard]] constexpr size_type count() const {
+		size_type n = 0;
+		for (auto it = begin(); it != end(); it++) n++;
+
+		return n;
+	}
+
+private:
+	view_type m_source;
+	[[no_unique_address]] delimiter_type m_delimiter;
+};
+
+
+/**
+ * @brief Split a string at every occurence of a character, keeping empty fields
+ *
+ * @details An empty string consists of a single empty field
+ *
+ * @param source string to split
+ * @param delimiter separating character
+ *
+ * @return Range of views of the fields
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr auto split(BasicStringView<CharTy, Traits> source, std::type_identity_t<CharTy> delimiter) {
+	using view_type = BasicStringView<CharTy, Traits>;
+	return BasicSplitRange<view_type, detail::SplitCharDelimiter<view_type>>(source, { delimiter });
+}
+/**
+ * @brief Split a string at every occurence of a substring, keeping empty fields
+ *
+ * @details An empty string consists of a single empty field
+ *
+ * @param source string to split
+ * @param delimiter separating substring, an empty delimiter splits the string into single characters
+ *
+ * @return Range of views of the fields
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr auto split(BasicStringView<CharTy, Traits> source, std::type_identity_t<BasicStringView<CharTy, Traits>> delimiter) {
+	using view_type = BasicStringView<CharTy, Traits>;
+	return BasicSplitRange<view_type, detail::SplitStringDelimiter<view_type>>(source, { delimiter });
+}
+/**
+ * @brief Split a string at every character contained in a set, keeping empty fields
+ *
+ * @details An empty string consists of a single empty field
+ *
+ * @param source string to split
+ * @param delimiters set of separating characters
+ *
+ * @return Range of views of the fields
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr auto splitAny(BasicStringView<CharTy, Traits> source, std::type_identity_t<BasicStringView<CharTy, Traits>> delimiters) {
+	using view_type = BasicStringView<CharTy, Traits>;
+	return BasicSplitRange<view_type, detail::SplitAnyDelimiter<view_type>>(source, detail::SplitAnyDelimiter<view_type>(delimiters));
+}
+/**
+ * @brief Split a string into its lines
+ *
+ * @details Lines are separated by "\n" or "\r\n", a line break at the end of the string does not start another line
+ *
+ * @param source string to split
+ *
+ * @return Range of views of the lines, without their line breaks
+ */
+template <class CharTy, class Traits> [[nodiscard]] constexpr auto lines(BasicStringView<CharTy, Traits> source) {
+	using view_type = BasicStringView<CharTy, Traits>;
+	return BasicSplitRange<view_type, detail::LinesDelimiter<view_type>>(source, { });
+}
+/**
+ * @brief Split a string into tokens separated by runs of characters matching a predicate
+ *
+ * @param source string to split
+ * @param isSeparator predicate returning true for separating characters
+ *
+ * @return Range of views of the tokens, which are never empty
+ */
+template <class CharTy, class Traits, class Predicate> [[nodiscard]] constexpr auto tokenize(BasicStringView<CharTy, Traits> source, Predicate isSeparator) {
+	using view_type = BasicStringView<CharTy, Traits>;
+	return BasicSplitRange<view_type, detail::TokenizeDelimiter<view_type, Predicate>>(source, { std::move(isSeparator) });
+}
+
+
+// overloads for strings, which may not be temporaries since the fields point into them
+
+template <class CharTy, class Traits, class Alloc, std::size_t N, class Delimiter> [[nodiscard]] constexpr auto split(const BasicString<CharTy, Traits, Alloc, N>& source, const Delimiter& delimiter) {
+	return split(BasicStringView<CharTy, Traits>(source), delimiter);
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N, class Delimiter> constexpr auto split(BasicString<CharTy, Traits, Alloc, N>&&, const Delimiter&) = delete;
+
+template <class CharTy, class Traits, class Alloc, std::size_t N> [[nodiscard]] constexpr auto splitAny(const BasicString<CharTy, Traits, Alloc, N>& source, std::type_identity_t<BasicStringView<CharTy, Traits>> delimiters) {
+	return splitAny(BasicStringView<CharTy, Traits>(source), delimiters);
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N> constexpr auto splitAny(BasicString<CharTy, Traits, Alloc, N>&&, std::type_identity_t<BasicStringView<CharTy, Traits>>) = delete;
+
+template <class CharTy, class Traits, class Alloc, std::size_t N> [[nodiscard]] constexpr auto lines(const BasicString<CharTy, Traits, Alloc, N>& source) {
+	return lines(BasicStringView<CharTy, Traits>(source));
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N> constexpr auto lines(BasicString<CharTy, Traits, Alloc, N>&&) = delete;
+
+template <class CharTy, class Traits, class Alloc, std::size_t N, class Predicate> [[nodiscard]] constexpr auto tokenize(const BasicString<CharTy, Traits, Alloc, N>& source, Predicate isSeparator) {
+	return tokenize(BasicStringView<CharTy, Traits>(source), std::move(isSeparator));
+}
+template <class CharTy, class Traits, class Alloc, std::size_t N, class Predicate> constexpr auto tokenize(BasicString<CharTy, Traits, Alloc, N>&&, Predicate) = delete;
+
+} // namespace lsd
@@ -14,6 +14,7 @@
 #include "Hash.h"
 #include "Iterators.h"
 #include "CharTraits.h"
+#include "Detail/CoreUtility.h"
 
 #include <cstdlib>
 #include <cassert>
@@ -125,13 +126,13 @@ public:
 	}
 
 	constexpr size_type copy(pointer dest, size_type count, size_type pos = 0) const {
-		if (pos > size()) throw std::out_of_range("lsd::BasicStringView::copy(): Position exceded string bounds!");
+		if (pos > size()) LSD_THROW(std::out_of_range("lsd::BasicStringView::copy(): Position exceded string bounds!"));
 		return traits_type::copy(dest, m_begin + pos, std::min(count, size() - pos));
 	}
 
 	constexpr BasicStringView substr(size_type pos = 0, size_type count = npos) const {
-		if (pos > size()) throw std::out_of_range("lsd::BasicStringView::substr(): Position exceded string bounds!");
-		return container(m_begin, std::min(count, size() - pos));
+		if (pos > size()) LSD_THROW(std::out_of_range("lsd::BasicStringView::substr(): Position exceded string bounds!"));
+		return container(m_begin + pos, std::min(count, size() - pos));
 	}
 
 	constexpr int compare(container v) const noexcept {
@@ -222,9 +223,18 @@ public:
 		return find(other.data(), pos, other.size());
 	}
 	constexpr size_type find(const_pointer s, size_type pos, size_type count) const {
-		if (size() >= count && pos <= size() - count)
-			for (auto it = m_begin + pos; it < (m_end - count); it++)
-				if (traits_type::compare(s, it, count) == 0) return it - m_begin;
+		auto siz = size();
+		auto beg = m_begin;
+
+		if (count == 0) return (pos <= siz) ? pos : npos;
+		if (siz < count || pos > siz - count) return npos;
+
+		auto last = beg + (siz - count); // last position the pattern can start at
+
+		for (auto it = beg + pos; it <= last; it++) { // searches for the first character before comparing the rest
+			if (!(it = traits_type::find(it, last - it + 1, *s))) return npos;
+			if (traits_type::compare(s + 1, it + 1, count - 1) == 0) return it - beg;
+		}
 
 		return npos;
 	}
@@ -232,7 +242,10 @@ public:
 		return find(s, pos, traits_type::length(s));
 	}
 	constexpr size_type find(value_type c, size_type pos = 0) const noexcept {
-		return find(std::addressof(c), pos, 1);
+		auto siz = size();
+
+		auto it = (pos < siz) ? traits_type::find(m_begin + pos, siz - pos, c) : nullptr;
+		return it ? it - m_begin : npos;
 	}
 
 	constexpr size_type rfind(container other, size_type pos = npos) const noexcept {
@@ -406,7 +419,7 @@ public:
 
 	[[nodiscard]] constexpr const_reference at(size_type index) const {
 		auto ptr = m_begin + index;
-		if (ptr >= m_end) throw std::out_of_range("lsd::BasicString::at(): Index exceded string bounds!");
+		if (ptr >= m_end) LSD_THROW(std::out_of_range("lsd::BasicString::at(): Index exceded string bounds!"));
 		return *ptr;
 	}
 	[[nodiscard]] constexpr const_reference operator[](size_type index) const {
@@ -441,7 +454,7 @@ private:
 	const_pointer m_begin { };
 	const_pointer m_end { };
 
-	template <class, class, class> friend class BasicString;
+	template <class, class, class, std::size_t> friend class BasicString;
 };
 
 using StringView = BasicStringView<char>;
@@ -0,0 +1,191 @@
+/*************************
+ * @file ToChars.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Implementation for the to_chars() function
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Detail/CoreUtility.h"
+#include "Detail/FromChars/Core.h"
+#include "Iterators.h"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <system_error>
+#include <charconv>
+#include <algorithm>
+
+namespace lsd {
+
+template <ContinuousIteratorType Iterator> struct ToCharsResult {
+public:
+	Iterator ptr;
+	std::errc ec;
+
+	constexpr explicit operator bool() const noexcept {
+		return ec == std::errc { };
+	}
+	friend constexpr bool operator==(const ToCharsResult&, const ToCharsResult&) = default;
+};
+
+
+/**
+ * @brief Maximum amount of characters toChars() writes for a type in base 10 or in the shortest floating point representation
+ */
+template <class Numerical> inline constexpr std::size_t toCharsMaxSize = [](){
+	if constexpr (std::is_integral_v<Numerical>)
+		return static_cast<std::size_t>(std::numeric_limits<Numerical>::digits10 + 1 + std::is_signed_v<Numerical>);
+	else // sign, digits, decimal point, exponent sign and up to 5 exponent digits
+		return static_cast<std::size_t>(std::numeric_limits<Numerical>::max_digits10 + 9);
+}();
+
+
+namespace detail {
+
+inline constexpr char toCharsDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+inline constexpr char toCharsDigitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+template <class Unsigned> constexpr std::size_t toCharsLength(Unsigned value, unsigned base) noexcept {
+	std::size_t length = 1;
+
+	if (base == 10) {
+		for (; value >= 10000; value /= 10000) length += 4;
+		if (value >= 1000) return length + 3;
+		if (value >= 100) return length + 2;
+		if (value >= 10) return length + 1;
+	} else for (; value >= base; value /= base) ++length;
+
+	return length;
+}
+
+constexpr std::chars_format toStdCharsFormat(CharsFormat fmt) noexcept {
+	switch (fmt) {
+		case CharsFormat::scientific: return std::chars_format::scientific;
+		case CharsFormat::fixed: return std::chars_format::fixed;
+		case CharsFormat::hex: return std::chars_format::hex;
+		default: return std::chars_format::general;
+	}
+}
+
+// the floating point conversion is done by the standard library into a narrow buffer and then copied into the destination
+
+template <class Iterator, class Writer> ToCharsResult<Iterator> toCharsFloating(Iterator begin, Iterator end, Writer writer) {
+	if constexpr (std::is_same_v<Iterator, char*>) {
+		auto res = writer(begin, end);
+		return { res.ptr, res.ec };
+	} else {
+		char buffer[256];
+		auto res = writer(buffer, buffer + std::min<std::size_t>(sizeof(buffer), end - begin));
+
+		if (res.ec != std::errc { }) return { end, res.ec };
+
+		for (auto it = buffer; it != res.ptr; it++, begin++) *begin = *it;
+		return { begin, std::errc { } };
+	}
+}
+
+} // namespace detail
+
+
+// integral to chars, locale independent and without any allocations
+template <class Numerical, ContinuousIteratorType Iterator>
+constexpr ToCharsResult<Iterator> toChars(Iterator begin, Iterator end, Numerical value, int base = 10)
+requires (
+	std::is_integral_v<Numerical> &&
+	!std::is_same_v<Numerical, bool> &&
+	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type>
+) {
+	using unsigned_type = std::make_unsigned_t<Numerical>;
+
+	if (base < 2 || base > 36) return { begin, std::errc::invalid_argument };
+
+	auto u = static_cast<unsigned_type>(value);
+
+	if constexpr (std::is_signed_v<Numerical>) {
+		if (value < 0) {
+			if (begin == end) return { end, std::errc::value_too_large };
+
+			*begin++ = '-';
+			u = unsigned_type(0) - u;
+		}
+	}
+
+	auto length = detail::toCharsLength(u, static_cast<unsigned>(base));
+	if (static_cast<std::size_t>(end - begin) < length) return { end, std::errc::value_too_large };
+
+	auto last = begin + length;
+	auto it = last;
+
+	if (base == 10) {
+		for (; u >= 100; u /= 100) {
+			auto i = static_cast<std::size_t>(u % 100) * 2;
+			*--it = detail::toCharsDigitPairs[i + 1];
+			*--it = detail::toCharsDigitPairs[i];
+		}
+
+		if (u >= 10) {
+			auto i = static_cast<std::size_t>(u) * 2;
+			*--it = detail::toCharsDigitPairs[i + 1];
+			*--it = detail::toCharsDigitPairs[i];
+		} else *--it = static_cast<char>('0' + u);
+	} else {
+		do {
+			*--it = detail::toCharsDigits[u % static_cast<unsigned>(base)];
+			u /= static_cast<unsigned>(base);
+		} while (u != 0);
+	}
+
+	return { last, std::errc { } };
+}
+
+// shortest representation which round trips through fromChars
+template <class Numerical, ContinuousIteratorType Iterator>
+inline ToCharsResult<Iterator> toChars(Iterator begin, Iterator end, Numerical value)
+requires (
+	std::is_floating_point_v<Numerical> &&
+	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type>
+) {
+	return detail::toCharsFloating(begin, end, [value](char* first, char* last) {
+		return std::to_chars(first, last, value);
+	});
+}
+template <class Numerical, ContinuousIteratorType Iterator>
+inline ToCharsResult<Iterator> toChars(Iterator begin, Iterator end, Numerical value, CharsFormat fmt)
+requires (
+	std::is_floating_point_v<Numerical> &&
+	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type>
+) {
+	return detail::toCharsFloating(begin, end, [value, fmt](char* first, char* last) {
+		return std::to_chars(first, last, value, detail::toStdCharsFormat(fmt));
+	});
+}
+template <class Numerical, ContinuousIteratorType Iterator>
+inline ToCharsResult<Iterator> toChars(Iterator begin, Iterator end, Numerical value, CharsFormat fmt, int precision)
+requires (
+	std::is_floating_point_v<Numerical> &&
+	std::is_integral_v<typename std::iterator_traits<Iterator>::value_type>
+) {
+	return detail::toCharsFloating(begin, end, [value, fmt, precision](char* first, char* last) {
+		return std::to_chars(first, last, value, detail::toStdCharsFormat(fmt), precision);
+	});
+}
+
+} // namespace lsd
@@ -0,0 +1,456 @@
+/**************************
+ * @file Unicode.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Unicode validation and transcoding between UTF-8, UTF-16 and UTF-32
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ **************************/
+
+#pragma once
+
+#include "String.h"
+#include "StringView.h"
+#include "Detail/CoreUtility.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace lsd {
+
+namespace detail {
+
+template <class Ty> concept UnicodeCharType = std::is_integral_v<Ty> && (sizeof(Ty) == 1 || sizeof(Ty) == 2 || sizeof(Ty) == 4);
+
+inline constexpr bool utf8AsciiWord(std::uint64_t word) noexcept {
+	return (word & 0x8080808080808080ull) == 0;
+}
+
+/**
+ * @brief Decodes a single code point, the encoding is selected by the size of the code unit
+ *
+ * @return Whether the sequence at begin was valid, begin is only advanced if it was
+ */
+template <UnicodeCharType CharTy> constexpr bool decodeCodePoint(const CharTy*& begin, const CharTy* end, char32_t& code) noexcept {
+	if constexpr (sizeof(CharTy) == 1) {
+		auto lead = static_cast<unsigned char>(*begin);
+
+		if (lead < 0x80) {
+			code = lead;
+			++begin;
+
+			return true;
+		}
+
+		std::size_t length;
+		char32_t min;
+
+		if ((lead & 0xE0) == 0xC0) {
+			length = 2;
+			min = 0x80;
+			code = lead & 0x1F;
+		} else if ((lead & 0xF0) == 0xE0) {
+			length = 3;
+			min = 0x800;
+			code = lead & 0x0F;
+		} else if ((lead & 0xF8) == 0xF0) {
+			length = 4;
+			min = 0x10000;
+			code = lead & 0x07;
+		} else return false;
+
+		if (static_cast<std::size_t>(end - begin) < length) return false;
+
+		for (std::size_t i = 1; i < length; i++) {
+			auto c = static_cast<unsigned char>(begin[i]);
+			if ((c & 0xC0) != 0x80) return false;
+
+			code = (code << 6) | (c & 0x3F);
+		}
+
+		if (code < min || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) return false;
+
+		begin += length;
+		return true;
+	} else if constexpr (sizeof(CharTy) == 2) {
+		char32_t unit = static_cast<char16_t>(*begin);
+
+		if (unit >= 0xD800 && unit <= 0xDBFF) {
+			if (end - begin < 2) return false;
+
+			char32_t low = static_cast<char16_t>(begin[1]);
+			if (low < 0xDC00 || low > 0xDFFF) return false;
+
+			code = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+			begin += 2;
+
+			return true;
+		} else if (unit >= 0xDC00 && unit <= 0xDFFF) return false;
+
+		code = unit;
+		++begin;
+
+		return true;
+	} else {
+		code = static_cast<char32_t>(*begin);
+		if (code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) return false;
+
+		++begin;
+		return true;
+	}
+}
+
+template <UnicodeCharType CharTy> constexpr std::size_t encodedLength(char32_t code) noexcept {
+	if constexpr (sizeof(CharTy) == 1) return (code < 0x80) ? 1 : (code < 0x800) ? 2 : (code < 0x10000) ? 3 : 4;
+	else if constexpr (sizeof(CharTy) == 2) return (code < 0x10000) ? 1 : 2;
+	else return 1;
+}
+
+template <UnicodeCharType CharTy> constexpr CharTy* encodeCodePoint(char32_t code, CharTy* out) noexcept {
+	if constexpr (sizeof(CharTy) == 1) {
+		if (code < 0x80) *out++ = static_cast<CharTy>(code);
+		else if (code < 0x800) {
+			*out++ = static_cast<CharTy>(0xC0 | (code >> 6));
+			*out++ = static_cast<CharTy>(0x80 | (code & 0x3F));
+		} else if (code < 0x10000) {
+			*out++ = static_cast<CharTy>(0xE0 | (code >> 12));
+			*out++ = static_cast<CharTy>(0x80 | ((code >> 6) & 0x3F));
+			*out++ = static_cast<CharTy>(0x80 | (code & 0x3F));
+		} else {
+			*out++ = static_cast<CharTy>(0xF0 | (code >> 18));
+			*out++ = static_cast<CharTy>(0x80 | ((code >> 12) & 0x3F));
+			*out++ = static_cast<CharTy>(0x80 | ((code >> 6) & 0x3F));
+			*out++ = static_cast<CharTy>(0x80 | (code & 0x3F));
+		}
+	} else if constexpr (sizeof(CharTy) == 2) {
+		if (code < 0x10000) *out++ = static_cast<CharTy>(code);
+		else {
+			*out++ = static_cast<CharTy>(0xD800 + ((code - 0x10000) >> 10));
+			*out++ = static_cast<CharTy>(0xDC00 + ((code - 0x10000) & 0x3FF));
+		}
+	} else *out++ = static_cast<CharTy>(code);
+
+	return out;
+}
+
+inline std::size_t findInvalidUtf8Scalar(const unsigned char* data, std::size_t size, std::size_t i) noexcept {
+	while (i < size) {
+		if (size - i >= 8) {
+			std::uint64_t word;
+			std::memcpy(&word, data + i, 8);
+
+			if (utf8AsciiWord(word)) {
+				i += 8;
+				continue;
+			}
+		}
+
+		if (data[i] < 0x80) {
+			++i;
+			continue;
+		}
+
+		auto it = reinterpret_cast<const char*>(data + i);
+		char32_t code;
+
+		if (!decodeCodePoint(it, reinterpret_cast<const char*>(data + size), code)) return i;
+		i = it - reinterpret_cast<const char*>(data);
+	}
+
+	return size;
+}
+
+#if defined(__SSSE3__)
+
+/**
+ * @brief Branchless UTF-8 validation of 16 byte blocks with lookup tables
+ *
+ * @details Every error is detected from the high nibble of the previous byte, the low nibble of the previous byte and the high nibble of the current byte.
+ * See Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte".
+ */
+class Utf8BlockValidator {
+public:
+	void check(__m128i input) noexcept {
+		if (_mm_movemask_epi8(input) == 0) {
+			m_error = _mm_or_si128(m_error, m_prevIncomplete);
+			return;
+		}
+
+		auto prev1 = _mm_alignr_epi8(input, m_prevInput, 15);
+		auto specialCases = checkSpecialCases(input, prev1);
+
+		auto prev2 = _mm_alignr_epi8(input, m_prevInput, 14);
+		auto prev3 = _mm_alignr_epi8(input, m_prevInput, 13);
+		auto isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+		auto isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+		auto mustBeContinuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+		m_error = _mm_or_si128(m_error, _mm_xor_si128(mustBeContinuation, specialCases));
+
+		m_prevIncomplete = _mm_subs_epu8(input, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1)));
+		m_prevInput = input;
+	}
+	void finish() noexcept {
+		m_error = _mm_or_si128(m_error, m_prevIncomplete);
+	}
+
+	[[nodiscard]] bool failed() const noexcept {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(m_error, _mm_setzero_si128())) != 0xFFFF;
+	}
+
+private:
+	__m128i m_error = _mm_setzero_si128();
+	__m128i m_prevInput = _mm_setzero_si128();
+	__m128i m_prevIncomplete = _mm_setzero_si128();
+
+	static __m128i checkSpecialCases(__m128i input, __m128i prev1) noexcept {
+		constexpr char tooShort = 1 << 0;
+		constexpr char tooLong = 1 << 1;
+		constexpr char overlong3 = 1 << 2;
+		constexpr char tooLarge = 1 << 3;
+		constexpr char surrogate = 1 << 4;
+		constexpr char overlong2 = 1 << 5;
+		constexpr char tooLarge1000 = 1 << 6;
+		constexpr char overlong4 = 1 << 6;
+		constexpr char twoConts = static_cast<char>(1 << 7);
+		constexpr char carry = tooShort | tooLong | twoConts;
+
+		auto nibbleMask = _mm_set1_epi8(0x0F);
+
+		auto byte1High = _mm_shuffle_epi8(_mm_setr_epi8(
+			tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+			twoConts, twoConts, twoConts, twoConts,
+			tooShort | overlong2,
+			tooShort,
+			tooShort | overlong3 | surrogate,
+			tooShort | tooLarge | tooLarge1000 | overlong4
+		), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+
+		auto byte1Low = _mm_shuffle_epi8(_mm_setr_epi8(
+			carry | overlong3 | overlong2 | overlong4,
+			carry | overlong2,
+			carry,
+			carry,
+			carry | tooLarge,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000 | surrogate,
+			carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000
+		), _mm_and_si128(prev1, nibbleMask));
+
+		auto byte2High = _mm_shuffle_epi8(_mm_setr_epi8(
+			tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+			tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+			tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+			tooLong | overlong2 | twoConts | surrogate | tooLarge,
+			tooLong | overlong2 | twoConts | surrogate | tooLarge,
+			tooShort, tooShort, tooShort, tooShort
+		), _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+		return _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+	}
+};
+
+#endif
+
+} // namespace detail
+
+
+/**
+ * @brief Find the first invalid code unit sequence in UTF-8 text
+ *
+ * @details Rejects overlong encodings, surrogates, code points above U+10FFFF and truncated sequences.
+ * Uses SSSE3 lookup tables when they are available and validates 64 bytes per step, falling back to a scalar validator with an ASCII fast path otherwise.
+ *
+ * @param data pointer to the text
+ * @param size size of the text in bytes
+ *
+ * @return Offset of the first invalid sequence, size if the text is valid
+ */
+template <detail::UnicodeCharType CharTy> [[nodiscard]] inline std::size_t findInvalidUtf8(const CharTy* data, std::size_t size) noexcept requires(sizeof(CharTy) == 1) {
+	auto bytes = reinterpret_cast<const unsigned char*>(data);
+
+#if defined(__SSSE3__)
+	static constexpr std::size_t stepSize = 64;
+
+	detail::Utf8BlockValidator validator;
+	std::size_t i = 0;
+
+	for (; i < size; i += stepSize) {
+		alignas(16) unsigned char padded[stepSize];
+		const unsigned char* step = bytes + i;
+
+		if (size - i < stepSize) { // zeros are ASCII, so padding does not change the result
+			std::memset(padded, 0, stepSize);
+			std::memcpy(padded, step, size - i);
+			step = padded;
+		}
+
+		for (std::size_t j = 0; j < stepSize; j += 16) validator.check(_mm_loadu_si128(reinterpret_cast<const __m128i*>(step + j)));
+		if (size - i <= stepSize) validator.finish();
+
+		if (validator.failed()) { // locate the error with the scalar validator, starting at the first sequence which may cross into this step
+			auto start = (i < 3) ? 0 : i - 3;
+			while (start < i && (bytes[start] & 0xC0) == 0x80) ++start;
+
+			return detail::findInvalidUtf8Scalar(bytes, size, start);
+		}
+	}
+
+	return size;
+#else
+	return detail::findInvalidUtf8Scalar(bytes, size, 0);
+#endif
+}
+template <detail::UnicodeCharType CharTy> [[nodiscard]] inline std::size_t findInvalidUtf8(BasicStringView<CharTy> text) noexcept requires(sizeof(CharTy) == 1) {
+	return findInvalidUtf8(text.data(), text.size());
+}
+
+/**
+ * @brief Find the first invalid code unit sequence in UTF-16 or UTF-32 text
+ *
+ * @param data pointer to the text
+ * @param size size of the text in code units
+ *
+ * @return Offset of the first invalid sequence, size if the text is valid
+ */
+template <detail::UnicodeCharType CharTy> [[nodiscard]] constexpr std::size_t findInvalidUnicode(const CharTy* data, std::size_t size) noexcept {
+	if constexpr (sizeof(CharTy) == 1) {
+		if !consteval {
+			return findInvalidUtf8(data, size);
+		}
+	}
+
+	auto it = data;
+	auto end = data + size;
+	char32_t code;
+
+	while (it != end)
+		if (!detail::decodeCodePoint(it, end, code)) return it - data;
+
+	return size;
+}
+
+template <detail::UnicodeCharType CharTy> [[nodiscard]] inline bool isValidUtf8(const CharTy* data, std::size_t size) noexcept requires(sizeof(CharTy) == 1) {
+	return findInvalidUtf8(data, size) == size;
+}
+template <detail::UnicodeCharType CharTy> [[nodiscard]] inline bool isValidUtf8(BasicStringView<CharTy> text) noexcept requires(sizeof(CharTy) == 1) {
+	return isValidUtf8(text.data(), text.size());
+}
+
+/**
+ * @brief Compute the number of code units needed to store text in another encoding
+ *
+ * @tparam To target code unit type
+ *
+ * @param data pointer to the text
+ * @param size size of the text in code units
+ *
+ * @return Size of the transcoded text, npos if the input is not valid
+ */
+template <detail::UnicodeCharType To, detail::UnicodeCharType From> [[nodiscard]] constexpr std::size_t transcodedSize(const From* data, std::size_t size) noexcept {
+	constexpr std::size_t npos = -1;
+
+	auto it = data;
+	auto end = data + size;
+	std::size_t r = 0;
+
+	while (it != end) {
+		if constexpr (sizeof(From) == 1) {
+			if (end - it >= 8) {
+				std::uint64_t word = 0;
+				for (std::size_t i = 0; i < 8; i++) word |= static_cast<std::uint64_t>(static_cast<unsigned char>(it[i])) << (i * 8);
+
+				if (detail::utf8AsciiWord(word)) {
+					it += 8;
+					r += 8;
+					continue;
+				}
+			}
+		}
+
+		char32_t code;
+		if (!detail::decodeCodePoint(it, end, code)) return npos;
+
+		r += detail::encodedLength<To>(code);
+	}
+
+	return r;
+}
+
+/**
+ * @brief Convert text between UTF-8, UTF-16 and UTF-32, the encodings are selected by the size of the code units
+ *
+ * @details The size of the result is computed in a first pass, the second pass writes directly into the buffer of the result.
+ *
+ * @tparam To target code unit type
+ *
+ * @param data pointer to the text
+ * @param size size of the text in code units
+ *
+ * @return Transcoded text
+ */
+template <detail::UnicodeCharType To, detail::UnicodeCharType From> [[nodiscard]] constexpr BasicString<To> transcode(const From* data, std::size_t size) {
+	auto count = transcodedSize<To>(data, size);
+	if (count == static_cast<std::size_t>(-1)) LSD_THROW(std::invalid_argument("lsd::transcode(): Input contains an invalid code unit sequence!"));
+
+	BasicString<To> r;
+	r.resizeAndOverwrite(count, [data, size](To* out, std::size_t) {
+		auto begin = out;
+		auto it = data;
+		auto end = data + size;
+
+		while (it != end) {
+			if constexpr (sizeof(From) == 1) { // copy runs of ASCII characters without decoding them
+				if (static_cast<unsigned char>(*it) < 0x80) {
+					*out++ = static_cast<To>(*it++);
+					continue;
+				}
+			}
+
+			char32_t code;
+			detail::decodeCodePoint(it, end, code);
+			out = detail::encodeCodePoint(code, out);
+		}
+
+		return static_cast<std::size_t>(out - begin);
+	});
+
+	return r;
+}
+template <detail::UnicodeCharType To, class Text> [[nodiscard]] constexpr BasicString<To> transcode(const Text& text) requires requires {
+	{ text.data() } -> std::convertible_to<const typename Text::value_type*>;
+	text.size();
+} {
+	return transcode<To>(text.data(), text.size());
+}
+
+template <class Text> [[nodiscard]] constexpr String toUtf8(const Text& text) {
+	return transcode<char>(text);
+}
+template <class Text> [[nodiscard]] constexpr U16String toUtf16(const Text& text) {
+	return transcode<char16_t>(text);
+}
+template <class Text> [[nodiscard]] constexpr U32String toUtf32(const Text& text) {
+	return transcode<char32_t>(text);
+}
+template <class Text> [[nodiscard]] constexpr WString toWide(const Text& text) {
+	return transcode<wchar_t>(text);
+}
+
+} // namespace lsd
@@ -0,0 +1,415 @@
+/*************************
+ * @file UnorderedSmallSparseSet.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Unordered Sparse Set implementation optimized for small element counts
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include "Detail/CoreUtility.h"
+#include "Iterators.h"
+#include "Vector.h"
+#include "Hash.h"
+#include "ForwardList.h"
+
+#include <initializer_list>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace lsd {
+
+/**
+ * @brief Insertion ordered set which stores up to SmallSize elements in a flat array and searches it linearly
+ *
+ * @details Buckets are only allocated once the set grows past SmallSize elements, from then on lookups are hashed.
+ * Erasing elements preserves the order of the remaining ones. If the set shrinks back to SmallSize elements, the buckets are released again.
+ *
+ * @tparam Key element type
+ * @tparam Hash hasher type
+ * @tparam Equal comparison type
+ * @tparam Alloc allocator type
+ * @tparam SmallSize std::integral_constant holding the maximum number of elements stored without buckets, a type for compatibility with template template parameters
+ */
+template <
+	class Key,
+	class Hash = Hash<Key>,
+	class Equal = std::equal_to<Key>,
+	class Alloc = std::allocator<Key>,
+	class SmallSize = std::integral_constant<std::size_t, 8>
+> class UnorderedSmallSparseSet {
+public:
+	static constexpr float maxLoadFactor = 2;
+	static constexpr std::size_t smallSize = SmallSize::value;
+
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+
+	using key_type = Key;
+	using allocator_type = Alloc;
+	template <class F, class S> using pair_type = std::pair<F, S>;
+
+	using value_type = key_type;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using rvreference = value_type&&;
+	using pointer = value_type*;
+	using const_pointer = const pointer;
+	using array = Vector<value_type, allocator_type>;
+
+	using bucket_type = size_type;
+	using bucket_list = ForwardList<bucket_type>;
+	using buckets = Vector<bucket_list>;
+
+	using iterator = typename array::iterator;
+	using const_iterator = typename array::const_iterator;
+	using reverse_iterator = typename array::reverse_iterator;
+	using const_reverse_iterator = typename array::const_reverse_iterator;
+
+	using hasher = Hash;
+	using key_equal = Equal;
+
+	using container = UnorderedSmallSparseSet;
+	using const_container_reference = const container&;
+	using container_rvreference = container&&;
+
+	constexpr UnorderedSmallSparseSet() noexcept = default;
+	explicit constexpr UnorderedSmallSparseSet(
+		const hasher& hash,
+		const key_equal& keyEqual = key_equal(),
+		const allocator_type& alloc = allocator_type()) noexcept :
+		m_array(alloc),
+		m_hasher(hash),
+		m_equal(keyEqual) { }
+	explicit constexpr UnorderedSmallSparseSet(const allocator_type& alloc) noexcept : m_array(alloc) { }
+	template <class It> constexpr UnorderedSmallSparseSet(
+		It first, It last,
+		const hasher& hash = hasher(),
+		const key_equal& keyEqual = key_equal(),
+		const allocator_type& alloc = allocator_type()) requires isIteratorValue<It> :
+		m_array(alloc),
+		m_hasher(hash),
+		m_equal(keyEqual) {
+		insert(first, last);
+	}
+	constexpr UnorderedSmallSparseSet(
+		std::initializer_list<value_type> ilist,
+		const hasher& hash = hasher(),
+		const key_equal& keyEqual = key_equal(),
+		const allocator_type& alloc = allocator_type()) :
+		m_array(alloc),
+		m_hasher(hash),
+		m_equal(keyEqual) {
+		insert(ilist.begin(), ilist.end());
+	}
+	constexpr UnorderedSmallSparseSet(const_container_reference other) = default;
+	constexpr UnorderedSmallSparseSet(container_rvreference other) noexcept = default;
+	constexpr ~UnorderedSmallSparseSet() = default;
+
+	constexpr UnorderedSmallSparseSet& operator=(const_container_reference other) = default;
+	constexpr UnorderedSmallSparseSet& operator=(container_rvreference other) noexcept = default;
+
+	constexpr void swap(container& other) {
+		m_array.swap(other.m_array);
+		m_buckets.swap(other.m_buckets);
+		std::swap(m_bucketModulus, other.m_bucketModulus);
+	}
+
+	constexpr iterator begin() noexcept {
+		return m_array.begin();
+	}
+	constexpr const_iterator begin() const noexcept {
+		return m_array.begin();
+	}
+	constexpr const_iterator cbegin() const noexcept {
+		return m_array.cbegin();
+	}
+	constexpr iterator end() noexcept {
+		return m_array.end();
+	}
+	constexpr const_iterator end() const noexcept {
+		return m_array.end();
+	}
+	constexpr const_iterator cend() const noexcept {
+		return m_array.cend();
+	}
+	constexpr reverse_iterator rbegin() noexcept {
+		return m_array.rbegin();
+	}
+	constexpr const_reverse_iterator rbegin() const noexcept {
+		return m_array.rbegin();
+	}
+	constexpr const_reverse_iterator crbegin() const noexcept {
+		return m_array.crbegin();
+	}
+	constexpr reverse_iterator rend() noexcept {
+		return m_array.rend();
+	}
+	constexpr const_reverse_iterator rend() const noexcept {
+		return m_array.rend();
+	}
+	constexpr const_reverse_iterator crend() const noexcept {
+		return m_array.crend();
+	}
+
+	[[nodiscard]] constexpr reference front() noexcept {
+		return m_array.front();
+	}
+	[[nodiscard]] constexpr const_reference front() const noexcept {
+		return m_array.front();
+	}
+	[[nodiscard]] constexpr reference back() noexcept {
+		return m_array.back();
+	}
+	[[nodiscard]] constexpr const_reference back() const noexcept {
+		return m_array.back();
+	}
+
+	constexpr void rehash(size_type count) {
+		const auto& prime = tablePrimeAtLeast(count);
+
+		m_buckets = buckets(prime.divisor());
+		m_bucketModulus = prime;
+		fillBuckets();
+	}
+	constexpr void reserve(size_type count) {
+		m_array.reserve(count);
+		if (count > smallSize && m_buckets.size() * maxLoadFactor < count) rehash(static_cast<size_type>(count / maxLoadFactor) + 1);
+	}
+
+	constexpr pair_type<iterator, bool> insert(const_reference value) {
+		auto it = find(value);
+
+		if (it != m_array.end())
+			return { it, false };
+		else
+			return { basicInsert(value), true };
+	}
+	constexpr pair_type<iterator, bool> insert(rvreference value) {
+		auto it = find(value);
+
+		if (it != m_array.end())
+			return { it, false };
+		else
+			return { basicInsert(std::move(value)), true };
+	}
+	template <class K> constexpr pair_type<iterator, bool> insert(K&& obj) requires std::is_constructible_v<value_type, K&&> {
+		auto it = find(obj);
+
+		if (it != m_array.end())
+			return { it, false };
+		else
+			return { basicInsert(std::forward<K>(obj)), true };
+	}
+	template <class It> constexpr void insert(It first, It last) requires isIteratorValue<It> {
+		for (; first != last; first++) {
+			insert(*first);
+		}
+	}
+	constexpr void insert(std::initializer_list<value_type> ilist) {
+		insert(ilist.begin(), ilist.end());
+	}
+
+	template <class... Args> constexpr pair_type<iterator, bool> emplace(Args&&... args) {
+		value_type v(std::forward<Args>(args)...);
+		auto it = find(v);
+
+		if (it != m_array.end()) {
+			return { it, false };
+		} else {
+			return { basicInsert(std::move(v)), true };
+		}
+	}
+
+	constexpr iterator erase(const_iterator pos) {
+		return erase(pos, pos + 1);
+	}
+	constexpr iterator erase(iterator pos) {
+		return erase(const_iterator(pos.get()));
+	}
+	constexpr iterator erase(const_iterator first, const_iterator last) {
+		size_type index = first - m_array.cbegin();
+		size_type count = last - first;
+
+		if (count == 0) return m_array.begin() + index;
+
+		if (!m_buckets.empty()) {
+			if (m_array.size() - count <= smallSize) m_buckets = buckets();
+			else {
+				// unlink the erased elements and shift the indices behind the erased range in place, which keeps the nodes
+				for (auto i = index; i < index + count; i++) unlinkIndex(i);
+
+				for (auto& bucketList : m_buckets)
+					for (auto& i : bucketList)
+						if (i > index) i -= count;
+			}
+		}
+
+		auto it = m_array.begin() + index;
+		std::move(it + count, m_array.end(), it);
+		for (; count > 0; count--) m_array.popBack();
+
+		return m_array.begin() + index;
+	}
+	constexpr size_type erase(const key_type& key) {
+		auto it = find(key);
+
+		if (it != m_array.end()) {
+			erase(it);
+			return 1;
+		}
+
+		return 0;
+	}
+	template <class K> constexpr size_type erase(K&& key)
+		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
+		auto it = find(key);
+
+		if (it != m_array.end()) {
+			erase(it);
+			return 1;
+		}
+
+		return 0;
+	}
+
+	constexpr value_type extract(const_iterator pos) {
+		assert((pos != m_array.end()) && "lsd::UnorderedSmallSparseSet::extract(): The end iterator was passed to the function!");
+
+		value_type v(std::move(*const_cast<value_type*>(&*pos)));
+		erase(pos);
+		return v;
+	}
+	template <class K> constexpr value_type extract(K&& key)
+		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
+		auto it = find(key);
+		if (it != m_array.end())
+			return extract(it);
+		else return value_type();
+	}
+
+	constexpr void clear() {
+		m_array.clear();
+		m_buckets = buckets();
+	}
+
+	[[nodiscard]] constexpr size_type size() const noexcept {
+		return m_array.size();
+	}
+	[[nodiscard]] constexpr size_type maxSize() const noexcept {
+		return m_array.maxSize();
+	}
+	[[nodiscard]] constexpr bool empty() const noexcept {
+		return m_array.empty();
+	}
+	[[nodiscard]] constexpr bool isSmall() const noexcept {
+		return m_buckets.empty();
+	}
+	[[nodiscard]] constexpr allocator_type allocator() const noexcept {
+		return m_array.allocator();
+	}
+
+	[[nodiscard]] constexpr size_type bucketCount() const noexcept {
+		return m_buckets.size();
+	}
+	[[nodiscard]] constexpr float loadFactor() const noexcept {
+		return m_buckets.empty() ? 0.0f : static_cast<float>(m_array.size()) / m_buckets.size();
+	}
+
+	template <class K> [[nodiscard]] constexpr bool contains(const K& key) const {
+		return find(key) != m_array.end();
+	}
+	template <class K> [[nodiscard]] constexpr size_type count(const K& key) const {
+		return contains(key) ? 1 : 0;
+	}
+
+	template <class K> [[nodiscard]] constexpr iterator find(const K& key) {
+		return m_array.begin() + (static_cast<const container&>(*this).find(key) - m_array.cbegin());
+	}
+	template <class K> [[nodiscard]] constexpr const_iterator find(const K& key) const {
+		if (m_buckets.empty()) return linearFind(key);
+		return hashedFind(key, m_hasher(key));
+	}
+	template <class K> [[nodiscard]] constexpr iterator find(const K& key, size_type hash) {
+		return m_array.begin() + (static_cast<const container&>(*this).find(key, hash) - m_array.cbegin());
+	}
+	template <class K> [[nodiscard]] constexpr const_iterator find(const K& key, size_type hash) const {
+		if (m_buckets.empty()) return linearFind(key);
+		return hashedFind(key, hash);
+	}
+
+	template <class K> [[nodiscard]] constexpr value_type& at(const K& key) {
+		auto it = find(key);
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSmallSparseSet::at(): Specified key could not be found in container!"));
+		return *it;
+	}
+	template <class K> [[nodiscard]] constexpr const value_type& at(const K& key) const {
+		auto it = find(key);
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSmallSparseSet::at(): Specified key could not be found in container!"));
+		return *it;
+	}
+	template <class K> [[nodiscard]] constexpr value_type& operator[](K&& key) {
+		auto it = find(key);
+		return (it == m_array.end()) ? *basicInsert(value_type(std::forward<K>(key))) : *it;
+	}
+
+private:
+	array m_array { };
+	buckets m_buckets { };
+	FastModulus m_bucketModulus { }; // only valid while there are buckets
+
+	[[no_unique_address]] hasher m_hasher { };
+	[[no_unique_address]] key_equal m_equal { };
+
+	template <class K> constexpr const_iterator linearFind(const K& key) const {
+		for (auto it = m_array.begin(); it != m_array.end(); it++)
+			if (m_equal(*it, key)) return it;
+
+		return m_array.end();
+	}
+	template <class K> constexpr const_iterator hashedFind(const K& key, size_type hash) const {
+		auto& bucketList = m_buckets[m_bucketModulus.reduce(hash)];
+
+		for (auto it = bucketList.begin(); it != bucketList.end(); it++)
+			if (m_equal(m_array[*it], key)) return &m_array[*it];
+
+		return m_array.end();
+	}
+
+	constexpr void fillBuckets() {
+		size_type i = 0;
+		for (auto it = m_array.begin(); it != m_array.end(); it++, i++)
+			m_buckets[keyToBucket(*it)].emplaceFront(i);
+	}
+	constexpr void unlinkIndex(size_type index) {
+		auto& bucketList = m_buckets[keyToBucket(m_array[index])];
+
+		for (auto prev = bucketList.beforeBegin(), it = bucketList.begin(); it != bucketList.end(); prev = it++) {
+			if (*it == index) {
+				bucketList.eraseAfter(prev);
+				return;
+			}
+		}
+	}
+	template <class K> constexpr size_type keyToBucket(const K& key) const noexcept {
+		return m_bucketModulus.reduce(m_hasher(key));
+	}
+
+	template <class V> constexpr iterator basicInsert(V&& value) {
+		m_array.emplaceBack(std::forward<V>(value));
+
+		if (!m_buckets.empty()) {
+			if (m_array.size() >= m_buckets.size() * maxLoadFactor) rehash(m_array.size());
+			else m_buckets[keyToBucket(m_array.back())].emplaceFront(m_array.size() - 1);
+		} else if (m_array.size() > smallSize) rehash(m_array.size());
+
+		return --m_array.end();
+	}
+};
+
+} // namespace lsd
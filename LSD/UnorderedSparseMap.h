@@ -56,8 +56,8 @@ public:
 
 	using iterator = typename array::iterator;
 	using const_iterator = typename array::const_iterator;
-	using bucket_iterator = typename buckets::iterator;
-	using const_bucket_iterator = typename buckets::const_iterator;
+	using bucket_iterator = typename bucket_list::iterator;
+	using const_bucket_iterator = typename bucket_list::const_iterator;
 
 	using hasher = Hash;
 	using key_equal = Equal;
@@ -143,6 +143,7 @@ public:
 	constexpr UnorderedSparseMap& operator=(const_container_reference other) noexcept {
 		this->m_array = other.m_array;
 		m_buckets = other.m_buckets;
+		m_bucketModulus = other.m_bucketModulus;
 
 		return *this;
 	}
@@ -151,6 +152,7 @@ public:
 	constexpr void swap(container& other) {
 		m_array.swap(other.m_array);
 		m_buckets.swap(other.m_buckets);
+		std::swap(m_bucketModulus, other.m_bucketModulus);
 	}
 
 	constexpr iterator begin() noexcept {
@@ -208,24 +210,6 @@ public:
 	constexpr const_bucket_iterator cend(size_type index) const noexcept {
 		return m_buckets[index].cend();
 	}
-	constexpr bucket_iterator rbegin(size_type index) noexcept {
-		return m_buckets[index].rbegin();
-	}
-	constexpr const_bucket_iterator rbegin(size_type index) const noexcept {
-		return m_buckets[index].rbegin();
-	}
-	constexpr const_bucket_iterator crbegin(size_type index) const noexcept {
-		return m_buckets[index].crbegin();
-	}
-	constexpr bucket_iterator rend(size_type index) noexcept {
-		return m_buckets[index].rend();
-	}
-	constexpr const_bucket_iterator rend(size_type index) const noexcept {
-		return m_buckets[index].rend();
-	}
-	constexpr const_bucket_iterator crend(size_type index) const noexcept {
-		return m_buckets[index].crend();
-	}
 
 	[[nodiscard]] constexpr reference front() noexcept {
 		return m_array.front();
@@ -241,8 +225,11 @@ public:
 	}
 
 	void rehash(size_type count) noexcept {
+		const auto& prime = tablePrimeAtLeast(count);
+
 		m_buckets.clear();
-		m_buckets.resize(count);
+		m_buckets.resize(prime.divisor());
+		m_bucketModulus = prime;
 
 		size_type i = 0;
 		for (auto it = m_array.begin(); it != m_array.end(); it++, i++)
@@ -430,7 +417,7 @@ public:
 
 	constexpr void clear() noexcept {
 		m_array.clear();
-		m_buckets.clear();
+		for (auto& bucketList : m_buckets) bucketList.clear();
 	}
 
 	[[nodiscard]] constexpr size_type size() const noexcept {
@@ -465,10 +452,10 @@ public:
 		return m_buckets.maxSize();
 	}
 	[[nodiscard]] constexpr size_type bucketSize(size_type index) const noexcept {
-		return m_buckets[index]->size();
+		return static_cast<size_type>(std::distance(m_buckets[index].begin(), m_buckets[index].end()));
 	}
 	[[deprecated]] [[nodiscard]] constexpr size_type bucket_size(size_type index) const noexcept {
-		return m_buckets[index]->size();
+		return static_cast<size_type>(std::distance(m_buckets[index].begin(), m_buckets[index].end()));
 	}
 	template <class K> [[nodiscard]] size_type bucket(const K& key) const noexcept
 		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
@@ -532,13 +519,13 @@ public:
 	template <class K> [[nodiscard]] constexpr mapped_type& at(const K& key)
 		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
 		auto it = find(key);
-		if (it == m_array.end()) throw std::out_of_range("lsd::UnorderedSparseMap::at(): Specified key could not be found in container!");
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSparseMap::at(): Specified key could not be found in container!"));
 		return it->second;
 	}
 	template <class K> [[nodiscard]] constexpr const mapped_type& at(const K& key) const
 		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
 		auto it = find(key);
-		if (it == m_array.end()) throw std::out_of_range("lsd::UnorderedSparseMap::at(): Specified key could not be found in container!");
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSparseMap::at(): Specified key could not be found in container!"));
 		return it->second;
 	}
 	template <class K> [[nodiscard]] constexpr mapped_type& operator[](const K& key)
@@ -555,16 +542,17 @@ public:
 private:
 	array m_array { };
 	buckets m_buckets { };
+	FastModulus m_bucketModulus = detail::hashmapBucketModulus(m_buckets.size());
 
 	[[no_unique_address]] hasher m_hasher { };
 	[[no_unique_address]] key_equal m_equal { };
 
 	constexpr void rehashIfNecessary() noexcept {
-		if (m_array.size() >= m_buckets.size() * maxLoadFactor) rehash(nextPrime(m_array.size()));
+		if (m_array.size() >= m_buckets.size() * maxLoadFactor) rehash(m_array.size());
 	}
 	template <class K> constexpr size_type keyToBucket(const K& key) const noexcept
 		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
-		return m_hasher(key) % m_buckets.size();
+		return m_bucketModulus.reduce(m_hasher(key));
 	}
 	constexpr iterator basicInsert(const value_type& value) noexcept {
 		auto i = keyToBucket(value.first);
@@ -54,8 +54,8 @@ public:
 
 	using iterator = typename array::iterator;
 	using const_iterator = typename array::const_iterator;
-	using bucket_iterator = typename buckets::iterator;
-	using const_bucket_iterator = typename buckets::const_iterator;
+	using bucket_iterator = typename bucket_list::iterator;
+	using const_bucket_iterator = typename bucket_list::const_iterator;
 
 	using hasher = Hash;
 	using key_equal = Equal;
@@ -141,6 +141,7 @@ public:
 	constexpr UnorderedSparseSet& operator=(const_container_reference other) noexcept {
 		this->m_array = other.m_array;
 		m_buckets = other.m_buckets;
+		m_bucketModulus = other.m_bucketModulus;
 
 		return *this;
 	}
@@ -149,6 +150,7 @@ public:
 	constexpr void swap(container& other) {
 		m_array.swap(other.m_array);
 		m_buckets.swap(other.m_buckets);
+		std::swap(m_bucketModulus, other.m_bucketModulus);
 	}
 
 	constexpr iterator begin() noexcept {
@@ -206,24 +208,6 @@ public:
 	constexpr const_bucket_iterator cend(size_type index) const noexcept {
 		return m_buckets[index].cend();
 	}
-	constexpr bucket_iterator rbegin(size_type index) noexcept {
-		return m_buckets[index].rbegin();
-	}
-	constexpr const_bucket_iterator rbegin(size_type index) const noexcept {
-		return m_buckets[index].rbegin();
-	}
-	constexpr const_bucket_iterator crbegin(size_type index) const noexcept {
-		return m_buckets[index].crbegin();
-	}
-	constexpr bucket_iterator rend(size_type index) noexcept {
-		return m_buckets[index].rend();
-	}
-	constexpr const_bucket_iterator rend(size_type index) const noexcept {
-		return m_buckets[index].rend();
-	}
-	constexpr const_bucket_iterator crend(size_type index) const noexcept {
-		return m_buckets[index].crend();
-	}
 
 	[[nodiscard]] constexpr reference front() noexcept {
 		return m_array.front();
@@ -239,8 +223,11 @@ public:
 	}
 
 	void rehash(size_type count) noexcept {
+		const auto& prime = tablePrimeAtLeast(count);
+
 		m_buckets.clear();
-		m_buckets.resize(count);
+		m_buckets.resize(prime.divisor());
+		m_bucketModulus = prime;
 
 		size_type i = 0;
 		for (auto it = m_array.begin(); it != m_array.end(); it++, i++)
@@ -397,7 +384,7 @@ public:
 
 	constexpr void clear() noexcept {
 		m_array.clear();
-		m_buckets.clear();
+		for (auto& bucketList : m_buckets) bucketList.clear();
 	}
 
 	[[nodiscard]] constexpr size_type size() const noexcept {
@@ -432,10 +419,10 @@ public:
 		return m_buckets.maxSize();
 	}
 	[[nodiscard]] constexpr size_type bucketSize(size_type index) const noexcept {
-		return m_buckets[index]->size();
+		return static_cast<size_type>(std::distance(m_buckets[index].begin(), m_buckets[index].end()));
 	}
 	[[deprecated]] [[nodiscard]] constexpr size_type bucket_size(size_type index) const noexcept {
-		return m_buckets[index]->size();
+		return static_cast<size_type>(std::distance(m_buckets[index].begin(), m_buckets[index].end()));
 	}
 	template <class K> [[nodiscard]] size_type bucket(const K& key) const noexcept
 		requires(!std::is_convertible_v<K, iterator> && !std::is_convertible_v<K, const_iterator>) {
@@ -491,14 +478,32 @@ public:
 		return m_array.end();
 	}
 
+	template <class K> [[nodiscard]] constexpr iterator find(const K& key, size_type hash) noexcept {
+		auto& bucketList = m_buckets[hashToBucket(hash)];
+
+		for (auto it = bucketList.begin(); it != bucketList.end(); it++) {
+			if (m_equal(m_array[*it], key)) return &m_array[*it];
+		}
+
+		return m_array.end();
+	}
+	template <class K> [[nodiscard]] constexpr const_iterator find(const K& key, size_type hash) const noexcept {
+		auto& bucketList = m_buckets[hashToBucket(hash)];
+
+		for (auto it = bucketList.begin(); it != bucketList.end(); it++)
+			if (m_equal(m_array[*it], key)) return &m_array[*it];
+
+		return m_array.end();
+	}
+
 	template <class K> [[nodiscard]] constexpr value_type& at(const K& key) {
 		auto it = find(key);
-		if (it == m_array.end()) throw std::out_of_range("lsd::UnorderedSparseSet::at(): Specified key could not be found in container!");
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSparseSet::at(): Specified key could not be found in container!"));
 		return *it;
 	}
 	template <class K> [[nodiscard]] constexpr const value_type& at(const K& key) const {
 		auto it = find(key);
-		if (it == m_array.end()) throw std::out_of_range("lsd::UnorderedSparseSet::at(): Specified key could not be found in container!");
+		if (it == m_array.end()) LSD_THROW(std::out_of_range("lsd::UnorderedSparseSet::at(): Specified key could not be found in container!"));
 		return *it;
 	}
 	template <class K> [[nodiscard]] constexpr value_type& operator[](const K& key) {
@@ -513,15 +518,19 @@ public:
 private:
 	array m_array { };
 	buckets m_buckets { };
+	FastModulus m_bucketModulus = detail::hashmapBucketModulus(m_buckets.size());
 
 	[[no_unique_address]] hasher m_hasher { };
 	[[no_unique_address]] key_equal m_equal { };
 
 	constexpr void rehashIfNecessary() noexcept {
-		if (m_array.size() >= m_buckets.size() * maxLoadFactor) rehash(nextPrime(m_array.size()));
+		if (m_array.size() >= m_buckets.size() * maxLoadFactor) rehash(m_array.size());
 	}
 	template <class K> constexpr size_type keyToBucket(const K& key) const noexcept {
-		return m_hasher(key) % m_buckets.size();
+		return hashToBucket(m_hasher(key));
+	}
+	constexpr size_type hashToBucket(size_type hash) const noexcept {
+		return m_bucketModulus.reduce(hash);
 	}
 	constexpr iterator basicInsert(const value_type& value) noexcept {
 		auto i = keyToBucket(value);
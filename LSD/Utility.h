@@ -15,6 +15,7 @@
 #include "Detail/CoreUtility.h"
 
 #include <limits>
+#include <algorithm>
 #include <functional>
 
 #include <cstring>
@@ -55,17 +56,17 @@ template <lsd::IteratableContainer Ty> void swap(Ty& a, Ty& b) {
 	a.swap(b);
 }
 
-template <lsd::IteratableContainer Ty, class Value = typename Ty::value_type> Ty::size_type erase(Ty& container, const Value& value) {
-	auto it = std::remove(container.begin(), container.end(), value);
-	auto r = container.end() - it;
-	container.erase(it, container.end());
-	return r;
+template <lsd::IteratableContainer Ty, class Pred> Ty::size_type erase_if(Ty& container, Pred pred) {
+	if constexpr (requires { container.eraseIf(pred); }) return container.eraseIf(pred); // compacts in a single pass without a separate erase
+	else {
+		auto it = std::remove_if(container.begin(), container.end(), pred);
+		auto r = container.end() - it;
+		container.erase(it, container.end());
+		return r;
+	}
 }
-template <lsd::IteratableContainer Ty, class Pred> Ty::size_type erase(Ty& container, Pred pred) {
-	auto it = std::remove(container.begin(), container.end(), pred);
-	auto r = container.end() - it;
-	container.erase(it, container.end());
-	return r;
+template <lsd::IteratableContainer Ty, class Value = typename Ty::value_type> Ty::size_type erase(Ty& container, const Value& value) {
+	return erase_if(container, [&value](const auto& element) { return element == value; });
 }
 
 } // namespace std
@@ -12,7 +12,9 @@
 #pragma once
 
 #include "Detail/CoreUtility.h"
+#include "Detail/BulkCopy.h"
 #include "Iterators.h"
+#include "AlignedAllocator.h"
 
 #include <cstdlib>
 #include <cstdint>
@@ -21,6 +23,7 @@
 #include <memory>
 #include <utility>
 #include <stdexcept>
+#include <iterator>
 #include <algorithm>
 #include <initializer_list>
 
@@ -70,7 +73,7 @@ public:
 			auto count = last - first;
 			smartReserve(count);
 
-			for (; first != last; first++, m_end++) allocator_traits::construct(m_alloc, m_end, std::move(*first));
+			m_end = detail::uninitializedCopy(m_alloc, first, last, m_end);
 		}
 	}
 	constexpr Vector(const_container_reference other) : Vector(other.m_begin, other.m_end) { }
@@ -94,7 +97,7 @@ public:
 
 	constexpr ~Vector() {
 		if (m_begin) {
-			for (auto it = m_begin; it != m_end; it++) allocator_traits::destroy(m_alloc, it);
+			detail::destroyRange(m_alloc, m_begin, m_end);
 			allocator_traits::deallocate(m_alloc, m_begin, m_cap - m_begin);
 			
 			m_begin = nullptr;
@@ -104,8 +107,7 @@ public:
 	}
 
 	constexpr container_reference operator=(const_container_reference other) {
-		clear();
-		moveAssign(other.m_begin, other.m_end, other.m_alloc);
+		if (this != &other) assign(other.m_begin, other.m_end);
 		return *this;
 	}
 	constexpr container_reference operator=(container_rvreference other) noexcept {
@@ -137,7 +139,7 @@ public:
 			auto count = last - first;
 			smartReserve(count);
 
-			for (; first != last; m_end++, first++) allocator_traits::construct(m_alloc, m_end, *first);
+			m_end = detail::uninitializedCopy(m_alloc, first, last, m_end);
 		}
 	}
 	constexpr void assign(init_list ilist) {
@@ -203,38 +205,29 @@ public:
 	constexpr void resize(size_type count) {
 		auto s = size();
 		if (count > s) {
-			smartReserve(size() + count);
+			smartReserve(count);
 
-			for (; count > 0; count--, m_end++) allocator_traits::construct(m_alloc, m_end);
-		} else if (count < s) {
-			auto pos = m_begin + count + 1;
-			for (auto it = pos; it != m_end; it++) allocator_traits::destroy(m_alloc, m_begin);
-			m_end = pos;
-		}
+			for (; s < count; s++, m_end++) allocator_traits::construct(m_alloc, m_end);
+		} else if (count < s) destroyBehind(m_begin + count);
 	}
 	constexpr void resize(size_type count, const_reference value) {
 		auto s = size();
 		if (count > s)
 			append(count - s, value);
-		else if (count < s) {
-			auto pos = m_begin + count + 1;
-			for (auto it = pos; it != m_end; it++) allocator_traits::destroy(m_alloc, m_begin);
-			m_end = pos;
-		};
+		else if (count < s) destroyBehind(m_begin + count);
 	}
 	constexpr void reserve(size_type count) {
 		auto cap = capacity();
 
 		if (count > cap) {
-			if (count > maxSize()) throw std::length_error("lsd::BasicString::reserve(): Count exceded maximum allocation size");
+			if (count > maxSize()) LSD_THROW(std::length_error("lsd::BasicString::reserve(): Count exceded maximum allocation size"));
 			else {
+				count = roundedCapacity(count);
 				auto s = size();
 				auto oldBegin = std::exchange(m_begin, allocator_traits::allocate(m_alloc, count));
 
 				if (oldBegin) {
-					for (auto beginIt = m_begin, oldBeginIt = oldBegin; oldBeginIt != m_end; beginIt++, oldBeginIt++)
-						allocator_traits::construct(m_alloc, beginIt, std::move(*oldBeginIt));
-
+					detail::uninitializedRelocate(m_alloc, oldBegin, m_end, m_begin);
 					allocator_traits::deallocate(m_alloc, oldBegin, cap);
 				}
 
@@ -246,19 +239,18 @@ public:
 	constexpr void shrinkToFit() {
 		auto s = size();
 		auto cap = capacity();
+		auto newCap = roundedCapacity(s);
 
-		if (s < cap) {
-			auto oldBegin = std::exchange(m_begin, allocator_traits::allocate(m_alloc, s));
+		if (newCap < cap) {
+			auto oldBegin = std::exchange(m_begin, allocator_traits::allocate(m_alloc, newCap));
 
 			if (oldBegin) {
-				for (auto beginIt = m_begin, oldBeginIt = oldBegin; oldBeginIt != m_end; beginIt++, oldBeginIt++)
-					allocator_traits::construct(m_alloc, beginIt, std::move(*oldBeginIt));
-
+				detail::uninitializedRelocate(m_alloc, oldBegin, m_end, m_begin);
 				allocator_traits::deallocate(m_alloc, oldBegin, cap);
 			}
 
 			m_end = m_begin + s;
-			m_cap = m_end;
+			m_cap = m_begin + newCap;
 		}
 	}
 	[[deprecated]] constexpr void shrink_to_fit() {
@@ -281,7 +273,7 @@ public:
 
 		if (count != 0) {
 			auto ptr = eraseAndInsertGap(pos, 0, count);
-			for (auto it = ptr; count != 0; count--, it++) allocator_traits::construct(m_alloc, it, value);
+			detail::uninitializedFill(m_alloc, ptr, count, value);
 
 			return ptr;
 		} else return pos;
@@ -291,7 +283,7 @@ public:
 		
 		if (first != last) {
 			auto ptr = eraseAndInsertGap(pos, 0, last - first);
-			for (auto it = ptr; first != last; first++, it++) allocator_traits::construct(m_alloc, it, *first);
+			detail::uninitializedCopy(m_alloc, first, last, ptr);
 
 			return ptr;
 		} else return pos;
@@ -336,20 +328,95 @@ public:
 
 		auto it = m_begin + (pos - m_begin);
 
-		allocator_traits::destroy(m_alloc, it);
-		allocator_traits::construct(m_alloc, it, std::move(*(it + 1))); // weird bit here because it needs to reconstruct the previously destroyed piece of memory
-
-		std::move(it + 2, m_end, it + 1); // move the other elements normally
-
+		std::move(it + 1, m_end, it);
 		popBack();
 
 		return it;
 	}
 	constexpr iterator erase(const_iterator first, const_iterator last) {
 		auto it = m_begin + (first - m_begin);
+		auto count = static_cast<size_type>(last - first);
+
+		if (count != 0) {
+			std::move(it + count, m_end, it);
+			destroyBehind(m_end - count);
+		}
 
-		if (first != last) return eraseAndInsertGap(it, last - first, 0);
-		else return it;
+		return it;
+	}
+	/**
+	 * @brief Erase an element by moving the last element into its place, which does not preserve the order of the elements
+	 *
+	 * @param pos element to erase
+	 *
+	 * @return Iterator to the element which took the place of the erased one, or end() if the last element was erased
+	 */
+	constexpr iterator eraseUnordered(const_iterator pos) {
+		assert((pos < end()) && "lsd::Vector::eraseUnordered: past-end iterator passed to erase!");
+
+		auto it = m_begin + (pos - m_begin);
+
+		if (it != m_end - 1) *it = std::move(*(m_end - 1));
+		popBack();
+
+		return it;
+	}
+	/**
+	 * @brief Erase every element satisfying a predicate in a single pass, keeping the order of the remaining elements
+	 *
+	 * @param pred predicate which returns true for the elements to erase
+	 *
+	 * @return Amount of erased elements
+	 */
+	template <class Pred> constexpr size_type eraseIf(Pred pred) {
+		auto it = m_begin;
+		for (; it != m_end && !pred(std::as_const(*it)); it++) { }
+
+		if (it == m_end) return 0;
+
+		auto write = it;
+		for (++it; it != m_end; it++)
+			if (!pred(std::as_const(*it))) *write++ = std::move(*it);
+
+		auto count = static_cast<size_type>(m_end - write);
+		destroyBehind(write);
+
+		return count;
+	}
+	/**
+	 * @brief Erase the elements at a list of indices in a single pass, keeping the order of the remaining elements
+	 *
+	 * @param first first index, the indices have to be sorted in ascending order without duplicates
+	 * @param last end of the indices
+	 *
+	 * @return Amount of erased elements
+	 */
+	template <class It> constexpr size_type eraseIndices(It first, It last) requires isIteratorValue<It> {
+		if (first == last) return 0;
+
+		auto write = m_begin + *first;
+		auto read = write;
+
+		for (; first != last; ++first) {
+			auto erased = m_begin + *first;
+			assert((erased >= read && erased < m_end) && "lsd::Vector::eraseIndices(): Indices were not sorted, contained duplicates or exceded array bounds!");
+
+			write = std::move(read, erased, write);
+			read = erased + 1;
+		}
+
+		write = std::move(read, m_end, write);
+
+		auto count = static_cast<size_type>(m_end - write);
+		destroyBehind(write);
+
+		return count;
+	}
+	template <class Range> constexpr size_type eraseIndices(const Range& indices) requires requires { std::begin(indices); std::end(indices); } {
+		return eraseIndices(std::begin(indices), std::end(indices));
+	}
+	constexpr size_type eraseIndices(std::initializer_list<size_type> indices) {
+		return eraseIndices(indices.begin(), indices.end());
 	}
 
 	constexpr void popBack() {
@@ -360,8 +427,7 @@ public:
 	}
 
 	constexpr void clear() {
-		for (auto it = m_begin; it != m_end; it++) allocator_traits::destroy(m_alloc, m_begin);
-		m_end = m_begin;
+		destroyBehind(m_begin);
 	}
 
 	[[nodiscard]] constexpr size_type size() const noexcept {
@@ -396,12 +462,12 @@ public:
 
 	[[nodiscard]] constexpr const_reference at(size_type index) const {
 		auto ptr = m_begin + index;
-		if (ptr >= m_end) throw std::out_of_range("lsd::Vector::at(): Index exceded array bounds!");
+		if (ptr >= m_end) LSD_THROW(std::out_of_range("lsd::Vector::at(): Index exceded array bounds!"));
 		return *ptr;
 	}
 	[[nodiscard]] constexpr reference at(size_type index) {
 		auto ptr = m_begin + index;
-		if (ptr >= m_end) throw std::out_of_range("lsd::Vector::at(): Index exceded array bounds!");
+		if (ptr >= m_end) LSD_THROW(std::out_of_range("lsd::Vector::at(): Index exceded array bounds!"));
 		return *ptr;
 	}
 	[[nodiscard]] constexpr const_reference operator[](size_type index) const {
@@ -422,6 +488,16 @@ private:
 	pointer m_end { };
 	pointer m_cap { };
 
+	static constexpr size_type roundedCapacity(size_type count) noexcept {
+		constexpr auto granularity = detail::allocatorCapacityGranularity<allocator_type>;
+
+		if constexpr (granularity > 1) return (count + granularity - 1) / granularity * granularity;
+		else return count;
+	}
+	constexpr void destroyBehind(pointer position) noexcept { // position is the new end
+		detail::destroyRange(m_alloc, position, m_end);
+		m_end = position;
+	}
 	constexpr void smartReserve(size_type size) noexcept {
 		auto cap = capacity();
 
@@ -438,12 +514,12 @@ private:
 			auto count = last - first;
 			smartReserve(count);
 
-			for (; first != last; first++, m_end++) allocator_traits::construct(m_alloc, m_end, std::move(*first));
+			m_end = detail::uninitializedCopy(m_alloc, std::make_move_iterator(first), std::make_move_iterator(last), m_end);
 		}
 	}
 	constexpr void append(size_type count, const_reference value) noexcept {
 		smartReserve(size() + count);
-		for (; count > 0; count--, m_end++) allocator_traits::construct(m_alloc, m_end, value);
+		m_end = detail::uninitializedFill(m_alloc, m_end, count, value);
 	}
 
 	constexpr pointer eraseAndInsertGap(pointer position, size_type eraseCount, size_type gapSize) { // does not check for validity of eraseCount or gapSize
@@ -458,7 +534,7 @@ private:
 
 			// reserve memory without constructing new memory, similar to smartReserve()
 			auto doubleCap = oldCap * 2;
-			auto reserveCount = (newSize > doubleCap) ?newSize : doubleCap;
+			auto reserveCount = roundedCapacity((newSize > doubleCap) ? newSize : doubleCap);
 			auto oldBegin = std::exchange(m_begin, allocator_traits::allocate(m_alloc, reserveCount));
 			
 			// calculate new pointers
@@ -466,45 +542,21 @@ private:
 			m_cap = m_begin + reserveCount;
 
 			if (oldBegin) {
-				// prepare some iterators for the following parts
-				auto it = m_begin;
-				auto begIt = oldBegin;
+				auto oldPos = oldBegin + index;
 
-				// re-construct the vector in front of pos/position
-				for (; it < (m_begin + index); it++, begIt++)
-					allocator_traits::construct(m_alloc, it, *begIt);
-				
-				it += gapSize;
-				begIt += eraseCount;
-
-				// reconstruct the remaining parts of the vector
-				for (; it <= m_end; it++, begIt++)
-					allocator_traits::construct(m_alloc, it, *begIt);
+				// relocate the vector in front of pos/position and the remaining parts of the vector behind the gap, then destroy the erased elements
+				detail::uninitializedRelocate(m_alloc, oldBegin, oldPos, m_begin);
+				detail::uninitializedRelocate(m_alloc, oldPos + eraseCount, oldBegin + oldSize, m_begin + index + gapSize);
+				detail::destroyRange(m_alloc, oldPos, oldPos + eraseCount);
 
 				allocator_traits::deallocate(m_alloc, oldBegin, oldCap);
 			}
 
 			return m_begin + index;
 		} else {
-			auto oldEnd = std::exchange(m_end, m_end + gapSize - eraseCount);	
-
-			if (oldSize != 0) {
-				auto endIt = m_end;
-				auto oldEndIt = oldEnd;
-				auto moveBegin = position + std::min(eraseCount, gapSize);
-
-				for (auto count = m_end - oldEnd; count > 0 && oldEndIt > moveBegin; --oldEndIt, --endIt, count--) {
-					allocator_traits::construct(m_alloc, endIt, std::move(*oldEndIt));
-					allocator_traits::destroy(m_alloc, oldEndIt);
-				}
-
-				std::move_backward(moveBegin, oldEndIt, endIt);
-
-				for (; oldEndIt != moveBegin; --endIt, --oldEndIt) { // custom std::move_backward
-					*endIt = std::move(*oldEndIt);
-					allocator_traits::destroy(m_alloc, oldEndIt);
-				}
-			}
+			// destroy the erased elements and relocate the remaining parts of the vector behind the gap, which leaves the gap uninitialized
+			detail::destroyRange(m_alloc, position, position + eraseCount);
+			m_end = detail::relocateRange(m_alloc, position + eraseCount, m_end, position + gapSize);
 			
 			return position;
 		}
@@ -514,4 +566,9 @@ private:
 	template <class, class, class, class> friend class UnorderedSparseSet;
 };
 
+/**
+ * @brief Vector with storage aligned to Align bytes and capacities rounded to whole alignment blocks
+ */
+template <class Ty, std::size_t Align = cacheLineSize> using AlignedVector = Vector<Ty, AlignedAllocator<Ty, Align>>;
+
 } // namespace lsd
@@ -0,0 +1,202 @@
+#include <LSD/AlignedAllocator.h>
+#include <LSD/Vector.h>
+#include <LSD/Array.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+struct Triple { // 12 bytes, which needs 16 elements to fill whole 64 byte blocks
+	int x;
+	int y;
+	int z;
+};
+
+struct alignas(128) OverAligned {
+	int value;
+};
+
+static_assert(lsd::AlignedAllocator<char>::alignment == 64);
+static_assert(lsd::AlignedAllocator<char>::capacityGranularity == 64);
+static_assert(lsd::AlignedAllocator<double>::capacityGranularity == 8);
+static_assert(lsd::AlignedAllocator<Triple>::capacityGranularity == 16);
+static_assert(lsd::AlignedAllocator<int, 16>::capacityGranularity == 4);
+static_assert(lsd::AlignedAllocator<OverAligned, 16>::alignment == 128);
+static_assert(lsd::AlignedAllocator<OverAligned, 16>::capacityGranularity == 1);
+static_assert(std::is_same_v<std::allocator_traits<lsd::AlignedAllocator<int, 32>>::rebind_alloc<char>, lsd::AlignedAllocator<char, 32>>);
+
+static_assert(alignof(lsd::AlignedArray<float, 3>) == 64);
+static_assert(sizeof(lsd::AlignedArray<float, 3>) == 64);
+static_assert(sizeof(lsd::AlignedArray<float, 20, 16>) == 80);
+static_assert(alignof(lsd::AlignedArray<OverAligned, 1, 16>) == 128);
+static_assert(lsd::isArrayValue<lsd::AlignedArray<int, 4>>);
+
+// aligned vectors can be used during constant evaluation as well
+static_assert([]() {
+	lsd::AlignedVector<int> vector;
+	for (int i = 0; i < 100; i++) vector.pushBack(i);
+	vector.shrinkToFit();
+	return vector.size() == 100 && vector.capacity() % 16 == 0 && vector[99] == 99;
+}());
+
+static bool isAligned(const void* pointer, std::size_t alignment) {
+	return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+// the storage starts and ends on an alignment boundary
+template <class Vector> static bool isWellFormed(const Vector& vector) {
+	using allocator_type = typename Vector::allocator_type;
+
+	return isAligned(vector.data(), allocator_type::alignment) &&
+		vector.capacity() % allocator_type::capacityGranularity == 0 &&
+		(vector.capacity() * sizeof(typename Vector::value_type)) % allocator_type::alignment == 0 &&
+		vector.capacity() >= vector.size();
+}
+
+template <class Ty, std::size_t Align> static void checkVector() {
+	using vector_type = lsd::AlignedVector<Ty, Align>;
+	constexpr auto granularity = lsd::AlignedAllocator<Ty, Align>::capacityGranularity;
+
+	vector_type vector;
+
+	// growth one element at a time
+	for (std::size_t i = 0; i < 300; i++) {
+		vector.pushBack(Ty { });
+		CHECK(isWellFormed(vector));
+	}
+
+	// reserve rounds up to the granularity and never shrinks
+	vector.reserve(vector.capacity() + 1);
+	CHECK(isWellFormed(vector));
+
+	vector.reserve(1001);
+	CHECK(vector.capacity() == (1001 + granularity - 1) / granularity * granularity);
+	CHECK(isWellFormed(vector));
+
+	auto capacity = vector.capacity();
+	vector.reserve(10);
+	CHECK(vector.capacity() == capacity);
+
+	// shrinking keeps the rounding
+	vector.resize(granularity + 1);
+	vector.shrinkToFit();
+	CHECK(vector.size() == granularity + 1);
+	CHECK(vector.capacity() == granularity * 2);
+	CHECK(isWellFormed(vector));
+
+	vector.resize(granularity);
+	vector.shrinkToFit();
+	CHECK(vector.capacity() == granularity);
+	CHECK(isWellFormed(vector));
+
+	// growth through inserting and resizing
+	vector.insert(vector.begin(), 7, Ty { });
+	CHECK(vector.size() == granularity + 7);
+	CHECK(isWellFormed(vector));
+
+	vector.resize(5000);
+	CHECK(isWellFormed(vector));
+
+	// copies allocate their own aligned storage
+	vector_type copy(vector);
+	CHECK(copy.size() == vector.size());
+	CHECK(isWellFormed(copy));
+
+	vector_type moved(std::move(copy));
+	CHECK(moved.size() == vector.size());
+	CHECK(isWellFormed(moved));
+
+	vector_type ranged(vector.begin(), vector.begin() + 3);
+	CHECK(isWellFormed(ranged));
+	CHECK(ranged.capacity() == (3 + granularity - 1) / granularity * granularity);
+
+	vector.clear();
+	vector.shrinkToFit();
+	CHECK(vector.empty());
+	vector.pushBack(Ty { });
+	CHECK(isWellFormed(vector));
+}
+
+static void checkVectors() {
+	checkVector<char, 64>();
+	checkVector<int, 64>();
+	checkVector<double, 64>();
+	checkVector<Triple, 64>();
+	checkVector<int, 16>();
+	checkVector<float, 32>();
+	checkVector<char, 256>();
+	checkVector<OverAligned, 16>();
+
+	// the values survive reallocation
+	lsd::AlignedVector<int> values;
+	for (int i = 0; i < 1000; i++) values.pushBack(i);
+	values.shrinkToFit();
+	bool intact = true;
+	for (int i = 0; i < 1000; i++) intact = intact && values[i] == i;
+	CHECK(intact);
+}
+
+static void checkAllocator() {
+	lsd::AlignedAllocator<char, 4096> alloc;
+
+	for (std::size_t count : { 1, 7, 4096, 10000 }) {
+		auto pointer = alloc.allocate(count);
+		CHECK(isAligned(pointer, 4096));
+		pointer[count - 1] = 'x';
+		alloc.deallocate(pointer, count);
+	}
+
+	auto threw = false;
+	try {
+		(void)lsd::AlignedAllocator<double>().allocate(SIZE_MAX / 2);
+	} catch (const std::bad_array_new_length&) {
+		threw = true;
+	}
+	CHECK(threw);
+
+	CHECK((lsd::AlignedAllocator<int, 32>() == lsd::AlignedAllocator<char, 32>()));
+}
+
+static void checkArrays() {
+	lsd::AlignedArray<float, 3> first { };
+	lsd::AlignedArray<float, 3> second { };
+	lsd::AlignedArray<float, 8, 32> third { { 1, 2, 3, 4, 5, 6, 7, 8 } };
+
+	CHECK(isAligned(&first, 64));
+	CHECK(isAligned(first.data(), 64));
+	CHECK(isAligned(&second, 64));
+	CHECK(isAligned(third.data(), 32));
+	CHECK(third[7] == 8);
+	CHECK(third.size() == 8);
+
+	// every element of a vector of aligned arrays is aligned as well
+	lsd::AlignedVector<lsd::AlignedArray<int, 5>> arrays;
+	for (int i = 0; i < 50; i++) {
+		arrays.pushBack({ });
+		arrays.back()[0] = i;
+	}
+
+	bool aligned = true;
+	for (const auto& array : arrays) aligned = aligned && isAligned(array.data(), 64);
+	CHECK(aligned);
+	CHECK(arrays[49][0] == 49);
+
+	auto heap = new lsd::AlignedArray<char, 10, 512>();
+	CHECK(isAligned(heap, 512));
+	delete heap;
+}
+
+int main() {
+	checkAllocator();
+	checkVectors();
+	checkArrays();
+
+	std::printf("AlignedAllocator: %d failures\n", failures);
+	return failures != 0;
+}
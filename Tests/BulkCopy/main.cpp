@@ -0,0 +1,295 @@
+#include <LSD/Detail/BulkCopy.h>
+#include <LSD/String.h>
+#include <LSD/Vector.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <string>
+
+// trivially copyable element, compared by value
+struct Point {
+	int x;
+	int y;
+
+	friend bool operator==(const Point&, const Point&) = default;
+};
+
+// element owning heap memory which counts the living instances and the copies, so leaked, doubly destroyed and moved from elements show up
+class Tracked {
+public:
+	static inline int alive = 0;
+	static inline int copies = 0;
+
+	Tracked() : Tracked(0) { }
+	Tracked(int value) : m_value(lsd::toString(value).append(" is long enough for the heap")) {
+		++alive;
+	}
+	Tracked(const Tracked& other) : m_value(other.m_value) {
+		++alive;
+		++copies;
+	}
+	Tracked(Tracked&& other) noexcept : m_value(std::move(other.m_value)) {
+		++alive;
+	}
+	~Tracked() {
+		--alive;
+	}
+
+	Tracked& operator=(const Tracked& other) {
+		m_value = other.m_value;
+		++copies;
+		return *this;
+	}
+	Tracked& operator=(Tracked&&) noexcept = default;
+
+	friend bool operator==(const Tracked& first, int second) {
+		return first.m_value == Tracked(second).m_value;
+	}
+
+private:
+	lsd::String m_value;
+};
+
+// allocator with its own construct, which must be called for every element even if the type is trivially copyable
+template <class Ty> struct ConstructingAllocator {
+	using value_type = Ty;
+
+	static inline int constructed = 0;
+
+	ConstructingAllocator() = default;
+	template <class Other> ConstructingAllocator(const ConstructingAllocator<Other>&) noexcept { }
+
+	Ty* allocate(std::size_t count) {
+		return std::allocator<Ty>().allocate(count);
+	}
+	void deallocate(Ty* pointer, std::size_t count) noexcept {
+		std::allocator<Ty>().deallocate(pointer, count);
+	}
+	template <class... Args> void construct(Ty* pointer, Args&&... args) {
+		++constructed;
+		std::construct_at(pointer, std::forward<Args>(args)...);
+	}
+
+	template <class Other> friend bool operator==(const ConstructingAllocator&, const ConstructingAllocator<Other>&) noexcept {
+		return true;
+	}
+};
+
+static_assert(lsd::detail::isBulkCopyable<int*, int, std::allocator<int>>);
+static_assert(lsd::detail::isBulkCopyable<const int*, int, std::allocator<int>>);
+static_assert(lsd::detail::isBulkCopyable<std::vector<Point>::const_iterator, Point, std::allocator<Point>>);
+static_assert(lsd::detail::isBulkCopyable<std::string::iterator, char, std::allocator<char>>);
+static_assert(lsd::detail::isBulkCopyable<lsd::Vector<int>::const_iterator, int, std::allocator<int>>);
+static_assert(lsd::detail::isBulkCopyable<lsd::String::iterator, char, std::allocator<char>>);
+static_assert(!lsd::detail::isBulkCopyable<std::list<int>::iterator, int, std::allocator<int>>);
+static_assert(!lsd::detail::isBulkCopyable<Tracked*, Tracked, std::allocator<Tracked>>);
+static_assert(!lsd::detail::isBulkCopyable<short*, int, std::allocator<int>>); // converting copies are done element by element
+static_assert(!lsd::detail::isBulkCopyable<int*, int, ConstructingAllocator<int>>);
+static_assert(lsd::detail::isBulkAssignable<int*, int>);
+static_assert(lsd::detail::isBulkRelocatable<Point, std::allocator<Point>>);
+static_assert(!lsd::detail::isBulkRelocatable<Tracked, std::allocator<Tracked>>);
+static_assert(!lsd::detail::isBulkRelocatable<int, ConstructingAllocator<int>>);
+static_assert(lsd::detail::isMoveIterator<std::move_iterator<int*>>);
+
+// every operation is usable during constant evaluation, where the memory functions are not
+static_assert([]() {
+	lsd::Vector<int> vector { 1, 2, 3 };
+	lsd::Vector<int> copy(vector);
+	copy.insert(copy.begin() + 1, vector.begin(), vector.end());
+	copy.reserve(100);
+	copy.shrinkToFit();
+	return copy.size() == 6 && copy[0] == 1 && copy[1] == 1 && copy[3] == 3 && copy[4] == 2 && vector.size() == 3;
+}());
+
+static void checkUninitializedCopy() {
+	std::allocator<int> alloc;
+	int source[] = { 1, 2, 3, 4, 5 };
+	int dest[5] { };
+
+	// raw pointers, standard and library iterators and move iterators are copied in bulk with the same results
+	CHECK(lsd::detail::uninitializedCopy(alloc, source, source + 5, dest) == dest + 5);
+	CHECK(std::equal(source, source + 5, dest));
+
+	std::vector<int> standard { 6, 7, 8 };
+	CHECK(lsd::detail::uninitializedCopy(alloc, standard.cbegin(), standard.cend(), dest) == dest + 3);
+	CHECK(dest[0] == 6 && dest[2] == 8 && dest[3] == 4);
+
+	lsd::Vector<int> library { 9, 10 };
+	CHECK(lsd::detail::uninitializedCopy(alloc, library.begin(), library.end(), dest + 3) == dest + 5);
+	CHECK(dest[3] == 9 && dest[4] == 10);
+
+	CHECK(lsd::detail::uninitializedCopy(alloc, std::make_move_iterator(source), std::make_move_iterator(source + 2), dest) == dest + 2);
+	CHECK(dest[0] == 1 && dest[1] == 2 && dest[2] == 8);
+
+	// empty ranges do not touch the destination
+	CHECK(lsd::detail::uninitializedCopy(alloc, source, source, static_cast<int*>(nullptr)) == nullptr);
+
+	// non contiguous ranges are copied element by element
+	std::list<int> list { 11, 12, 13 };
+	CHECK(lsd::detail::uninitializedCopy(alloc, list.begin(), list.end(), dest) == dest + 3);
+	CHECK(dest[0] == 11 && dest[1] == 12 && dest[2] == 13);
+
+	// allocators with their own construct are called for every element
+	ConstructingAllocator<int> constructing;
+	ConstructingAllocator<int>::constructed = 0;
+	CHECK(lsd::detail::uninitializedCopy(constructing, source, source + 5, dest) == dest + 5);
+	CHECK(ConstructingAllocator<int>::constructed == 5);
+	CHECK(std::equal(source, source + 5, dest));
+
+	char characters[4];
+	std::allocator<char> charAlloc;
+	CHECK(lsd::detail::uninitializedFill(charAlloc, characters, 4, 'z') == characters + 4);
+	CHECK(characters[0] == 'z' && characters[3] == 'z');
+}
+
+static void checkOverlappingRanges() {
+	// copyRange moves overlapping trivially copyable ranges to the front
+	int values[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	CHECK(lsd::detail::copyRange(values + 2, values + 8, values) == values + 6);
+	CHECK(values[0] == 2 && values[3] == 5 && values[5] == 7 && values[6] == 6);
+
+	// relocateRange handles overlaps in both directions
+	Point points[8];
+	for (int i = 0; i < 8; i++) points[i] = { i, -i };
+
+	std::allocator<Point> alloc;
+	CHECK(lsd::detail::relocateRange(alloc, points, points + 5, points + 3) == points + 8);
+	for (int i = 0; i < 5; i++) CHECK((points[i + 3] == Point { i, -i }));
+
+	CHECK(lsd::detail::relocateRange(alloc, points + 3, points + 8, points + 1) == points + 6);
+	for (int i = 0; i < 5; i++) CHECK((points[i + 1] == Point { i, -i }));
+
+	CHECK(lsd::detail::relocateRange(alloc, points + 1, points + 6, points + 1) == points + 6);
+	CHECK((points[1] == Point { 0, 0 }));
+
+	// and moves non trivial elements one by one in the right order
+	std::allocator<Tracked> trackedAlloc;
+	auto storage = trackedAlloc.allocate(8);
+	for (int i = 0; i < 5; i++) std::construct_at(storage + i, i);
+
+	lsd::detail::relocateRange(trackedAlloc, storage, storage + 5, storage + 2);
+	CHECK(Tracked::alive == 5);
+	for (int i = 0; i < 5; i++) CHECK(storage[i + 2] == i);
+
+	lsd::detail::relocateRange(trackedAlloc, storage + 2, storage + 7, storage + 1);
+	CHECK(Tracked::alive == 5);
+	for (int i = 0; i < 5; i++) CHECK(storage[i + 1] == i);
+
+	lsd::detail::destroyRange(trackedAlloc, storage + 1, storage + 6);
+	trackedAlloc.deallocate(storage, 8);
+	CHECK(Tracked::alive == 0);
+}
+
+static void checkVectorCopy() {
+	{
+		lsd::Vector<Tracked> source;
+		for (int i = 0; i < 10; i++) source.emplaceBack(i);
+
+		// copying leaves the source untouched
+		Tracked::copies = 0;
+		lsd::Vector<Tracked> copy(source);
+		CHECK(Tracked::copies == 10);
+		CHECK(source.size() == 10 && copy.size() == 10);
+		for (int i = 0; i < 10; i++) CHECK(source[i] == i && copy[i] == i);
+
+		lsd::Vector<Tracked> assigned { Tracked(100) };
+		assigned = source;
+		CHECK(source.size() == 10 && assigned.size() == 10);
+		for (int i = 0; i < 10; i++) CHECK(source[i] == i && assigned[i] == i);
+
+		auto& self = assigned;
+		assigned = self;
+		CHECK(assigned.size() == 10 && assigned[9] == 9);
+
+		lsd::Vector<Tracked> ranged(source.begin() + 2, source.begin() + 5);
+		CHECK(ranged.size() == 3 && ranged[0] == 2 && source[2] == 2);
+
+		CHECK(Tracked::alive == 33);
+	}
+
+	CHECK(Tracked::alive == 0);
+
+	lsd::Vector<lsd::String> strings { "a string which is long enough for the heap", "short" };
+	auto stringCopy = strings;
+	CHECK(strings[0] == "a string which is long enough for the heap" && strings[1] == "short");
+	CHECK(std::equal(stringCopy.begin(), stringCopy.end(), strings.begin(), strings.end()));
+
+	lsd::Vector<Point> points { { 1, 2 }, { 3, 4 } };
+	auto pointCopy = points;
+	pointCopy[0].x = 10;
+	CHECK(points[0].x == 1 && pointCopy[1].y == 4);
+}
+
+static void checkVectorReallocation() {
+	{
+		lsd::Vector<Tracked> vector;
+
+		// growing moves the elements and destroys the old ones
+		for (int i = 0; i < 100; i++) {
+			vector.emplaceBack(i);
+			CHECK(Tracked::alive == i + 1);
+		}
+		for (int i = 0; i < 100; i++) CHECK(vector[i] == i);
+
+		vector.reserve(1000);
+		CHECK(vector.capacity() >= 1000);
+		CHECK(Tracked::alive == 100);
+
+		vector.shrinkToFit();
+		CHECK(vector.capacity() == 100);
+		CHECK(Tracked::alive == 100);
+		for (int i = 0; i < 100; i++) CHECK(vector[i] == i);
+
+		// inserting into a full vector reallocates around the gap
+		Tracked::copies = 0;
+		lsd::Vector<Tracked> inserted { Tracked(-1), Tracked(-2) };
+		Tracked::copies = 0;
+		vector.insert(vector.begin() + 50, inserted.begin(), inserted.end());
+		CHECK(Tracked::copies == 2);
+		CHECK(vector.size() == 102);
+		CHECK(vector[49] == 49 && vector[50] == -1 && vector[51] == -2 && vector[52] == 50 && vector[101] == 99);
+		CHECK(Tracked::alive == 104);
+
+		vector.insert(vector.begin(), 3, Tracked(7));
+		CHECK(vector[0] == 7 && vector[2] == 7 && vector[3] == 0);
+		CHECK(Tracked::alive == 107);
+	}
+
+	CHECK(Tracked::alive == 0);
+
+	lsd::Vector<Point> points;
+	for (int i = 0; i < 1000; i++) points.pushBack({ i, i * 2 });
+	points.insert(points.begin() + 1, { Point { -1, -1 }, Point { -2, -2 } });
+	CHECK(points.size() == 1002);
+	CHECK((points[0] == Point { 0, 0 } && points[1] == Point { -1, -1 } && points[3] == Point { 1, 2 } && points[1001] == Point { 999, 1998 }));
+
+	points.erase(points.begin() + 1, points.begin() + 3);
+	points.shrinkToFit();
+	for (int i = 0; i < 1000; i++) CHECK((points[i] == Point { i, i * 2 }));
+
+	// trivially copyable types with a constructing allocator are still constructed one by one
+	lsd::Vector<int, ConstructingAllocator<int>> constructing;
+	ConstructingAllocator<int>::constructed = 0;
+	for (int i = 0; i < 10; i++) constructing.pushBack(i);
+	auto constructedBefore = ConstructingAllocator<int>::constructed;
+	constructing.reserve(100);
+	CHECK(ConstructingAllocator<int>::constructed == constructedBefore + 10);
+	for (int i = 0; i < 10; i++) CHECK(constructing[i] == i);
+}
+
+int main() {
+	checkUninitializedCopy();
+	checkOverlappingRanges();
+	checkVectorCopy();
+	checkVectorReallocation();
+
+	std::printf("BulkCopy: %d failures\n", failures);
+	return failures != 0;
+}
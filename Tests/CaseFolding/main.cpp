@@ -0,0 +1,158 @@
+#include <LSD/CaseFolding.h>
+#include <LSD/String.h>
+#include <LSD/StringView.h>
+#include <LSD/UnorderedSparseSet.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+
+// the lengths cover the scalar tail and both sides of the 16 and 32 byte steps of the SSE2 and AVX2 paths
+static constexpr std::size_t lengths[] = { 0, 1, 7, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65, 100, 129 };
+
+static std::uint32_t state = 12345;
+
+static char randomCharacter() {
+	state = state * 1664525u + 1013904223u;
+	auto c = static_cast<unsigned char>(state >> 24);
+
+	// mostly letters next to the bounds of the ranges, mixed with arbitrary bytes including the ones above 0x7F
+	static constexpr unsigned char interesting[] = { '@', 'A', 'M', 'Z', '[', '`', 'a', 'm', 'z', '{', 0x80, 0xC1, 0xDA, 0xE1, 0xFA, 0xFF };
+	if (c & 1) c = interesting[(c >> 1) & 15];
+
+	return static_cast<char>(c == 0 ? 'q' : c); // short strings can not hold null characters
+}
+
+static lsd::String randomString(std::size_t size) {
+	lsd::String s;
+	for (std::size_t i = 0; i < size; i++) s.pushBack(randomCharacter());
+	return s;
+}
+
+static char referenceLower(char c) {
+	return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c;
+}
+static char referenceUpper(char c) {
+	return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c;
+}
+
+static int referenceCompare(lsd::StringView first, lsd::StringView second) {
+	for (std::size_t i = 0; i < first.size() && i < second.size(); i++) {
+		auto a = static_cast<unsigned char>(referenceLower(first[i]));
+		auto b = static_cast<unsigned char>(referenceLower(second[i]));
+		if (a != b) return (a < b) ? -1 : 1;
+	}
+
+	return (first.size() < second.size()) ? -1 : (first.size() > second.size());
+}
+
+static std::size_t referenceHash(lsd::StringView s) {
+	std::size_t hash = 5381;
+	for (auto c : s) hash = ((hash << 5) + hash) ^ static_cast<std::size_t>(referenceLower(c));
+	return hash;
+}
+
+static void checkConversion() {
+	for (auto length : lengths) {
+		for (int round = 0; round < 20; round++) {
+			auto source = randomString(length + 3);
+
+			// unaligned starts inside the same buffer
+			for (std::size_t offset = 0; offset < 4 && offset <= source.size() - length; offset++) {
+				lsd::StringView view(source.data() + offset, length);
+
+				auto lower = lsd::toLower(view);
+				auto upper = lsd::toUpper(view);
+				CHECK(lower.size() == length);
+				CHECK(upper.size() == length);
+
+				auto lowerInPlace = lsd::String(view);
+				auto upperInPlace = lsd::String(view);
+				lsd::toLowerInPlace(lowerInPlace);
+				lsd::toUpperInPlace(upperInPlace);
+
+				for (std::size_t i = 0; i < length; i++) {
+					CHECK(lower[i] == referenceLower(view[i]));
+					CHECK(upper[i] == referenceUpper(view[i]));
+					CHECK(lowerInPlace[i] == lower[i]);
+					CHECK(upperInPlace[i] == upper[i]);
+				}
+			}
+		}
+	}
+
+	CHECK(lsd::toLower(lsd::String("MiXeD 123 \xC3\x84")) == "mixed 123 \xC3\x84");
+	CHECK(lsd::toUpper(lsd::String("MiXeD 123 \xC3\xA4")) == "MIXED 123 \xC3\xA4");
+
+	// wider characters take the scalar path and leave everything outside of ASCII alone
+	CHECK(lsd::toLower(lsd::WString(L"WIDE \u00C4 STRING OF MORE THAN THIRTY TWO CHARACTERS")) == L"wide \u00C4 string of more than thirty two characters");
+	CHECK(lsd::iequals(lsd::WStringView(L"Wide\u0100"), lsd::WStringView(L"wIDE\u0100")));
+	CHECK(lsd::icompare(lsd::WStringView(L"\u0100"), lsd::WStringView(L"z")) == 1);
+}
+
+static void checkComparison() {
+	for (auto length : lengths) {
+		for (int round = 0; round < 20; round++) {
+			auto first = randomString(length);
+
+			// the same characters with randomly swapped case are equal
+			lsd::String second = first;
+			for (std::size_t i = 0; i < length; i++) if (randomCharacter() & 1) second[i] = referenceUpper(second[i]);
+
+			CHECK(lsd::iequals(lsd::StringView(first), lsd::StringView(second)));
+			CHECK(lsd::iequals(first, second));
+			CHECK(lsd::icompare(first, second) == 0);
+			CHECK(lsd::CaselessHash<>()(first) == lsd::CaselessHash<>()(second));
+			CHECK(lsd::CaselessHash<>()(first) == referenceHash(first));
+
+			// a difference at every position, including the first and last character of each vector step
+			for (std::size_t i = 0; i < length; i++) {
+				auto different = second;
+				different[i] = (referenceLower(different[i]) == 'x') ? '\xE9' : 'x';
+
+				CHECK(lsd::iequals(first, different) == (referenceCompare(first, different) == 0));
+				CHECK(lsd::icompare(first, different) == referenceCompare(first, different));
+				CHECK(lsd::icompare(different, first) == -referenceCompare(first, different));
+			}
+
+			// prefixes compare less
+			if (length > 0) {
+				lsd::StringView prefix(first.data(), length - 1);
+				CHECK(!lsd::iequals(prefix, lsd::StringView(second)));
+				CHECK(lsd::icompare(prefix, lsd::StringView(second)) == -1);
+				CHECK(lsd::icompare(lsd::StringView(second), prefix) == 1);
+			}
+		}
+	}
+
+	// bytes above 0x7F order after every ASCII character
+	CHECK(lsd::icompare(lsd::StringView("\x80"), lsd::StringView("Z")) == 1);
+	CHECK(lsd::icompare(lsd::StringView("a"), lsd::StringView("\xFF")) == -1);
+	CHECK(!lsd::iequals(lsd::StringView("\xC3\x84"), lsd::StringView("\xC3\xA4")));
+	CHECK(lsd::iequals(lsd::StringView("@[`{"), lsd::StringView("@[`{")));
+	CHECK(!lsd::iequals(lsd::StringView("@"), lsd::StringView("`")));
+	CHECK(!lsd::iequals(lsd::StringView("["), lsd::StringView("{")));
+}
+
+static void checkLookup() {
+	lsd::UnorderedSparseSet<lsd::String, lsd::CaselessHash<>, lsd::CaselessEqual<>> set;
+
+	CHECK(set.insert(lsd::String("Content-Type")).second);
+	CHECK(set.insert(lsd::String("Content-Length-Of-A-Long-Header-Name")).second);
+	CHECK(!set.insert(lsd::String("content-type")).second);
+
+	CHECK(set.contains(lsd::StringView("CONTENT-TYPE")));
+	CHECK(set.contains(lsd::StringView("content-length-of-a-long-header-name")));
+	CHECK(!set.contains(lsd::StringView("content-typ")));
+}
+
+int main() {
+	checkConversion();
+	checkComparison();
+	checkLookup();
+
+	std::printf("CaseFolding: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,19 @@
+/*************************
+ * @file Check.h
+ * @author Zhile Zhu (zhuzhile08@gmail.com)
+ *
+ * @brief Minimal check macro shared by the tests
+ *
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *************************/
+
+#pragma once
+
+#include <cstdio>
+
+inline int failures = 0;
+
+// reports a failed condition with its location and keeps running, main() returns non zero if failures is not 0 at the end
+#define CHECK(condition) do { if (!(condition)) { std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); ++failures; } } while (false)
@@ -0,0 +1,187 @@
+#include <LSD/String.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <compare>
+#include <type_traits>
+#include <utility>
+
+// true if the characters are stored inside the string object itself
+template <class S> static bool isInline(const S& s) {
+	auto data = reinterpret_cast<const unsigned char*>(s.data());
+	auto object = reinterpret_cast<const unsigned char*>(&s);
+
+	return data >= object && data < object + sizeof(S);
+}
+
+template <class S> static S filled(std::size_t count, std::size_t offset = 0) {
+	S s;
+	for (std::size_t i = 0; i < count; i++) s.pushBack(static_cast<typename S::value_type>('a' + (i + offset) % 26));
+	return s;
+}
+
+template <class S> static bool matches(const S& s, std::size_t count, std::size_t offset = 0) {
+	if (s.size() != count) return false;
+	for (std::size_t i = 0; i < count; i++) if (s[i] != static_cast<typename S::value_type>('a' + (i + offset) % 26)) return false;
+	return s.data()[count] == typename S::value_type { };
+}
+
+template <class S, std::size_t N> static void checkBoundary() {
+	static_assert(sizeof(S) >= (N + 1) * sizeof(typename S::value_type));
+
+	S empty;
+	CHECK(empty.empty());
+	CHECK(isInline(empty));
+
+	// the inline capacity is at least N, padding may round it up
+	const auto cap = empty.capacity();
+	CHECK(cap >= N);
+	CHECK((cap + 1) * sizeof(typename S::value_type) <= sizeof(S));
+
+	// exactly cap characters still fit into the inline buffer, no matter how they were added
+	auto full = filled<S>(cap);
+	CHECK(matches(full, cap));
+	CHECK(isInline(full));
+	CHECK(full.capacity() == cap);
+
+	// inserting into the middle up to cap characters stays inline as well
+	auto inserted = filled<S>(cap - 1);
+	inserted.insert(inserted.begin() + (cap - 1) / 2, 1, static_cast<typename S::value_type>('#'));
+	CHECK(inserted.size() == cap);
+	CHECK(inserted[(cap - 1) / 2] == static_cast<typename S::value_type>('#'));
+	CHECK(isInline(inserted));
+	inserted.insert(inserted.begin(), 1, static_cast<typename S::value_type>('#'));
+	CHECK(inserted.size() == cap + 1);
+	CHECK(inserted.front() == static_cast<typename S::value_type>('#'));
+	CHECK(!isInline(inserted));
+
+	S constructed(N, static_cast<typename S::value_type>('x'));
+	CHECK(constructed.size() == N);
+	CHECK(isInline(constructed));
+
+	// one more character moves the string to the heap
+	auto over = filled<S>(cap + 1);
+	CHECK(matches(over, cap + 1));
+	CHECK(!isInline(over));
+	CHECK(over.capacity() > cap);
+
+	// shrinking back to cap characters returns it to the inline buffer
+	over.popBack();
+	over.shrinkToFit();
+	CHECK(matches(over, cap));
+	CHECK(isInline(over));
+	CHECK(over.capacity() == cap);
+
+	// copies and moves keep the contents and the storage mode
+	S copy = full;
+	CHECK(copy == full);
+	CHECK(isInline(copy));
+
+	auto big = filled<S>(cap + 10, 3);
+	S moved = std::move(big);
+	CHECK(matches(moved, cap + 10, 3));
+	CHECK(!isInline(moved));
+	CHECK(big.empty());
+
+	moved = full;
+	CHECK(matches(moved, cap));
+
+	S cleared = filled<S>(cap * 2 + 1);
+	cleared.clear();
+	cleared.shrinkToFit();
+	CHECK(cleared.empty());
+	CHECK(isInline(cleared));
+
+	cleared.append(filled<S>(cap, 5));
+	CHECK(matches(cleared, cap, 5));
+	CHECK(isInline(cleared));
+}
+
+static void checkBoundaries() {
+	checkBoundary<lsd::InlineString<1>, 1>();
+	checkBoundary<lsd::InlineString<31>, 31>();
+	checkBoundary<lsd::InlineString<64>, 64>();
+	checkBoundary<lsd::InlineString<255>, 255>();
+	checkBoundary<lsd::InlineString<256>, 256>();
+	checkBoundary<lsd::InlineString<1000>, 1000>();
+
+	checkBoundary<lsd::WInlineString<7>, 7>();
+	checkBoundary<lsd::WInlineString<100>, 100>();
+	checkBoundary<lsd::WInlineString<300>, 300>();
+
+	// an inline capacity of 0 keeps the default layout of three pointers plus padding
+	static_assert(std::is_same_v<lsd::InlineString<0>, lsd::String>);
+	static_assert(sizeof(lsd::InlineString<1>) == sizeof(lsd::String));
+	checkBoundary<lsd::String, sizeof(void*) * 3 - 2>();
+}
+
+static void checkCrossCapacity() {
+	lsd::InlineString<8> small("alpha");
+	lsd::InlineString<300> large("alpha");
+	lsd::String dynamic("alpha");
+
+	CHECK(small == large);
+	CHECK(large == small);
+	CHECK(small == dynamic);
+	CHECK(dynamic == large);
+	CHECK(!(small != large));
+
+	lsd::InlineString<300> beta("beta");
+	CHECK(small != beta);
+	CHECK(small < beta);
+	CHECK(beta > small);
+	CHECK((small <=> large) == std::strong_ordering::equal);
+	CHECK((beta <=> dynamic) == std::strong_ordering::greater);
+	CHECK((dynamic <=> beta) == std::strong_ordering::less);
+
+	// a prefix compares less than the longer string
+	lsd::InlineString<2> prefix("al");
+	CHECK(prefix < large);
+	CHECK(large > prefix);
+
+	// one side on the heap and the other inline
+	auto longA = filled<lsd::InlineString<4>>(40);
+	auto longB = filled<lsd::InlineString<64>>(40);
+	CHECK(!isInline(longA));
+	CHECK(isInline(longB));
+	CHECK(longA == longB);
+	longB.back() = 'z';
+	CHECK(longA != longB);
+	CHECK(longA < longB);
+
+	lsd::WInlineString<4> wideSmall(L"wide");
+	lsd::WInlineString<400> wideLarge(L"wide");
+	CHECK(wideSmall == wideLarge);
+	CHECK((wideSmall <=> wideLarge) == 0);
+}
+
+static void checkHash() {
+	lsd::Hash<lsd::InlineString<8>> smallHash;
+	lsd::Hash<lsd::InlineString<300>> largeHash;
+	lsd::Hash<lsd::String> stringHash;
+
+	// equal strings hash equally regardless of their inline capacity or storage mode
+	CHECK(smallHash(lsd::InlineString<8>("key")) == largeHash(lsd::InlineString<300>("key")));
+	CHECK(smallHash(lsd::InlineString<8>("key")) == stringHash(lsd::String("key")));
+
+	auto heap = filled<lsd::InlineString<8>>(100);
+	auto inline_ = filled<lsd::InlineString<300>>(100);
+	CHECK(!isInline(heap));
+	CHECK(isInline(inline_));
+	CHECK(smallHash(heap) == largeHash(inline_));
+	CHECK(largeHash(inline_) == stringHash(filled<lsd::String>(100)));
+
+	CHECK(smallHash(lsd::InlineString<8>("key")) != largeHash(lsd::InlineString<300>("kez")));
+	CHECK(lsd::Hash<lsd::WInlineString<4>>()(L"wide") == lsd::Hash<lsd::WInlineString<400>>()(L"wide"));
+}
+
+int main() {
+	checkBoundaries();
+	checkCrossCapacity();
+	checkHash();
+
+	std::printf("InlineString: %d failures\n", failures);
+	return failures != 0;
+}
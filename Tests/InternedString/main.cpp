@@ -0,0 +1,196 @@
+#include <LSD/InternedString.h>
+#include <LSD/JsonKey.h>
+#include <LSD/JsonLines.h>
+#include <LSD/JSON.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void checkInterning() {
+	lsd::StringInternPool pool;
+
+	auto a = pool.intern("alpha");
+	auto b = pool.intern(lsd::StringView("alphabet", 5));
+	auto c = pool.intern("beta");
+
+	CHECK(a == b);
+	CHECK(a.data() == b.data());
+	CHECK(a != c);
+	CHECK(a == lsd::StringView("alpha"));
+	CHECK(a.size() == 5 && a.cStr()[5] == '\0');
+	CHECK(a.hash() == lsd::Hash<lsd::StringView>{}(lsd::StringView("alpha")));
+
+	// IDs are handed out in order of interning, the empty string is always 0
+	CHECK(a.id() == 1 && c.id() == 2);
+	CHECK(pool.size() == 2);
+
+	lsd::InternedString empty;
+	CHECK(empty.empty() && empty.id() == 0 && empty.cStr()[0] == '\0');
+	CHECK(pool.intern("") == empty);
+	CHECK(empty.hash() == lsd::Hash<lsd::StringView>{}(lsd::StringView()));
+	CHECK(pool.size() == 2);
+
+	// the same string interned in another pool is a different handle
+	lsd::StringInternPool other;
+	CHECK(other.intern("alpha") != a);
+	CHECK(other.intern("alpha") == a.view());
+
+	// growing the tables of the shards keeps every handle and ID
+	std::vector<lsd::InternedString> handles;
+	for (int i = 0; i < 5000; i++) handles.push_back(pool.intern(lsd::StringView(std::to_string(i).c_str())));
+
+	CHECK(pool.size() == 5002);
+	for (int i = 0; i < 5000; i++) {
+		auto again = pool.intern(lsd::StringView(std::to_string(i).c_str()));
+		CHECK(again == handles[i] && again.id() == static_cast<std::size_t>(i) + 3);
+	}
+	CHECK(pool.intern("alpha") == a);
+
+	lsd::WStringInternPool wide;
+	auto w = wide.intern(L"wide");
+	CHECK(w == wide.intern(L"wide") && w.view() == L"wide" && w.id() == 1);
+
+	lsd::Hash<lsd::InternedString> hash;
+	std::equal_to<lsd::InternedString> equal;
+	CHECK(hash(a) == hash(lsd::StringView("alpha")));
+	CHECK(equal(a, lsd::StringView("alpha")) && equal(lsd::StringView("alpha"), a) && !equal(a, c));
+}
+
+static void checkScope() {
+	auto& global = lsd::StringInternPool::global();
+	CHECK(&lsd::StringInternPool::current() == &global);
+
+	lsd::StringInternPool outer;
+	lsd::StringInternPool inner;
+
+	{
+		lsd::StringInternPool::Scope scope(outer);
+		CHECK(&lsd::StringInternPool::current() == &outer);
+
+		lsd::InternedString first("scoped");
+		CHECK(first == outer.intern("scoped"));
+
+		{
+			lsd::StringInternPool::Scope nested(inner);
+			CHECK(&lsd::StringInternPool::current() == &inner);
+			CHECK(lsd::InternedString("scoped") != first);
+		}
+
+		CHECK(&lsd::StringInternPool::current() == &outer);
+
+		// the scope is only active on the thread which created it
+		bool workerUsesGlobal = false;
+		std::thread([&]() { workerUsesGlobal = &lsd::StringInternPool::current() == &global; }).join();
+		CHECK(workerUsesGlobal);
+	}
+
+	CHECK(&lsd::StringInternPool::current() == &global);
+	CHECK(outer.size() == 1 && inner.size() == 1);
+}
+
+static void checkShards() {
+	lsd::StringInternPool pool;
+
+	constexpr int threadCount = 8;
+	constexpr int stringCount = 4000;
+
+	// every thread interns the same strings in a different order
+	std::vector<std::vector<lsd::InternedString>> results(threadCount, std::vector<lsd::InternedString>(stringCount));
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < threadCount; t++) {
+		threads.emplace_back([&pool, &results, t]() {
+			for (int j = 0; j < stringCount; j++) {
+				int i = (j * 7919 + t * 1013) % stringCount;
+				results[t][i] = pool.intern(lsd::StringView(("key" + std::to_string(i)).c_str()));
+			}
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	CHECK(pool.size() == stringCount);
+
+	std::vector<char> seen(stringCount + 1, 0);
+	for (int i = 0; i < stringCount; i++) {
+		for (int t = 1; t < threadCount; t++) CHECK(results[t][i] == results[0][i]);
+
+		auto id = results[0][i].id();
+		CHECK(id >= 1 && id <= stringCount && !seen[id]);
+		if (id <= stringCount) seen[id] = 1;
+		CHECK(results[0][i] == lsd::StringView(("key" + std::to_string(i)).c_str()));
+	}
+}
+
+static void checkJsonKeys() {
+	lsd::JsonKeyPool pool;
+	lsd::JsonKeyPool::Scope scope(pool);
+
+	// keys with and without escape sequences end up as the same interned key
+	auto json = lsd::InternedJson::parse(R"({"name":1,"obj":{"name":2,"name":3},"esc\"aped":4})");
+
+	CHECK(json.find(lsd::StringView("name")) != json.end());
+	CHECK(json.find(lsd::StringView("esc\"aped")) != json.end());
+
+	auto name = pool.intern("name");
+	CHECK(json.find(lsd::StringView("name"))->name() == name);
+	CHECK(json.at(lsd::StringView("obj")).find(lsd::StringView("name"))->name() == name);
+	CHECK(pool.size() == 3);
+
+	// the workers of a JSON lines parse use the pool of the calling thread
+	std::string lines;
+	for (int i = 0; i < 20000; i++) lines += "{\"line" + std::to_string(i % 100) + "\":" + std::to_string(i) + "}\n";
+
+	lsd::JsonKeyPool linesPool;
+	lsd::JsonKeyPool::Scope linesScope(linesPool);
+
+	auto globalSize = lsd::JsonKeyPool::global().size();
+	std::size_t count = 0;
+
+	auto result = lsd::tryParseJsonLines<lsd::InternedJson>(lsd::StringView(lines.data(), lines.size()), [&](lsd::InternedJson&& record) {
+		CHECK(record.begin()->name() == linesPool.intern(record.begin()->name().view()));
+		++count;
+	}, lsd::JsonLinesOrder::unordered, 4);
+
+	CHECK(result.has_value() && count == 20000);
+	CHECK(linesPool.size() == 100);
+	CHECK(lsd::JsonKeyPool::global().size() == globalSize);
+}
+
+static void checkArena() {
+	lsd::detail::StringArena arena(256);
+	CHECK(arena.blockCount() == 0);
+
+	auto a = arena.allocate(10, 1);
+	auto b = arena.allocate(16, 16);
+	CHECK(reinterpret_cast<std::uintptr_t>(b) % 16 == 0);
+	CHECK(static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 10);
+	CHECK(arena.blockCount() == 1);
+
+	// allocations larger than a block get a block of their own
+	auto large = arena.allocate(1000, 64);
+	CHECK(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+	CHECK(arena.blockCount() == 2);
+
+	lsd::detail::StringArena moved(std::move(arena));
+	CHECK(moved.blockCount() == 2 && arena.blockCount() == 0);
+
+	moved.release();
+	CHECK(moved.blockCount() == 0);
+	CHECK(moved.allocate(8) != nullptr && moved.blockCount() == 1);
+}
+
+int main() {
+	checkInterning();
+	checkScope();
+	checkShards();
+	checkJsonKeys();
+	checkArena();
+
+	std::printf("InternedString: %d failures\n", failures);
+	return failures != 0;
+}
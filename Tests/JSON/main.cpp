@@ -37,7 +37,7 @@ inline constexpr auto jsonTest = "{\
 		{ \"id\": 2 , \"value\" : \"B\" },\
 		{  \"id\"   :3 , \"value\":\"C\"   }\
 	] ,\
-	\"escapedCharacters\" :\"Quotes: \\\" Backslash: \\\\\\ Newline: \\\\n Tab: \\\\t\"  ,\
+	\"escapedCharacters\" :\"Quotes: \\\" Backslash: \\\\ Newline: \\\\n Tab: \\\\t\"  ,\
 	\"unicodeCharacters\":    \"\\u0041\\u00E9\\u672C\",\
 	\"emptyObject\": {  } ,\
 	\"largeNumber\"  :1234567890123456789 ,  \
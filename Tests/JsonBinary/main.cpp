@@ -0,0 +1,116 @@
+#include <LSD/Vector.h>
+#include <LSD/JSON.h>
+#include <LSD/JsonBinary.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+
+inline constexpr auto document = R"({
+	"unsigned": 1,
+	"signed": -5,
+	"floating": 3.25,
+	"inexact": 0.1,
+	"string": "hello",
+	"long string": "0123456789012345678901234567890123456789",
+	"escapes": "q\"b\\c\n\u0001",
+	"array": [ 1, 2, { "true": true, "null": null } ],
+	"empty": [ ],
+	"false": false,
+	"max": 18446744073709551615,
+	"min": -9223372036854775807
+})";
+
+static bool sameBytes(const lsd::Vector<std::uint8_t>& bytes, std::initializer_list<std::uint8_t> expected) {
+	return bytes.size() == expected.size() && std::equal(bytes.begin(), bytes.end(), expected.begin());
+}
+
+// every prefix of an encoded document is missing data and has to be rejected
+template <class Decode> static void checkTruncated(const lsd::Vector<std::uint8_t>& bytes, Decode decode) {
+	for (std::size_t size = 0; size < bytes.size(); size++) {
+		bool threw = false;
+
+		try {
+			(void) decode(bytes.data(), size);
+		} catch (const lsd::JsonParseError&) {
+			threw = true;
+		}
+
+		CHECK(threw);
+	}
+}
+
+template <class Encode, class Decode> static void checkRoundTrip(Encode encode, Decode decode) {
+	auto json = lsd::Json::parse(document);
+	auto bytes = encode(json);
+	lsd::Json back = decode(bytes.data(), bytes.size());
+
+	CHECK(bytes.size() < json.stringify().size());
+	CHECK(back.stringify() == json.stringify());
+
+	CHECK(back.at("unsigned").isUnsigned() && back.at("unsigned").unsignedInt() == 1);
+	CHECK(back.at("signed").isSigned() && back.at("signed").signedInt() == -5);
+	CHECK(back.at("floating").floating() == 3.25);
+	CHECK(back.at("inexact").floating() == 0.1);
+	CHECK(back.at("escapes").get<lsd::String>() == "q\"b\\c\n\x01");
+	CHECK(back.at("array").get<lsd::Json::array_type>()[2].at("true").boolean());
+	CHECK(back.at("array").get<lsd::Json::array_type>()[2].at("null").isNull());
+	CHECK(back.at("empty").get<lsd::Json::array_type>().empty());
+	CHECK(back.at("max").unsignedInt() == 18446744073709551615ull);
+	CHECK(back.at("min").signedInt() == -9223372036854775807ll);
+
+	// encoding is deterministic, so the decoded document encodes to the same bytes
+	auto again = encode(back);
+	CHECK(again.size() == bytes.size() && std::equal(again.begin(), again.end(), bytes.begin()));
+
+	checkTruncated(bytes, decode);
+}
+
+int main() {
+	checkRoundTrip(
+		[](const lsd::Json& json) { return lsd::toMsgPack(json); },
+		[](const std::uint8_t* data, std::size_t size) { return lsd::fromMsgPack(data, size); }
+	);
+	checkRoundTrip(
+		[](const lsd::Json& json) { return lsd::toCbor(json); },
+		[](const std::uint8_t* data, std::size_t size) { return lsd::fromCbor(data, size); }
+	);
+
+	// smallest encodings of a single pair
+	{
+		auto json = lsd::Json::parse(R"({"a": 1})");
+
+		CHECK(sameBytes(lsd::toMsgPack(json), { 0x81, 0xA1, 'a', 0x01 }));
+		CHECK(sameBytes(lsd::toCbor(json), { 0xA1, 0x61, 'a', 0x01 }));
+	}
+
+	// CBOR features that are only decoded: indefinite arrays, half floats and tags
+	{
+		const std::uint8_t bytes[] = { 0xA1, 0x61, 'x', 0x9F, 0xF9, 0x3C, 0x00, 0xC1, 0x01, 0x20, 0xFF };
+		auto json = lsd::fromCbor(bytes, sizeof(bytes));
+		const auto& array = json.at("x").get<lsd::Json::array_type>();
+
+		CHECK(array.size() == 3);
+		CHECK(array[0].floating() == 1.0);
+		CHECK(array[1].unsignedInt() == 1);
+		CHECK(array[2].signedInt() == -1);
+	}
+
+	// trailing data after the document is an error
+	{
+		const std::uint8_t bytes[] = { 0x01, 0x02 };
+		bool threw = false;
+
+		try {
+			(void) lsd::fromMsgPack(bytes, sizeof(bytes));
+		} catch (const lsd::JsonParseError&) {
+			threw = true;
+		}
+
+		CHECK(threw);
+	}
+
+	std::printf("JsonBinary: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,209 @@
+#include <LSD/JsonBinding.h>
+#include <LSD/Vector.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <cfloat>
+#include <cstring>
+#include <optional>
+
+struct Point {
+	int x = 0;
+	int y = 0;
+};
+
+struct Shape {
+	lsd::String name;
+	double scale = 1.0;
+	bool visible = false;
+	std::uint64_t id = 0;
+	std::optional<int> layer;
+	Point origin;
+	lsd::Vector<Point> points;
+	lsd::Vector<lsd::String> tags;
+};
+
+template <> struct lsd::JsonBinding<Point> {
+	static constexpr auto fields = lsd::jsonFields(JSON_FIELD(Point, x), JSON_FIELD(Point, y));
+};
+
+template <> struct lsd::JsonBinding<Shape> {
+	static constexpr auto fields = lsd::jsonFields(
+		JSON_FIELD(Shape, name),
+		JSON_FIELD(Shape, scale),
+		JSON_FIELD(Shape, visible),
+		JSON_FIELD(Shape, id),
+		JSON_FIELD(Shape, layer),
+		JSON_FIELD(Shape, origin),
+		JSON_FIELD(Shape, points),
+		JSON_FIELD(Shape, tags)
+	);
+};
+
+// returns true if parsing the text into a value of Ty threw a JsonParseError
+template <class Ty> static bool rejects(const char* text) {
+	try {
+		Ty value { };
+		lsd::fromJson(text, value);
+	} catch (const lsd::JsonParseError&) {
+		return true;
+	}
+
+	return false;
+}
+
+static bool equal(const Point& a, const Point& b) {
+	return a.x == b.x && a.y == b.y;
+}
+
+static bool equal(const Shape& a, const Shape& b) {
+	if (a.name != b.name || a.scale != b.scale || a.visible != b.visible || a.id != b.id || a.layer != b.layer || !equal(a.origin, b.origin)) return false;
+	if (a.points.size() != b.points.size() || a.tags.size() != b.tags.size()) return false;
+
+	for (std::size_t i = 0; i < a.points.size(); i++)
+		if (!equal(a.points[i], b.points[i])) return false;
+	for (std::size_t i = 0; i < a.tags.size(); i++)
+		if (a.tags[i] != b.tags[i]) return false;
+
+	return true;
+}
+
+static void checkFields() {
+	constexpr auto& fields = lsd::JsonBinding<Point>::fields;
+
+	CHECK(std::get<0>(fields).name == "x");
+	CHECK(std::get<1>(fields).name == "y");
+	CHECK(std::get<1>(fields).member == &Point::y);
+
+	CHECK(lsd::detail::jsonFieldTable<Point>.perfect);
+	CHECK(lsd::detail::jsonFieldTable<Shape>.perfect);
+
+	// every name has to hash to the slot holding its own index
+	constexpr auto& table = lsd::detail::jsonFieldTable<Shape>;
+	constexpr auto& names = lsd::detail::jsonBindingFieldNames<Shape>;
+	for (std::size_t i = 0; i < names.size(); i++)
+		CHECK(table.slots[lsd::detail::jsonFieldHash(names[i].data(), names[i].size(), table.seed) & table.mask] == i);
+}
+
+static void checkRoundTrip() {
+	Shape shape;
+	shape.name = "tri\"angle\\\n";
+	shape.scale = 0.1;
+	shape.visible = true;
+	shape.id = UINT64_MAX;
+	shape.layer = -3;
+	shape.origin = { -1, 2 };
+	shape.points.pushBack({ 0, 0 });
+	shape.points.pushBack({ 10, -20 });
+	shape.tags.pushBack("a");
+	shape.tags.pushBack("");
+
+	auto text = lsd::toJson(shape);
+	auto back = lsd::fromJson<Shape>(text);
+	CHECK(equal(shape, back));
+	CHECK(lsd::toJson(back) == text);
+
+	shape.layer.reset();
+	shape.points.clear();
+	text = lsd::toJson(shape);
+	CHECK(std::strstr(text.cStr(), "\"layer\":null") != nullptr);
+	CHECK(std::strstr(text.cStr(), "\"points\":[]") != nullptr);
+	CHECK(equal(shape, lsd::fromJson<Shape>(text)));
+
+	CHECK(lsd::toJson(Point { 3, -4 }) == "{\"x\":3,\"y\":-4}");
+}
+
+static void checkKeys() {
+	// unknown keys are skipped, including nested values and numbers outside of any member range
+	auto point = lsd::fromJson<Point>(R"({"z":{"a":[1,2,{"b":null}],"c":"}"},"x":1,"w":1e999,"y":2,"v":-0.5E-3})");
+	CHECK(point.x == 1 && point.y == 2);
+
+	// missing keys leave their members untouched
+	Point partial { 7, 8 };
+	lsd::fromJson(R"({"y":5})", partial);
+	CHECK(partial.x == 7 && partial.y == 5);
+
+	lsd::fromJson("{}", partial);
+	CHECK(partial.x == 7 && partial.y == 5);
+
+	// with duplicate keys the last one wins, sequences and strings are replaced instead of appended
+	point = lsd::fromJson<Point>(R"({"x":1,"x":2,"y":3,"y":4})");
+	CHECK(point.x == 2 && point.y == 4);
+
+	auto shape = lsd::fromJson<Shape>(R"({"name":"a","tags":["x","y"],"name":"b","tags":["z"]})");
+	CHECK(shape.name == "b");
+	CHECK(shape.tags.size() == 1 && shape.tags[0] == "z");
+
+	// keys are matched exactly, a prefix or different case is an unknown key
+	point = lsd::fromJson<Point>(R"({"X":1,"xx":2,"":3,"x ":4})");
+	CHECK(point.x == 0 && point.y == 0);
+
+	// escaped keys are decoded before the lookup
+	point = lsd::fromJson<Point>(R"({"\u0078":9,"\/y":1})");
+	CHECK(point.x == 9 && point.y == 0);
+}
+
+static void checkNumbers() {
+	struct { const char* text; double value; } floats[] = {
+		{ R"({"scale":1E+3})", 1000.0 },
+		{ R"({"scale":1e+10})", 1e10 },
+		{ R"({"scale":1e300})", 1e300 },
+		{ R"({"scale":-1.7976931348623157e308})", -DBL_MAX },
+		{ R"({"scale":2.2250738585072014e-308})", DBL_MIN },
+		{ R"({"scale":0.1})", 0.1 },
+		{ R"({"scale":-0.0})", -0.0 },
+		{ R"({"scale":5})", 5.0 },
+	};
+
+	for (const auto& f : floats) {
+		auto shape = lsd::fromJson<Shape>(f.text);
+		CHECK(shape.scale == f.value);
+	}
+
+	CHECK(lsd::fromJson<Shape>(R"({"id":18446744073709551615})").id == UINT64_MAX);
+	CHECK(lsd::fromJson<Point>(R"({"x":-2147483648})").x == INT32_MIN);
+
+	CHECK(rejects<Point>(R"({"x":2147483648})"));
+	CHECK(rejects<Point>(R"({"x":1.5})"));
+	CHECK(rejects<Point>(R"({"x":1e2})"));
+	CHECK(rejects<Shape>(R"({"id":-1})"));
+
+	const char* invalid[] = { "01", "1.", ".5", "-", "+1", "1e", "1e+", "1.e5", "-01", "1-2", "0x10" };
+	for (auto number : invalid) {
+		char text[64];
+		std::snprintf(text, sizeof(text), R"({"scale":%s})", number);
+		CHECK(rejects<Shape>(text));
+
+		// skipped values have to follow the grammar as well
+		std::snprintf(text, sizeof(text), R"({"unknown":%s})", number);
+		CHECK(rejects<Point>(text));
+	}
+}
+
+static void checkErrors() {
+	CHECK(rejects<Point>(""));
+	CHECK(rejects<Point>("[]"));
+	CHECK(rejects<Point>(R"({"x":1)"));
+	CHECK(rejects<Point>(R"({"x" 1})"));
+	CHECK(rejects<Point>(R"({"x":1,})"));
+	CHECK(rejects<Point>(R"({"x":1} x)"));
+	CHECK(rejects<Point>(R"({"x":true})"));
+	CHECK(rejects<Shape>(R"({"name":1})"));
+	CHECK(rejects<Shape>(R"({"name":"\q"})"));
+	CHECK(rejects<Shape>(R"({"visible":tru})"));
+	CHECK(rejects<Shape>(R"({"layer":nul})"));
+	CHECK(!rejects<Shape>(R"({"layer":null})"));
+}
+
+int main() {
+	checkFields();
+	checkRoundTrip();
+	checkKeys();
+	checkNumbers();
+	checkErrors();
+
+	std::printf("JsonBinding: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,173 @@
+#include <LSD/JsonLines.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// a buffer of records {"i":N} with the offset of every record, large enough to be split into many chunks
+struct Lines {
+	std::string text;
+	std::vector<std::size_t> offsets;
+
+	explicit Lines(std::size_t count) {
+		for (std::size_t i = 0; i < count; i++) {
+			if (i % 1000 == 7) text += " \r\n"; // blank lines are skipped
+
+			offsets.push_back(text.size());
+			text += "{\"i\":" + std::to_string(i) + ",\"pad\":\"................\"}\n";
+		}
+	}
+
+	// replaces record i with malformed text of the same length, the error is found at the returned offset
+	std::size_t corrupt(std::size_t i) {
+		text[offsets[i] + 5] = 'x';
+		return offsets[i] + 5;
+	}
+
+	std::size_t lineOf(std::size_t offset) const {
+		return static_cast<std::size_t>(std::count(text.begin(), text.begin() + offset, '\n')) + 1;
+	}
+
+	lsd::StringView view() const {
+		return lsd::StringView(text.data(), text.size());
+	}
+};
+
+static std::size_t idOf(lsd::Json& json) {
+	return json.find(lsd::String("i"))->get<std::uint64_t>();
+}
+
+// delivers the ids in ordered mode and checks that they arrive in buffer order with matching offsets
+static lsd::JsonParseResult<void> collectOrdered(const Lines& lines, std::vector<std::size_t>& ids, std::size_t threadCount) {
+	return lsd::tryParseJsonLines(lines.view(), [&](std::size_t offset, lsd::Json&& json) {
+		auto id = idOf(json);
+		CHECK(id == ids.size());
+		CHECK(id < lines.offsets.size() && offset == lines.offsets[id]);
+
+		ids.push_back(id);
+	}, lsd::JsonLinesOrder::ordered, threadCount);
+}
+
+static lsd::JsonParseResult<void> collectUnordered(const Lines& lines, std::vector<std::size_t>& ids, std::size_t threadCount) {
+	std::mutex mutex;
+	bool concurrent = false;
+
+	auto result = lsd::tryParseJsonLines(lines.view(), [&](lsd::Json&& json) {
+		// the callback is never invoked concurrently
+		if (!mutex.try_lock()) concurrent = true;
+		else {
+			ids.push_back(idOf(json));
+			mutex.unlock();
+		}
+	}, lsd::JsonLinesOrder::unordered, threadCount);
+
+	CHECK(!concurrent);
+	std::sort(ids.begin(), ids.end());
+	return result;
+}
+
+static void checkComplete() {
+	Lines lines(60000);
+
+	for (std::size_t threads : { 1, 3, 8 }) {
+		std::vector<std::size_t> ids;
+		CHECK(collectOrdered(lines, ids, threads).has_value());
+		CHECK(ids.size() == lines.offsets.size());
+
+		ids.clear();
+		CHECK(collectUnordered(lines, ids, threads).has_value());
+		CHECK(ids.size() == lines.offsets.size());
+		for (std::size_t i = 0; i < ids.size(); i++) CHECK(ids[i] == i);
+	}
+
+	std::vector<std::size_t> ids;
+	CHECK(lsd::tryParseJsonLines(lsd::StringView(""), [&](lsd::Json&&) { ids.push_back(0); }).has_value());
+	CHECK(lsd::tryParseJsonLines(lsd::StringView("\n \n\t\n"), [&](lsd::Json&&) { ids.push_back(0); }).has_value());
+	CHECK(ids.empty());
+
+	// the last record does not need a trailing separator
+	CHECK(lsd::tryParseJsonLines(lsd::StringView("{\"i\":0}\n{\"i\":1}"), [&](lsd::Json&& json) { ids.push_back(idOf(json)); }).has_value());
+	CHECK(ids.size() == 2 && ids[0] == 0 && ids[1] == 1);
+}
+
+static void checkError(Lines& lines, std::size_t first, std::size_t second) {
+	auto offset = lines.corrupt(first);
+	lines.corrupt(second);
+
+	for (std::size_t threads : { 1, 2, 4, 8 }) {
+		std::vector<std::size_t> ids;
+		auto result = collectOrdered(lines, ids, threads);
+
+		// every record in front of the first malformed one is delivered, nothing behind it
+		CHECK(!result && result.error().offset == offset);
+		CHECK(!result && result.error().line == lines.lineOf(offset));
+		CHECK(!result && result.error().column == 6);
+		CHECK(ids.size() == first);
+
+		ids.clear();
+		result = collectUnordered(lines, ids, threads);
+
+		CHECK(!result && result.error().offset == offset);
+		CHECK(ids.size() >= first);
+		for (std::size_t i = 0; i < std::min(ids.size(), first); i++) CHECK(ids[i] == i);
+	}
+}
+
+static void checkErrors() {
+	// errors in a middle chunk, in the first record and in the last record
+	{
+		Lines lines(60000);
+		checkError(lines, 31000, 45000);
+	}
+	{
+		Lines lines(60000);
+		checkError(lines, 30000, 30001);
+	}
+	{
+		Lines lines(60000);
+		checkError(lines, 0, 59999);
+	}
+	{
+		Lines lines(60000);
+		checkError(lines, 59999, 59999);
+	}
+
+	bool threw = false;
+	try {
+		lsd::parseJsonLines(lsd::StringView("{}\n[1,]\n"), [](lsd::Json&&) { });
+	} catch (const lsd::JsonParseError&) {
+		threw = true;
+	}
+	CHECK(threw);
+}
+
+static void checkCallbackException() {
+	Lines lines(60000);
+
+	for (auto order : { lsd::JsonLinesOrder::ordered, lsd::JsonLinesOrder::unordered }) {
+		bool threw = false;
+		try {
+			lsd::parseJsonLines(lines.view(), [](lsd::Json&& json) {
+				if (idOf(json) == 20000) throw std::logic_error("stop");
+			}, order, 4);
+		} catch (const std::logic_error&) {
+			threw = true;
+		}
+		CHECK(threw);
+	}
+}
+
+int main() {
+	checkComplete();
+	checkErrors();
+	checkCallbackException();
+
+	std::printf("JsonLines: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,136 @@
+#include <LSD/String.h>
+#include <LSD/StringView.h>
+#include <LSD/JSON.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cmath>
+
+inline constexpr auto escapeTest = R"({
+	"quote": "q\"b\\c",
+	"controls": "tab\tnewline\nbell\u0007end",
+	"unicode": "\u00e9\u4e00\ud83d\ude00",
+	"solidus": "a\/b",
+	"key \"with\" escapes\n": [ "\"", "\\", "\u001f", { "nested\\": "\b\f\r" } ]
+})";
+
+static void checkRoundTrip(const char* text) {
+	auto first = lsd::Json::parse(text);
+
+	auto compact = first.stringify();
+	auto pretty = first.stringifyPretty();
+
+	CHECK(compact.size() <= first.stringifySize());
+	CHECK(pretty.size() <= first.stringifyPrettySize());
+
+	// both outputs have to be valid JSON describing the same document
+	auto second = lsd::Json::tryParse(compact);
+	auto third = lsd::Json::tryParse(pretty);
+
+	CHECK(second.has_value());
+	CHECK(third.has_value());
+
+	if (second && third) {
+		CHECK(second->stringify() == compact);
+		CHECK(third->stringify() == compact);
+	}
+}
+
+static void checkError(const char* text, lsd::JsonErrorCode code, std::size_t offset, std::size_t line, std::size_t column) {
+	auto result = lsd::Json::tryParse(text);
+
+	CHECK(!result.has_value());
+	if (result.has_value()) return;
+
+	const auto& error = result.error();
+	CHECK(error.code == code);
+	CHECK(error.offset == offset);
+	CHECK(error.line == line);
+	CHECK(error.column == column);
+}
+
+int main() {
+	// escapes are decoded while parsing and written back on output
+	{
+		auto json = lsd::Json::parse(escapeTest);
+
+		CHECK(json["quote"].get<lsd::String>() == "q\"b\\c");
+		CHECK(json["controls"].get<lsd::String>() == "tab\tnewline\nbell\aend");
+		CHECK(json["unicode"].get<lsd::String>() == "\xC3\xA9\xE4\xB8\x80\xF0\x9F\x98\x80");
+		CHECK(json["solidus"].get<lsd::String>() == "a/b");
+
+		const auto& array = json["key \"with\" escapes\n"].get<lsd::Json::array_type>();
+		CHECK(array.size() == 4);
+		CHECK(array[0].get<lsd::String>() == "\"");
+		CHECK(array[2].get<lsd::String>() == "\x1F");
+
+		auto quote = lsd::Json::parse(R"({"a":"q\"b\\c"})");
+		CHECK(quote.stringify() == R"({"a":"q\"b\\c"})");
+
+		auto controls = lsd::Json::parse(R"(["\u0001\n"])");
+		CHECK(controls.stringify() == R"(["\u0001\n"])");
+	}
+
+	checkRoundTrip(escapeTest);
+	checkRoundTrip(R"({"a":"q\"b\\c"})");
+	checkRoundTrip(R"([1, -2, 3.5, true, false, null, "", [], {}])");
+
+	// exponents and zero fractions, stringify() writes exponents with a sign
+	checkRoundTrip(R"({"c":1e10})");
+	checkRoundTrip("[1E+2]");
+	checkRoundTrip("[0.0]");
+	checkRoundTrip("[-0.0]");
+	checkRoundTrip("[1e300]");
+	checkRoundTrip("[-1.7976931348623157e308]");
+
+	{
+		auto json = lsd::Json::parse("[1e10, 1E+2, 0.0, -0.0, 1e300, -1.7976931348623157e308, 2.2250738585072014e-308, 1e-2, 0.1, 18446744073709551616]");
+		const auto& array = json.get<lsd::Json::array_type>();
+
+		CHECK(array[0].floating() == 1e10);
+		CHECK(array[1].floating() == 100.0);
+		CHECK(array[2].floating() == 0.0);
+		CHECK(array[3].floating() == 0.0 && std::signbit(array[3].floating()));
+		CHECK(array[4].floating() == 1e300);
+		CHECK(array[5].floating() == -1.7976931348623157e308);
+		CHECK(array[6].floating() == 2.2250738585072014e-308);
+		CHECK(array[7].floating() == 0.01);
+		CHECK(array[8].floating() == 0.1);
+		CHECK(array[9].floating() == 18446744073709551616.0); // integers out of range become floating point numbers
+	}
+
+	// error positions point at the character where parsing stopped
+	checkError("{\"a\" 1}", lsd::JsonErrorCode::expectedColon, 5, 1, 6);
+	checkError("{\n\t\"a\": tru\n}", lsd::JsonErrorCode::invalidLiteral, 8, 2, 7);
+	checkError("[1, 2", lsd::JsonErrorCode::unexpectedEnd, 5, 1, 6);
+	checkError("[1 2]", lsd::JsonErrorCode::expectedCommaOrBracket, 3, 1, 4);
+	checkError("{\"a\": \"b\nc\"}", lsd::JsonErrorCode::controlCharacter, 8, 1, 9);
+	checkError("{\"a\": \"\\ud800\"}", lsd::JsonErrorCode::invalidUnicodeEscape, 12, 1, 13);
+	checkError("{} x", lsd::JsonErrorCode::trailingCharacters, 3, 1, 4);
+	checkError("[\"\\q\"]", lsd::JsonErrorCode::invalidEscape, 3, 1, 4);
+	checkError("[\"\\x41\"]", lsd::JsonErrorCode::invalidEscape, 3, 1, 4);
+
+	// numbers outside of the JSON grammar
+	checkError("[01]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[1.]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[1.e5]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[-]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[1e]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[1e+]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[1-2]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[-01]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[.5]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+	checkError("[+1]", lsd::JsonErrorCode::invalidNumber, 1, 1, 2);
+
+	{
+		auto result = lsd::Json::tryParse("[1, 2");
+		CHECK(!result.has_value());
+
+		lsd::JsonParseError exception(result.error());
+		CHECK(exception.error().offset == 5);
+	}
+
+	std::printf("JsonParse: %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+#include <LSD/JsonPath.h>
+#include <LSD/JSON.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <initializer_list>
+#include <stdexcept>
+
+// compares the keys of a path with the expected keys
+template <class Path> static bool keys(const Path& path, std::initializer_list<lsd::StringView> expected) {
+	if (path.size() != expected.size()) return false;
+
+	auto it = expected.begin();
+	for (const auto& segment : path) {
+		if (path.key(segment) != *it || segment.hash() != lsd::Hash<lsd::StringView>{}(*it)) return false;
+		++it;
+	}
+
+	return true;
+}
+
+// returns the name of the exception thrown while compiling a path
+template <std::size_t Capacity, std::size_t SegmentCapacity = (Capacity + 1) / 2> static const char* thrown(const char* path) {
+	try {
+		lsd::JsonPath<Capacity, SegmentCapacity> compiled { lsd::StringView(path) };
+		(void) compiled;
+	} catch (const std::out_of_range&) {
+		return "out_of_range";
+	} catch (const std::invalid_argument&) {
+		return "invalid_argument";
+	}
+
+	return "none";
+}
+
+static bool same(const char* a, const char* b) {
+	return lsd::StringView(a) == lsd::StringView(b);
+}
+
+// paths built from literals are compiled at compile time
+static_assert(lsd::JsonPath("a::b::0").size() == 3);
+static_assert(lsd::JsonPath("/a~1b").key(lsd::JsonPath("/a~1b")[0]) == "a/b");
+static_assert(lsd::JsonPath("/0/12")[1].index() == 12);
+
+// the segments are bounded separately from the characters
+static_assert(sizeof(lsd::JsonPath<64>) < sizeof(lsd::JsonPath<64, 64>));
+static_assert(sizeof(lsd::JsonPath<64, 4>) < sizeof(lsd::JsonPath<64>));
+
+static void checkScoped() {
+	CHECK(keys(lsd::JsonPath("a"), { "a" }));
+	CHECK(keys(lsd::JsonPath("a::bc::d"), { "a", "bc", "d" }));
+	CHECK(keys(lsd::JsonPath("a:b::c"), { "a:b", "c" }));
+	CHECK(keys(lsd::JsonPath("a:::b"), { "a", ":b" }));
+	CHECK(keys(lsd::JsonPath("::a::"), { "", "a", "" }));
+	CHECK(lsd::JsonPath("").empty());
+
+	auto path = lsd::JsonPath("items::10::010::0::18446744073709551616");
+	CHECK(!path[0].isIndex());
+	CHECK(path[1].isIndex() && path[1].index() == 10);
+	CHECK(!path[2].isIndex()); // leading zeros are keys
+	CHECK(path[3].isIndex() && path[3].index() == 0);
+	CHECK(!path[4].isIndex()); // out of range of size_t
+}
+
+static void checkPointer() {
+	CHECK(keys(lsd::JsonPath("/"), { "" }));
+	CHECK(keys(lsd::JsonPath("/a/b/c"), { "a", "b", "c" }));
+	CHECK(keys(lsd::JsonPath("/a//b"), { "a", "", "b" }));
+	CHECK(keys(lsd::JsonPath("/a/"), { "a", "" }));
+	CHECK(keys(lsd::JsonPath("/a::b"), { "a::b" }));
+
+	// ~0 is a tilde and ~1 a slash, decoded in order so ~01 is "~1"
+	CHECK(keys(lsd::JsonPath("/~0/~1/~01/~10/a~1b~0c"), { "~", "/", "~1", "/0", "a/b~c" }));
+
+	CHECK(same(thrown<16>("/a~"), "invalid_argument"));
+	CHECK(same(thrown<16>("/a~2"), "invalid_argument"));
+	CHECK(same(thrown<16>("/~a"), "invalid_argument"));
+	CHECK(same(thrown<16>("/~/b"), "invalid_argument"));
+
+	auto wide = lsd::WJsonPath(L"/x~1y/3");
+	CHECK(wide.size() == 2 && wide.key(wide[0]) == L"x/y" && wide[1].index() == 3);
+}
+
+static void checkOverflow() {
+	CHECK(same(thrown<4>("abcd"), "none"));
+	CHECK(same(thrown<4>("abcde"), "out_of_range"));
+
+	// the default segment capacity fits every path with non empty segments
+	CHECK(same(thrown<8>("a::b::c"), "none"));
+	CHECK(same(thrown<8>("/a/b/c/d"), "none"));
+
+	// empty segments may exceed it
+	CHECK(same(thrown<8>("////////"), "out_of_range"));
+	CHECK(same(thrown<8, 8>("////////"), "none"));
+
+	CHECK(same(thrown<16, 2>("a::b"), "none"));
+	CHECK(same(thrown<16, 2>("a::b::c"), "out_of_range"));
+	CHECK(same(thrown<16, 2>("/a/b/c"), "out_of_range"));
+	CHECK(same(thrown<16, 1>("/"), "none"));
+	CHECK(same(thrown<16, 1>("//"), "out_of_range"));
+}
+
+static void checkResolve() {
+	auto json = lsd::Json::parse(R"({"a":{"b/c":[10,{"~d":true}]},"0":"zero"})");
+
+	auto found = json.resolve(lsd::JsonPath("/a/b~1c/1/~0d"));
+	CHECK(found && found->get<bool>());
+
+	CHECK(json.resolve(lsd::JsonPath("a::b/c::0"))->get<std::uint64_t>() == 10);
+	CHECK(json.resolve(lsd::JsonPath<8, 2>("/0"))->get<lsd::String>() == "zero");
+	CHECK(json.resolve(lsd::JsonPath("/a/b~1c/2")) == nullptr);
+	CHECK(json.resolve(lsd::JsonPath("/missing")) == nullptr);
+
+	bool threw = false;
+	try {
+		(void) json.child(lsd::JsonPath("/a/missing"));
+	} catch (const std::out_of_range&) {
+		threw = true;
+	}
+	CHECK(threw);
+}
+
+int main() {
+	checkScoped();
+	checkPointer();
+	checkOverflow();
+	checkResolve();
+
+	std::printf("JsonPath: %d failures\n", failures);
+	return failures != 0;
+}
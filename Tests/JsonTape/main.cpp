@@ -0,0 +1,206 @@
+#include <LSD/JsonTape.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+#include <stdexcept>
+
+// returns true if parsing the text threw a JsonParseError
+static bool rejects(const char* text) {
+	try {
+		(void) lsd::JsonTape::parse(text);
+	} catch (const lsd::JsonParseError&) {
+		return true;
+	}
+
+	return false;
+}
+
+static void checkValues() {
+	auto tape = lsd::JsonTape::parse(R"( {"null":null,"t":true,"f":false,"neg":-42,"pos":18446744073709551615,"big":18446744073709551616,
+		"pi":3.25,"exp":1E+3,"huge":1e300,"min":-9223372036854775808,"str":"a\"b\\c\/\né😀","empty":{},"list":[]} )");
+	auto root = tape.root();
+
+	CHECK(root.isObject());
+	CHECK(root.size() == 13);
+
+	CHECK(root["null"].isNull());
+	CHECK(root["t"].isBool() && root["t"].boolean());
+	CHECK(root["f"].isBool() && !root["f"].boolean());
+
+	CHECK(root["neg"].isSigned() && root["neg"].signedInteger() == -42);
+	CHECK(root["neg"].floating() == -42.0);
+	CHECK(root["pos"].isUnsigned() && root["pos"].unsignedInteger() == UINT64_MAX);
+	CHECK(root["min"].isSigned() && root["min"].signedInteger() == INT64_MIN);
+
+	// integers out of range of 64 bits are stored as floating point values
+	CHECK(root["big"].isFloating() && root["big"].floating() == 18446744073709551616.0);
+
+	CHECK(root["pi"].isFloating() && root["pi"].floating() == 3.25);
+	CHECK(root["exp"].isFloating() && root["exp"].floating() == 1000.0);
+	CHECK(root["huge"].floating() == 1e300);
+
+	CHECK(root["str"].isString() && root["str"].string() == "a\"b\\c/\n\xC3\xA9\xF0\x9F\x98\x80");
+
+	CHECK(root["empty"].isObject() && root["empty"].empty());
+	CHECK(root["list"].isArray() && root["list"].empty());
+	CHECK(root["empty"].begin() == root["empty"].end());
+
+	CHECK(!root.find("missing"));
+	CHECK(!root["neg"].find("x"));
+
+	bool threw = false;
+	try {
+		(void) root.at("missing");
+	} catch (const std::out_of_range&) {
+		threw = true;
+	}
+	CHECK(threw);
+
+	threw = false;
+	try {
+		(void) root["str"].signedInteger();
+	} catch (const std::runtime_error&) {
+		threw = true;
+	}
+	CHECK(threw);
+
+	threw = false;
+	try {
+		(void) root["neg"].unsignedInteger();
+	} catch (const std::runtime_error&) {
+		threw = true;
+	}
+	CHECK(threw);
+}
+
+static void checkIteration() {
+	auto tape = lsd::JsonTape::parse(R"([1,{"a":[2,3],"b":{"c":[4,[5]]}},"s",[],6.5,null])");
+	auto root = tape.root();
+
+	CHECK(root.isArray() && root.size() == 6);
+
+	// nested subtrees are skipped in one step, so the third element is found directly after the object
+	std::size_t count = 0;
+	lsd::JsonTapeType types[6] { };
+	for (auto field : root) {
+		CHECK(field.key().empty());
+		if (count < 6) types[count] = lsd::JsonTape::Cursor(field).type();
+		++count;
+	}
+
+	CHECK(count == 6);
+	CHECK(types[0] == lsd::JsonTapeType::unsignedInteger);
+	CHECK(types[1] == lsd::JsonTapeType::objectBegin);
+	CHECK(types[2] == lsd::JsonTapeType::string);
+	CHECK(types[3] == lsd::JsonTapeType::arrayBegin);
+	CHECK(types[4] == lsd::JsonTapeType::floating);
+	CHECK(types[5] == lsd::JsonTapeType::null);
+
+	CHECK(root[2].string() == "s");
+	CHECK(root[4].floating() == 6.5);
+
+	auto object = root[1];
+	const char* keys[] = { "a", "b" };
+	count = 0;
+	for (auto field : object) {
+		CHECK(count < 2 && field.key() == keys[count]);
+		++count;
+	}
+	CHECK(count == 2);
+
+	CHECK(object["b"]["c"][1][0].unsignedInteger() == 5);
+	CHECK(object["a"].size() == 2);
+
+	// the begin word of a container stores the index one past its end word
+	auto word = tape.tape()[object.index()];
+	CHECK(static_cast<std::size_t>(word & lsd::JsonTape::indexMask) == root[2].index());
+}
+
+static void checkPaths() {
+	auto tape = lsd::JsonTape::parse(R"({"a":{"b":[10,20,{"c":"deep"}]},"x/y":1,"t~":2,"0":3})");
+	auto root = tape.root();
+
+	CHECK(root.resolve(lsd::JsonPath("a::b::1")).unsignedInteger() == 20);
+	CHECK(root.resolve(lsd::JsonPath("a::b::2::c")).string() == "deep");
+	CHECK(root.resolve(lsd::JsonPath("/a/b/0")).unsignedInteger() == 10);
+	CHECK(root.resolve(lsd::JsonPath("/x~1y")).unsignedInteger() == 1);
+	CHECK(root.resolve(lsd::JsonPath("/t~0")).unsignedInteger() == 2);
+
+	// numeric segments are keys when applied to objects
+	CHECK(root.resolve(lsd::JsonPath("/0")).unsignedInteger() == 3);
+
+	CHECK(!root.resolve(lsd::JsonPath("a::b::3")));
+	CHECK(!root.resolve(lsd::JsonPath("a::missing")));
+	CHECK(!root.resolve(lsd::JsonPath("/a/b/0/c")));
+	CHECK(root.resolve(lsd::JsonPath<1>()) == root);
+}
+
+static void checkNumbers() {
+	CHECK(lsd::JsonTape::parse("[-0.0]").root()[0].isFloating());
+	CHECK(std::signbit(lsd::JsonTape::parse("[-0.0]").root()[0].floating()));
+	CHECK(lsd::JsonTape::parse("[0]").root()[0].isUnsigned());
+	CHECK(lsd::JsonTape::parse("[-0]").root()[0].isSigned());
+	CHECK(lsd::JsonTape::parse("[1e+10]").root()[0].floating() == 1e10);
+	CHECK(lsd::JsonTape::parse("[-1.7976931348623157e308]").root()[0].floating() == -DBL_MAX);
+	CHECK(lsd::JsonTape::parse("[2.2250738585072014e-308]").root()[0].floating() == DBL_MIN);
+	CHECK(lsd::JsonTape::parse("[0.1]").root()[0].floating() == 0.1);
+
+	const char* invalid[] = { "[01]", "[1.]", "[.5]", "[-]", "[+1]", "[1e]", "[1e+]", "[1.e5]", "[-01]", "[1-2]", "[0x10]", "[1e999]" };
+	for (auto text : invalid) CHECK(rejects(text));
+}
+
+static void checkErrors() {
+	CHECK(rejects("{"));
+	CHECK(rejects("[1,]"));
+	CHECK(rejects("[1 2]"));
+	CHECK(rejects(R"({"a" 1})"));
+	CHECK(rejects(R"({1:1})"));
+	CHECK(rejects("[tru]"));
+	CHECK(rejects("[1] 2"));
+	CHECK(rejects(R"(["\q"])"));
+	CHECK(rejects(R"(["\ud800"])"));
+	CHECK(rejects(R"(["\u12g4"])"));
+	CHECK(rejects("[\"a\nb\"]"));
+	CHECK(rejects("[\"\xC3\"]"));
+
+	// an empty document is an empty object
+	auto empty = lsd::JsonTape::parse("  ");
+	CHECK(empty.root().isObject() && empty.root().empty());
+}
+
+static void checkWide() {
+	auto tape = lsd::WJsonTape::parse(LR"({"k":[1,"é😀"]})");
+	auto array = tape.root()[L"k"];
+
+	CHECK(array.size() == 2);
+	CHECK(array[0].unsignedInteger() == 1);
+
+	if constexpr (sizeof(wchar_t) == 2) CHECK(array[1].string() == L"é\xD83D\xDE00");
+	else CHECK(array[1].string() == L"é\U0001F600");
+}
+
+static void checkMemory() {
+	auto tape = lsd::JsonTape::parse(R"({"a":"bc","d":[1,2,3]})");
+	tape.shrinkToFit();
+
+	CHECK(tape.tape().size() == 16);
+	CHECK(tape.strings().size() == 4);
+	CHECK(tape.memoryUsage() == tape.tape().capacity() * sizeof(std::uint64_t) + tape.strings().capacity());
+}
+
+int main() {
+	checkValues();
+	checkIteration();
+	checkPaths();
+	checkNumbers();
+	checkErrors();
+	checkWide();
+	checkMemory();
+
+	std::printf("JsonTape: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,149 @@
+#include <LSD/MathExt.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+
+// strong pseudoprimes to the smaller sets of Miller-Rabin bases, which a test with too few bases accepts
+static_assert(!lsd::isPrime(3215031751ULL)); // bases 2, 3, 5 and 7
+static_assert(!lsd::isPrime(3825123056546413051ULL)); // bases 2 to 23
+static_assert(lsd::isPrime(18446744073709551557ULL));
+static_assert(lsd::nextPrime(1000) == 1009);
+static_assert(lsd::lastPrime(1000) == 997);
+
+static_assert(lsd::FastModulus(7).reduce(100) == 2);
+static_assert(lsd::tablePrimeAtLeast(0).divisor() == 2);
+
+static std::uint64_t state = 88172645463325252ULL;
+
+static std::uint64_t random64() { // xorshift64
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+// trial division, only used for numbers small enough to check quickly
+static bool referencePrime(std::uint64_t n) {
+	if (n < 2) return false;
+	for (std::uint64_t i = 2; i * i <= n; i++) if (n % i == 0) return false;
+	return true;
+}
+
+static void checkIsPrime() {
+	for (std::uint64_t n = 0; n < 100000; n++) {
+		if (lsd::isPrime(n) != referencePrime(n)) {
+			CHECK(lsd::isPrime(n) == referencePrime(n));
+			break;
+		}
+	}
+
+	// around the switch from trial division to Miller-Rabin
+	for (std::uint64_t n = 65000; n < 70000; n++) CHECK(lsd::isPrime(n) == referencePrime(n));
+
+	CHECK(!lsd::isPrime(3215031751ULL));
+	CHECK(!lsd::isPrime(3825123056546413051ULL));
+	CHECK(!lsd::isPrime(2152302898747ULL)); // strong pseudoprime to the bases 2 to 11
+	CHECK(!lsd::isPrime(341550071728321ULL)); // strong pseudoprime to the bases 2 to 17
+	CHECK(!lsd::isPrime(4294967297ULL)); // 641 * 6700417
+	CHECK(!lsd::isPrime(18446744073709551615ULL));
+	CHECK(!lsd::isPrime(4294967291ULL * 4294967279ULL));
+
+	CHECK(lsd::isPrime(4294967291ULL)); // largest prime below 2^32
+	CHECK(lsd::isPrime(2305843009213693951ULL)); // 2^61 - 1
+	CHECK(lsd::isPrime(18446744073709551557ULL)); // largest prime below 2^64
+
+	// signed numbers
+	CHECK(!lsd::isPrime(-7));
+	CHECK(lsd::isPrime(2147483647));
+	CHECK(!lsd::isPrime(static_cast<std::int64_t>(3215031751LL)));
+}
+
+static void checkFastModulus(std::uint64_t divisor) {
+	lsd::FastModulus modulus(divisor);
+	CHECK(modulus.divisor() == divisor);
+
+	const std::uint64_t edges[] = { 0, 1, 2, divisor - 1, divisor, divisor + 1, divisor * 2, divisor * 2 - 1, UINT64_MAX, UINT64_MAX - 1, UINT64_MAX / 2, 1ULL << 63, (1ULL << 32) - 1, 1ULL << 32 };
+	for (auto n : edges) {
+		if (modulus.reduce(n) != n % divisor) {
+			std::printf("%llu %% %llu\n", static_cast<unsigned long long>(n), static_cast<unsigned long long>(divisor));
+			CHECK(modulus.reduce(n) == n % divisor);
+		}
+	}
+
+	for (int i = 0; i < 2000; i++) {
+		auto n = random64() >> (i % 64);
+		if (modulus.reduce(n) != n % divisor) {
+			std::printf("%llu %% %llu\n", static_cast<unsigned long long>(n), static_cast<unsigned long long>(divisor));
+			CHECK(modulus.reduce(n) == n % divisor);
+		}
+	}
+}
+
+static void checkFastModuli() {
+	for (std::uint64_t divisor = 1; divisor < 300; divisor++) checkFastModulus(divisor);
+	for (int shift = 1; shift < 64; shift++) {
+		checkFastModulus(1ULL << shift);
+		checkFastModulus((1ULL << shift) - 1);
+		checkFastModulus((1ULL << shift) + 1);
+	}
+
+	checkFastModulus(UINT64_MAX);
+	checkFastModulus(UINT64_MAX - 1);
+	checkFastModulus(18446744073709551557ULL);
+	checkFastModulus(4294967291ULL);
+
+	for (int i = 0; i < 200; i++) {
+		auto divisor = random64() >> (i % 64);
+		checkFastModulus(divisor == 0 ? 1 : divisor);
+	}
+
+	// a default constructed modulus divides by 1
+	lsd::FastModulus one;
+	CHECK(one.divisor() == 1);
+	CHECK(one.reduce(12345) == 0);
+}
+
+static void checkPrimeTable() {
+	const auto& table = lsd::detail::primeModulusTable;
+
+	CHECK(table.size > 1 && table.size <= 64);
+	CHECK(table.entries[0].divisor() == 2);
+	CHECK(table.entries[table.size - 1].divisor() == 18446744073709551557ULL);
+
+	for (std::size_t i = 0; i < table.size; i++) {
+		auto prime = table.entries[i].divisor();
+		CHECK(lsd::isPrime(prime));
+
+		if (prime < 100000) CHECK(referencePrime(prime));
+
+		// the primes at least double and are the next prime after doubling the previous one
+		if (i > 0 && i + 1 < table.size) {
+			auto previous = table.entries[i - 1].divisor();
+			CHECK(prime > previous * 2);
+			CHECK(prime == lsd::nextPrime(previous * 2));
+		}
+
+		CHECK(table.entries[i].reduce(UINT64_MAX) == UINT64_MAX % prime);
+		CHECK(table.entries[i].reduce(prime * 3 + 1) == (prime * 3 + 1) % prime);
+
+		// the lookup finds every prime and the one after for every number in between
+		CHECK(&lsd::tablePrimeAtLeast(prime) == &table.entries[i]);
+		if (i > 0) CHECK(&lsd::tablePrimeAtLeast(table.entries[i - 1].divisor() + 1) == &table.entries[i]);
+		if (prime > 2) CHECK(&lsd::tablePrimeAtLeast(prime - 1) == &table.entries[i]);
+	}
+
+	CHECK(lsd::tablePrimeAtLeast(0).divisor() == 2);
+	CHECK(lsd::tablePrimeAtLeast(UINT64_MAX).divisor() == 18446744073709551557ULL);
+}
+
+int main() {
+	checkIsPrime();
+	checkFastModuli();
+	checkPrimeTable();
+
+	std::printf("MathExt: %d failures\n", failures);
+	return failures != 0;
+}
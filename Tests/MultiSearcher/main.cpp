@@ -0,0 +1,187 @@
+#include <LSD/MultiSearcher.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using Match = lsd::MultiSearchMatch;
+
+// scalar reference implementation, duplicate patterns are reported with the index of the first one
+
+static bool firstOccurence(const std::vector<std::string>& patterns, std::size_t index) {
+	for (std::size_t i = 0; i < index; i++) if (patterns[i] == patterns[index]) return false;
+	return true;
+}
+
+static std::vector<Match> referenceAll(const std::vector<std::string>& patterns, const std::string& text) {
+	std::vector<Match> matches;
+
+	for (std::size_t position = 0; position < text.size(); position++)
+		for (std::size_t i = 0; i < patterns.size(); i++)
+			if (!patterns[i].empty() && firstOccurence(patterns, i) && text.compare(position, patterns[i].size(), patterns[i]) == 0)
+				matches.push_back({ i, position, patterns[i].size() });
+
+	return matches;
+}
+
+static Match referenceFirst(const std::vector<std::string>& patterns, const std::string& text, std::size_t from = 0) {
+	Match best;
+
+	for (const auto& m : referenceAll(patterns, text))
+		if (m.position >= from && (!best || m.position < best.position || (m.position == best.position && m.length > best.length))) best = m;
+
+	return best;
+}
+
+static std::vector<Match> referenceLeftmostLongest(const std::vector<std::string>& patterns, const std::string& text) {
+	std::vector<Match> matches;
+
+	for (auto m = referenceFirst(patterns, text); m; m = referenceFirst(patterns, text, m.position + m.length)) matches.push_back(m);
+
+	return matches;
+}
+
+// runs every search of a searcher against the reference and returns true if all of them agree
+static bool agrees(const lsd::MultiSearcher& searcher, const std::vector<std::string>& patterns, const std::string& text) {
+	lsd::StringView view(text.data(), text.size());
+
+	auto all = searcher.findAll(view);
+	auto expectedAll = referenceAll(patterns, text);
+	if (!std::equal(all.begin(), all.end(), expectedAll.begin(), expectedAll.end())) return false;
+
+	if (searcher.findFirst(view) != referenceFirst(patterns, text)) return false;
+	if (searcher.contains(view) != !expectedAll.empty()) return false;
+
+	std::vector<Match> leftmostLongest;
+	searcher.findLeftmostLongest(view, [&leftmostLongest](const Match& m) { leftmostLongest.push_back(m); });
+
+	return leftmostLongest == referenceLeftmostLongest(patterns, text);
+}
+
+static lsd::MultiSearcher build(const std::vector<std::string>& patterns) {
+	std::vector<lsd::StringView> views;
+	for (const auto& p : patterns) views.emplace_back(p.data(), p.size());
+
+	return lsd::MultiSearcher(views);
+}
+
+static void checkStrategy() {
+	std::vector<std::string> small { "he", "she", "his", "hers" };
+	std::vector<std::string> large;
+	for (int i = 0; i < 20; i++) large.push_back("p" + std::to_string(i));
+
+#if defined(__SSSE3__)
+	CHECK(build(small).usesTeddy());
+#else
+	CHECK(!build(small).usesTeddy());
+#endif
+	CHECK(!build(large).usesTeddy());
+
+	// empty patterns don't count towards the limit of the fingerprint filter and never match
+	auto withEmpty = small;
+	for (int i = 0; i < 20; i++) withEmpty.push_back("");
+	CHECK(build(withEmpty).usesTeddy() == build(small).usesTeddy());
+	CHECK(agrees(build(withEmpty), withEmpty, "ushers"));
+}
+
+static void checkExamples() {
+	// the classic Aho-Corasick example, searched with both strategies by padding the set with patterns that never occur
+	std::vector<std::string> patterns { "he", "she", "his", "hers" };
+	auto padded = patterns;
+	for (int i = 0; i < 20; i++) padded.push_back("#" + std::to_string(i) + "#");
+
+	for (const auto& set : { patterns, padded }) {
+		auto searcher = build(set);
+
+		auto all = searcher.findAll(lsd::StringView("ushers"));
+		CHECK(all.size() == 3);
+		CHECK(all.size() == 3 && all[0] == (Match { 1, 1, 3 }) && all[1] == (Match { 0, 2, 2 }) && all[2] == (Match { 3, 2, 4 }));
+
+		CHECK(searcher.findFirst(lsd::StringView("ushers")) == (Match { 1, 1, 3 }));
+		CHECK(searcher.findFirst(lsd::StringView("hershe")) == (Match { 3, 0, 4 }));
+		CHECK(!searcher.findFirst(lsd::StringView("xyz")));
+		CHECK(!searcher.findFirst(lsd::StringView("")));
+
+		std::vector<Match> leftmostLongest;
+		searcher.findLeftmostLongest(lsd::StringView("hishershe"), [&](const Match& m) { leftmostLongest.push_back(m); });
+		CHECK(leftmostLongest == (std::vector<Match> { { 2, 0, 3 }, { 3, 3, 4 }, { 0, 7, 2 } }));
+
+		// the search stops as soon as the function returns false
+		std::size_t calls = 0;
+		searcher.findAll(lsd::StringView("he he he he"), [&calls](const Match&) { return ++calls < 2; });
+		CHECK(calls == 2);
+	}
+
+	// duplicates are reported with the first index, the longest pattern wins at the same position
+	std::vector<std::string> overlapping { "ab", "abcd", "ab", "abc", "bcd" };
+	auto searcher = build(overlapping);
+	CHECK(searcher.findFirst(lsd::StringView("xabcd")) == (Match { 1, 1, 4 }));
+	CHECK(agrees(searcher, overlapping, "abcdabcabab"));
+	CHECK(searcher.patternCount() == 5 && searcher.pattern(3) == "abc");
+
+	lsd::MultiSearcher none;
+	CHECK(!none.findFirst(lsd::StringView("anything")));
+	CHECK(none.findAll(lsd::StringView("anything")).empty());
+}
+
+static void checkBoundaries() {
+	// matches right at the end of the 16 byte blocks of the fingerprint filter and at the end of the text
+	std::vector<std::string> patterns { "xyz", "zz", "abcdefghijklmnopqrstuvwxyz" };
+
+	for (std::size_t size = 0; size < 70; size++) {
+		for (std::size_t at = 0; at + 3 <= size; at++) {
+			std::string text(size, '.');
+			text.replace(at, 3, "xyz");
+
+			CHECK(agrees(build(patterns), patterns, text));
+		}
+	}
+
+	std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+	CHECK(agrees(build(patterns), patterns, alphabet));
+	CHECK(agrees(build(patterns), patterns, "-" + alphabet + alphabet));
+
+	// bytes above 127 and zero bytes go through the high nibble table like any other byte
+	std::vector<std::string> binary { std::string("\xFF\x80", 2), std::string("\0\x01", 2), std::string("\xE9", 1) };
+	std::string text;
+	for (int i = 0; i < 100; i++) text += static_cast<char>(i * 37);
+	text += std::string("\xFF\x80\0\x01\xE9", 5);
+
+	CHECK(agrees(build(binary), binary, text));
+}
+
+static void checkRandom() {
+	std::mt19937 random(1234);
+
+	for (int round = 0; round < 600; round++) {
+		// few distinct letters give many overlapping matches, the pattern count crosses the limit of the fingerprint filter
+		auto letters = 2 + random() % 3;
+		auto count = 1 + random() % 28;
+
+		std::vector<std::string> patterns(count);
+		for (auto& p : patterns) {
+			auto length = 1 + random() % 6;
+			for (std::size_t i = 0; i < length; i++) p += static_cast<char>('a' + random() % letters);
+		}
+
+		std::string text;
+		auto length = random() % 120;
+		for (std::size_t i = 0; i < length; i++) text += static_cast<char>('a' + random() % letters);
+
+		CHECK(agrees(build(patterns), patterns, text));
+	}
+}
+
+int main() {
+	checkStrategy();
+	checkExamples();
+	checkBoundaries();
+	checkRandom();
+
+	std::printf("MultiSearcher: %d failures\n", failures);
+	return failures != 0;
+}
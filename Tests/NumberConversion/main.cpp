@@ -0,0 +1,143 @@
+#include <LSD/String.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <bit>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+// runs a conversion and reports the exception it threw, if any
+template <class Function> static const char* thrown(Function function) {
+	try {
+		(void) function();
+	} catch (const std::out_of_range&) {
+		return "out_of_range";
+	} catch (const std::invalid_argument&) {
+		return "invalid_argument";
+	}
+
+	return "none";
+}
+
+static bool same(const char* a, const char* b) {
+	return std::strcmp(a, b) == 0;
+}
+
+static void checkIntegers() {
+	std::size_t pos = 0;
+
+	CHECK(lsd::stoi("42") == 42);
+	CHECK(lsd::stoi("  -17xyz", &pos) == -17 && pos == 5);
+	CHECK(lsd::stoi("+8") == 8);
+	CHECK(lsd::stoi("ff", nullptr, 16) == 255);
+	CHECK(lsd::stoi("0x1f", &pos, 0) == 31 && pos == 4);
+	CHECK(lsd::stoi("017", nullptr, 0) == 15);
+	CHECK(lsd::stoi("-2147483648") == INT_MIN);
+	CHECK(lsd::stol("-9223372036854775808") == LONG_MIN);
+	CHECK(lsd::stoll("9223372036854775807") == LLONG_MAX);
+	CHECK(lsd::stoul("18446744073709551615") == ULONG_MAX);
+	CHECK(lsd::stoull("-1") == ULLONG_MAX); // negation wraps around like strtoull
+
+	CHECK(same(thrown([] { return lsd::stoi("2147483648"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stoll("9223372036854775808"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stoull("18446744073709551616"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stoi(""); }), "invalid_argument"));
+	CHECK(same(thrown([] { return lsd::stoi("x1"); }), "invalid_argument"));
+	CHECK(same(thrown([] { return lsd::stoi("+-1"); }), "invalid_argument"));
+
+	CHECK(lsd::tryStoi("123") == 123);
+	CHECK(lsd::tryStoi("abc").error() == std::errc::invalid_argument);
+	CHECK(lsd::tryStoll("99999999999999999999").error() == std::errc::result_out_of_range);
+
+	CHECK(lsd::stoi(lsd::WString(L"  -77"), &pos) == -77 && pos == 5);
+	CHECK(lsd::tryStoull(lsd::WString(L"0x10"), nullptr, 16) == 16u);
+}
+
+static void checkFloatingPoint() {
+	std::size_t pos = 0;
+
+	CHECK(lsd::stod("1e300") == 1e300);
+	CHECK(lsd::stod("1e22") == 1e22);
+	CHECK(lsd::stod("1e+5") == 1e5);
+	CHECK(lsd::stod("1E-5") == 1e-5);
+	CHECK(lsd::stod("0.1") == 0.1);
+	CHECK(lsd::stod("0.0", &pos) == 0.0 && pos == 3);
+	CHECK(lsd::stod("-0.0", &pos) == 0.0 && std::signbit(lsd::stod("-0.0")) && pos == 4);
+	CHECK(lsd::stod("  2.5abc", &pos) == 2.5 && pos == 5);
+	CHECK(lsd::stod(".5") == 0.5);
+	CHECK(lsd::stod("5.") == 5.0);
+	CHECK(lsd::stod("2.2250738585072014e-308") == DBL_MIN);
+	CHECK(lsd::stod("1.7976931348623157e308") == DBL_MAX);
+	CHECK(lsd::stod("4.9406564584124654e-324") == std::numeric_limits<double>::denorm_min());
+	CHECK(lsd::stod("0x1.8p1", &pos) == 3.0 && pos == 7);
+	CHECK(std::isinf(lsd::stod("-inf")) && lsd::stod("-inf") < 0);
+	CHECK(std::isnan(lsd::stod("nan")));
+
+	CHECK(lsd::stof("3.4028235e38") == FLT_MAX);
+	CHECK(lsd::stof("0.1") == 0.1f);
+	CHECK(lsd::stold("1e4000") > 1e300L * 1e300L); // beyond the range of double
+	CHECK(lsd::stold("0.1") == 0.1L);
+
+	CHECK(same(thrown([] { return lsd::stod("1e400"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stod("1e-400"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stof("1e39"); }), "out_of_range"));
+	CHECK(same(thrown([] { return lsd::stod(""); }), "invalid_argument"));
+	CHECK(same(thrown([] { return lsd::stod("e5"); }), "invalid_argument"));
+	CHECK(same(thrown([] { return lsd::stod("--1"); }), "invalid_argument"));
+
+	CHECK(lsd::tryStod("1e+10") == 1e10);
+	CHECK(lsd::tryStod("x").error() == std::errc::invalid_argument);
+	CHECK(lsd::tryStof("1e39").error() == std::errc::result_out_of_range);
+	CHECK(lsd::tryStold("-1.5") == -1.5L);
+
+	CHECK(lsd::stod(lsd::WString(L" 6.25e2 "), &pos) == 625.0 && pos == 7);
+	CHECK(lsd::tryStof(lsd::WString(L"1e+3")) == 1000.0f);
+}
+
+static void checkToString() {
+	CHECK(lsd::toString(0) == "0");
+	CHECK(lsd::toString(INT_MIN) == "-2147483648");
+	CHECK(lsd::toString(LLONG_MIN) == "-9223372036854775808");
+	CHECK(lsd::toString(ULLONG_MAX) == "18446744073709551615");
+	CHECK(lsd::toString(0.1) == "0.1");
+	CHECK(lsd::toString(-2.5f) == "-2.5");
+	CHECK(lsd::toString(1e300) == "1e+300");
+	CHECK(lsd::toWString(-42) == L"-42");
+	CHECK(lsd::toWString(0.5) == L"0.5");
+
+	// the shortest representation has to convert back to the same value
+	std::mt19937_64 random(61);
+
+	for (int i = 0; i < 20000; i++) {
+		auto value = std::bit_cast<double>(random());
+		if (!std::isfinite(value)) continue;
+
+		if (lsd::stod(lsd::toString(value)) != value) {
+			CHECK(lsd::stod(lsd::toString(value)) == value);
+			std::printf("%.17g -> %s\n", value, lsd::toString(value).cStr());
+			break;
+		}
+
+		auto single = std::bit_cast<float>(static_cast<std::uint32_t>(random()));
+		if (std::isfinite(single) && lsd::stof(lsd::toString(single)) != single) {
+			CHECK(lsd::stof(lsd::toString(single)) == single);
+			break;
+		}
+	}
+}
+
+int main() {
+	checkIntegers();
+	checkFloatingPoint();
+	checkToString();
+
+	std::printf("NumberConversion: %d failures\n", failures);
+	return failures != 0;
+}
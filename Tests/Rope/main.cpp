@@ -0,0 +1,116 @@
+#include <LSD/String.h>
+#include <LSD/StringView.h>
+#include <LSD/Rope.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+static lsd::StringView view(const std::string& string) {
+	return lsd::StringView(string.data(), string.size());
+}
+
+// compares the rope with the reference text, including the line lookups at every line break
+static void checkContents(const lsd::Rope& rope, const std::string& expected) {
+	CHECK(rope.size() == expected.size());
+	CHECK(rope == view(expected));
+
+	std::size_t chunkSize = 0;
+	for (auto chunk : rope.chunks()) chunkSize += chunk.size();
+	CHECK(chunkSize == expected.size());
+
+	std::size_t line = 0, lineStart = 0;
+
+	for (std::size_t pos = 0; pos <= expected.size(); pos++) {
+		if (rope.lineOf(pos) != line) {
+			CHECK(rope.lineOf(pos) == line);
+			return;
+		}
+
+		if (pos < expected.size() && rope[pos] != expected[pos]) {
+			CHECK(rope[pos] == expected[pos]);
+			return;
+		}
+
+		if (pos < expected.size() && expected[pos] == '\n') {
+			CHECK(rope.lineStart(line) == lineStart);
+			lineStart = pos + 1;
+			++line;
+		}
+	}
+
+	CHECK(rope.lineStart(line) == lineStart);
+	CHECK(rope.lineCount() == line + 1);
+}
+
+int main() {
+	// basic editing
+	{
+		lsd::Rope rope("hello world");
+
+		rope.insert(5, ",");
+		rope.insert(rope.size(), "!\nsecond line");
+		rope.insert(0, ">> ");
+		checkContents(rope, ">> hello, world!\nsecond line");
+
+		rope.erase(0, 3);
+		rope.erase(5, 1);
+		checkContents(rope, "hello world!\nsecond line");
+
+		CHECK(rope.lineOf(0) == 0);
+		CHECK(rope.lineOf(12) == 0); // the line break belongs to the line it ends
+		CHECK(rope.lineOf(13) == 1);
+		CHECK(rope.lineStart(1) == 13);
+		CHECK(rope.line(1) == "second line");
+		CHECK(rope.substr(6, 5) == "world");
+
+		rope.erase(12);
+		checkContents(rope, "hello world!");
+
+		rope.clear();
+		checkContents(rope, "");
+		CHECK(rope.empty());
+	}
+
+	// random edits against a reference string, with inserts large enough to span many chunks
+	{
+		std::mt19937 random(62);
+		std::string expected;
+		lsd::Rope rope;
+
+		auto below = [&random](std::size_t n) { return n == 0 ? 0 : random() % n; };
+
+		for (int iteration = 0; iteration < 4000; iteration++) {
+			auto pos = below(expected.size() + 1);
+
+			if (random() % 5 < 3) {
+				std::string text;
+				for (auto size = (random() % 8 == 0) ? below(3000) : below(20); text.size() < size;) text.push_back("ab\ncd"[random() % 5]);
+
+				expected.insert(pos, text);
+				rope.insert(pos, view(text));
+			} else {
+				auto count = below((random() % 8 == 0) ? 5000 : 30);
+
+				expected.erase(pos, count);
+				rope.erase(pos, count);
+			}
+
+			if (iteration % 250 == 0) checkContents(rope, expected);
+		}
+
+		checkContents(rope, expected);
+
+		lsd::Rope copy = rope;
+		CHECK(copy == rope);
+
+		copy.insert(0, "x");
+		CHECK(!(copy == rope));
+		checkContents(rope, expected);
+	}
+
+	std::printf("Rope: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,265 @@
+#include <LSD/SharedString.h>
+#include <LSD/String.h>
+#include <LSD/UnorderedSparseSet.h>
+#include <LSD/UnorderedSparseMap.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+static std::size_t liveAllocations = 0;
+
+// counts the allocations that were not freed yet
+template <class Ty> struct CountingAllocator {
+	using value_type = Ty;
+
+	CountingAllocator() = default;
+	template <class Other> CountingAllocator(const CountingAllocator<Other>&) noexcept { }
+
+	Ty* allocate(std::size_t count) {
+		++liveAllocations;
+		return std::allocator<Ty>().allocate(count);
+	}
+	void deallocate(Ty* pointer, std::size_t count) noexcept {
+		--liveAllocations;
+		std::allocator<Ty>().deallocate(pointer, count);
+	}
+
+	template <class Other> friend bool operator==(const CountingAllocator&, const CountingAllocator<Other>&) noexcept {
+		return true;
+	}
+};
+
+using CountedString = lsd::BasicSharedString<char, lsd::CharTraits<char>, CountingAllocator<char>>;
+
+static void checkLifetime() {
+	CHECK(liveAllocations == 0);
+
+	{
+		CountedString empty;
+		CHECK(empty.empty());
+		CHECK(empty.useCount() == 0);
+		CHECK(empty.data() != nullptr && empty.data()[0] == '\0');
+
+		CountedString fromEmpty("");
+		CHECK(fromEmpty.useCount() == 0);
+		CHECK(liveAllocations == 0);
+
+		CountedString string("shared characters");
+		CHECK(liveAllocations == 1);
+		CHECK(string.useCount() == 1);
+		CHECK(string == lsd::StringView("shared characters"));
+		CHECK(string.data()[string.size()] == '\0');
+
+		// copies share the allocation and count references
+		CountedString copy(string);
+		CHECK(copy.data() == string.data());
+		CHECK(string.useCount() == 2);
+
+		CountedString assigned;
+		assigned = copy;
+		CHECK(string.useCount() == 3);
+		CHECK(liveAllocations == 1);
+
+		// moves transfer the reference without counting
+		CountedString moved(std::move(assigned));
+		CHECK(assigned.empty());
+		CHECK(assigned.useCount() == 0);
+		CHECK(string.useCount() == 3);
+
+		assigned = std::move(moved);
+		CHECK(moved.empty());
+		CHECK(string.useCount() == 3);
+
+		// self assignment keeps the reference
+		auto& self = assigned;
+		assigned = self;
+		CHECK(string.useCount() == 3);
+
+		// replacing a reference releases the old one
+		assigned = CountedString("other");
+		CHECK(liveAllocations == 2);
+		CHECK(string.useCount() == 2);
+
+		copy = assigned;
+		CHECK(string.useCount() == 1);
+		CHECK(assigned.useCount() == 2);
+	}
+
+	CHECK(liveAllocations == 0);
+}
+
+static void checkThreads() {
+	{
+		CountedString string("copied from many threads at once");
+		std::vector<std::thread> threads;
+
+		// copies and releases race on the reference count
+		for (int t = 0; t < 4; t++) {
+			threads.emplace_back([string]() {
+				for (int i = 0; i < 10000; i++) {
+					CountedString copy(string);
+					auto sub = copy.substr(7, 4);
+					if (sub != lsd::StringView("from")) std::abort();
+				}
+			});
+		}
+
+		for (auto& thread : threads) thread.join();
+
+		CHECK(string.useCount() == 1);
+		CHECK(liveAllocations == 1);
+	}
+
+	CHECK(liveAllocations == 0);
+}
+
+static void checkSubstrings() {
+	CountedString sub;
+	CountedString tail;
+
+	{
+		lsd::String source("the quick brown fox");
+		CountedString parent(source);
+		CHECK(liveAllocations == 1);
+
+		sub = parent.substr(4, 5);
+		tail = parent.substr(10);
+		CHECK(parent.useCount() == 3);
+		CHECK(sub.data() == parent.data() + 4);
+
+		CHECK(parent.substr(parent.size()).empty());
+		CHECK(parent.substr(0, 1000) == parent);
+
+		auto threw = false;
+		try {
+			(void)parent.substr(parent.size() + 1);
+		} catch (const std::out_of_range&) {
+			threw = true;
+		}
+		CHECK(threw);
+	}
+
+	// the substrings keep the allocation alive after the parent and the source are gone
+	CHECK(liveAllocations == 1);
+	CHECK(sub.useCount() == 2);
+	CHECK(sub == lsd::StringView("quick"));
+	CHECK(tail == lsd::StringView("brown fox"));
+	CHECK(tail.data()[tail.size()] == '\0');
+
+	auto nested = sub.substr(1, 3);
+	CHECK(nested == lsd::StringView("uic"));
+	CHECK(nested.at(2) == 'c');
+	CHECK(sub.useCount() == 3);
+
+	sub = CountedString();
+	tail = CountedString();
+	CHECK(liveAllocations == 1);
+	CHECK(nested.useCount() == 1);
+
+	nested = CountedString();
+	CHECK(liveAllocations == 0);
+}
+
+static void checkHash() {
+	lsd::SharedString string("hash me please");
+	auto expected = lsd::Hash<lsd::StringView>()(lsd::StringView("hash me please"));
+
+	// the hash is the hash of the view, so strings and views can be mixed in lookups
+	CHECK(string.hash() == expected);
+	CHECK(string.hash() == expected);
+	CHECK(lsd::Hash<lsd::SharedString>()(string) == expected);
+	CHECK(lsd::Hash<lsd::SharedString>()(lsd::StringView("hash me please")) == expected);
+
+	// copies see the hash cached by the original
+	lsd::SharedString copy(string);
+	CHECK(copy.hash() == expected);
+
+	// substrings hash their own characters instead of using the cached value
+	auto sub = string.substr(0, 4);
+	CHECK(sub.hash() == lsd::Hash<lsd::StringView>()(lsd::StringView("hash")));
+	CHECK(sub.hash() != expected);
+	CHECK(string.substr(0).hash() == expected);
+
+	// a separate allocation with the same characters has the same hash
+	lsd::SharedString other("hash me please");
+	CHECK(other.hash() == expected);
+	CHECK(other == string);
+	CHECK(other.data() != string.data());
+
+	CHECK(lsd::SharedString().hash() == lsd::Hash<lsd::StringView>()(lsd::StringView()));
+}
+
+static void checkComparison() {
+	lsd::SharedString a("apple");
+	lsd::SharedString b("banana");
+
+	CHECK(a < b);
+	CHECK(b > a);
+	CHECK(a != b);
+	CHECK(a == lsd::StringView("apple"));
+	CHECK(a < lsd::StringView("apples"));
+	CHECK((a <=> lsd::SharedString("apple")) == 0);
+
+	lsd::SharedString text("apple pie");
+	CHECK(text.substr(0, 5) == a);
+	CHECK(text.substr(0, 5) != text);
+}
+
+static void checkContainers() {
+	lsd::UnorderedSparseSet<lsd::SharedString> set;
+	lsd::UnorderedSparseMap<lsd::SharedString, int> map;
+
+	for (int i = 0; i < 100; i++) {
+		auto key = lsd::SharedString(lsd::toString(i).append("-key"));
+
+		CHECK(set.insert(key).second);
+		CHECK(map.insert({ key, i }).second);
+	}
+
+	CHECK(set.size() == 100);
+	CHECK(!set.insert(lsd::SharedString("42-key")).second);
+
+	// views are looked up without constructing a shared string
+	for (int i = 0; i < 100; i++) {
+		auto key = lsd::toString(i).append("-key");
+		lsd::StringView view(key);
+
+		CHECK(set.contains(view));
+		auto setIt = set.find(view);
+		CHECK(setIt != set.end() && *setIt == view);
+
+		CHECK(map.contains(view));
+		auto mapIt = map.find(view);
+		CHECK(mapIt != map.end() && mapIt->second == i);
+	}
+
+	CHECK(!set.contains(lsd::StringView("100-key")));
+	CHECK(!map.contains(lsd::StringView("-key")));
+	CHECK(set.find(lsd::StringView("nope")) == set.end());
+
+	// substrings are found by their characters as well
+	lsd::SharedString text("7-key and more");
+	CHECK(set.contains(text.substr(0, 5)));
+	CHECK(map.find(text.substr(0, 5))->second == 7);
+	CHECK(!set.contains(text.substr(0, 6)));
+}
+
+int main() {
+	checkLifetime();
+	checkThreads();
+	checkSubstrings();
+	checkHash();
+	checkComparison();
+	checkContainers();
+
+	std::printf("SharedString: %d failures\n", failures);
+	return failures != 0;
+}
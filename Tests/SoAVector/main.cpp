@@ -0,0 +1,115 @@
+#include <LSD/String.h>
+#include <LSD/SoAVector.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <tuple>
+
+using Particles = lsd::SoAVector<float, double, lsd::String, char>;
+using Row = std::tuple<float, double, lsd::String, char>;
+
+static lsd::String name(unsigned i) {
+	return lsd::toString(i).append(" is a name long enough for the heap");
+}
+
+// compares the rows, the field arrays and the single field accessors with the expected rows
+static void checkContents(const Particles& particles, const std::vector<Row>& expected) {
+	CHECK(particles.size() == expected.size());
+	if (particles.size() != expected.size()) return;
+
+	for (std::size_t i = 0; i < expected.size(); i++) {
+		auto [x, y, s, c] = particles[i];
+
+		CHECK(x == std::get<0>(expected[i]));
+		CHECK(y == std::get<1>(expected[i]));
+		CHECK(s == std::get<2>(expected[i]));
+		CHECK(c == std::get<3>(expected[i]));
+
+		CHECK(particles.field<0>()[i] == x);
+		CHECK(particles.fieldData<1>()[i] == y);
+		CHECK(particles.get<2>(i) == s);
+	}
+
+	std::size_t index = 0;
+	for (auto it = particles.begin(); it != particles.end(); ++it, ++index) {
+		CHECK(it.index() == index);
+		CHECK(std::get<3>(*it) == std::get<3>(expected[index]));
+	}
+
+	CHECK(index == expected.size());
+}
+
+int main() {
+	// field arrays are separate and aligned to a cache line
+	{
+		Particles particles;
+		particles.emplaceBack(1.0f, 2.0, name(0), 'a');
+		particles.pushBack({ 3.0f, 4.0, name(1), 'b' });
+
+		CHECK(reinterpret_cast<std::uintptr_t>(particles.fieldData<0>()) % Particles::fieldAlignment == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(particles.fieldData<1>()) % Particles::fieldAlignment == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(particles.fieldData<3>()) % Particles::fieldAlignment == 0);
+
+		// rows are references to the fields
+		std::get<0>(particles[1]) = 5.0f;
+		particles.get<1>(0) = 6.0;
+		for (auto it = particles.fieldBegin<3>(); it != particles.fieldEnd<3>(); ++it) *it = 'z';
+
+		checkContents(particles, { { 1.0f, 6.0, name(0), 'z' }, { 5.0f, 4.0, name(1), 'z' } });
+
+		float sum = 0;
+		for (auto x : particles.field<0>()) sum += x;
+		CHECK(sum == 6.0f);
+	}
+
+	// random operations against a vector of rows
+	{
+		std::mt19937 random(73);
+		Particles particles;
+		std::vector<Row> expected;
+
+		for (unsigned iteration = 0; iteration < 5000; iteration++) {
+			auto operation = random() % 8;
+
+			if (operation < 4) {
+				Row row { static_cast<float>(random() % 100), static_cast<double>(random() % 1000), name(iteration), static_cast<char>('A' + random() % 26) };
+
+				if (operation == 0) particles.emplaceBack(std::get<0>(row), std::get<1>(row), std::get<2>(row), std::get<3>(row));
+				else particles.pushBack(row);
+
+				expected.push_back(row);
+			} else if (operation == 4 && !expected.empty()) {
+				auto first = random() % expected.size();
+				auto last = first + random() % (expected.size() - first + 1);
+
+				particles.erase(particles.begin() + first, particles.begin() + last);
+				expected.erase(expected.begin() + first, expected.begin() + last);
+			} else if (operation == 5 && !expected.empty()) {
+				particles.popBack();
+				expected.pop_back();
+			} else if (operation == 6) {
+				auto size = random() % 50;
+				Row fill { 1.0f, 2.0, name(size), 'f' };
+
+				particles.resize(size, fill);
+				expected.resize(size, fill);
+			} else {
+				auto copy = particles;
+				particles = std::move(copy);
+
+				if (random() % 4 == 0) particles.shrinkToFit();
+			}
+
+			if (iteration % 50 == 0) checkContents(particles, expected);
+		}
+
+		checkContents(particles, expected);
+	}
+
+	std::printf("SoAVector: %d failures\n", failures);
+	return failures != 0;
+}
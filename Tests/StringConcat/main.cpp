@@ -0,0 +1,190 @@
+#include <LSD/StringConcat.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+static void checkConcat() {
+	lsd::String string("string");
+	lsd::StringView view("view");
+	const char* cString = "c";
+
+	auto r = lsd::concat(string, ' ', view, '-', cString, "literal", 42, ':', -7, ' ', 2.5);
+	static_assert(std::is_same_v<decltype(r), lsd::String>);
+	CHECK(r == "string view-cliteral42:-7 2.5");
+	CHECK(r.size() == 29);
+
+	CHECK(lsd::concat() == "");
+	CHECK(lsd::concat("") == "");
+	CHECK(lsd::concat('x') == "x");
+	CHECK(lsd::concat(lsd::StringView()) == "");
+
+	// numbers are written in base 10 and floating point values in their shortest round trip representation
+	CHECK(lsd::concat(0) == "0");
+	CHECK(lsd::concat(INT64_MIN) == "-9223372036854775808");
+	CHECK(lsd::concat(UINT64_MAX) == "18446744073709551615");
+	CHECK(lsd::concat(static_cast<short>(-12), static_cast<unsigned char>(200)) == "-12200");
+	CHECK(lsd::concat(0.1) == "0.1");
+	CHECK(lsd::concat(0.1f) == "0.1");
+	CHECK(lsd::concat(1e300) == "1e+300");
+	CHECK(lsd::concat(-0.0) == "-0");
+	CHECK(lsd::concat(5.0) == "5");
+
+	// long results leave the small string buffer
+	lsd::String long_(100, 'a');
+	auto longResult = lsd::concat(long_, long_, 1234567890);
+	CHECK(longResult.size() == 210);
+	CHECK(longResult.substr(0, 200) == lsd::String(200, 'a'));
+	CHECK(longResult.substr(200) == "1234567890");
+}
+
+static void checkWide() {
+	lsd::WString string(L"wide");
+
+	// a single wide argument makes the result wide, numbers are widened as well
+	auto r = lsd::concat(string, L' ', L"text", 12, L'/', 0.5);
+	static_assert(std::is_same_v<decltype(r), lsd::WString>);
+	CHECK(r == L"wide text12/0.5");
+
+	static_assert(std::is_same_v<decltype(lsd::concat(1, 2)), lsd::String>);
+	static_assert(std::is_same_v<decltype(lsd::concat(1, L"x")), lsd::WString>);
+	static_assert(std::is_same_v<decltype(lsd::concat(lsd::WStringView(), 1)), lsd::WString>);
+
+	lsd::WString out(L"[");
+	lsd::appendConcat(out, -1, L',', 2u, L']');
+	CHECK(out == L"[-1,2]");
+}
+
+static void checkAppendConcat() {
+	lsd::String out;
+	out.reserve(128);
+	auto data = out.data();
+	auto capacity = out.capacity();
+
+	// reusing a string with enough capacity never reallocates
+	for (int i = 0; i < 100; i++) {
+		out.clear();
+		lsd::appendConcat(out, "item ", i, '/', 100, " done");
+
+		CHECK(out == lsd::concat("item ", i, "/100 done"));
+		CHECK(out.data() == data && out.capacity() == capacity);
+	}
+
+	// appending in a loop grows the capacity geometrically
+	lsd::String grow;
+	std::size_t reallocations = 0;
+	auto last = grow.capacity();
+
+	for (int i = 0; i < 10000; i++) {
+		lsd::appendConcat(grow, i, ',');
+
+		if (grow.capacity() != last) {
+			++reallocations;
+			last = grow.capacity();
+		}
+	}
+
+	CHECK(reallocations < 20);
+	CHECK(grow.substr(0, 10) == "0,1,2,3,4,");
+	CHECK(grow.substr(grow.size() - 5) == "9999,");
+
+	// the result is returned by reference for chaining
+	lsd::String chained("a");
+	CHECK(&lsd::appendConcat(lsd::appendConcat(chained, 'b'), 'c') == &chained);
+	CHECK(chained == "abc");
+}
+
+static void checkOperatorPlus() {
+	lsd::String a("left");
+	lsd::String b("right");
+	lsd::StringView v("view");
+
+	CHECK(a + b == "leftright");
+	CHECK(a + "!" == "left!");
+	CHECK(a + '!' == "left!");
+	CHECK(a + v == "leftview");
+	CHECK("!" + a == "!left");
+	CHECK('!' + a == "!left");
+	CHECK(v + a == "viewleft");
+	CHECK(a == "left" && b == "right");
+
+	// temporaries on the left keep their buffer if it has room for the right side
+	lsd::String left(64, 'x');
+	left.reserve(256);
+	auto data = left.data();
+
+	auto r = std::move(left) + b;
+	CHECK(r.data() == data && r == lsd::String(64, 'x') + "right");
+
+	auto moved = []() {
+		lsd::String s(64, 'x');
+		s.reserve(256);
+		return std::pair(s.data(), std::move(s));
+	};
+
+	{
+		auto [p, s] = moved();
+		auto t = std::move(s) + "lit";
+		CHECK(t.data() == p && t.size() == 67 && t.substr(64) == "lit");
+	}
+	{
+		auto [p, s] = moved();
+		auto t = std::move(s) + '!';
+		CHECK(t.data() == p && t.size() == 65 && t.back() == '!');
+	}
+	{
+		auto [p, s] = moved();
+		auto t = std::move(s) + v;
+		CHECK(t.data() == p && t.substr(64) == "view");
+	}
+	{
+		auto [p, s] = moved();
+		lsd::String other(8, 'y');
+		auto t = std::move(s) + std::move(other);
+		CHECK(t.data() == p && t.substr(64) == "yyyyyyyy");
+	}
+
+	// temporaries on the right are prepended to in place
+	{
+		auto [p, s] = moved();
+		auto t = a + std::move(s);
+		CHECK(t.data() == p && t.substr(0, 4) == "left" && t.size() == 68);
+	}
+	{
+		auto [p, s] = moved();
+		auto t = "lit" + std::move(s);
+		CHECK(t.data() == p && t.substr(0, 3) == "lit" && t.size() == 67);
+	}
+	{
+		auto [p, s] = moved();
+		auto t = '!' + std::move(s);
+		CHECK(t.data() == p && t.front() == '!' && t.size() == 65);
+	}
+	{
+		auto [p, s] = moved();
+		auto t = v + std::move(s);
+		CHECK(t.data() == p && t.substr(0, 4) == "view" && t[4] == 'x');
+	}
+
+	// every link after the first one appends to the temporary of the previous one
+	auto chain = a + '-' + b + '-' + v + "-" + lsd::String("end");
+	CHECK(chain == "left-right-view-end");
+
+	lsd::WString w(L"w");
+	CHECK(std::move(w) + L"ide" == L"wide");
+}
+
+int main() {
+	checkConcat();
+	checkWide();
+	checkAppendConcat();
+	checkOperatorPlus();
+
+	std::printf("StringConcat: %d failures\n", failures);
+	return failures != 0;
+}
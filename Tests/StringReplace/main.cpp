@@ -0,0 +1,134 @@
+#include <LSD/String.h>
+#include <LSD/StringView.h>
+#include <LSD/Vector.h>
+#include <LSD/MultiSearcher.h>
+#include <LSD/StringReplace.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <random>
+#include <utility>
+
+using Pairs = lsd::Vector<std::pair<lsd::StringView, lsd::StringView>>;
+
+// replaces by restarting a leftmost longest search after every match
+static lsd::String naiveReplace(lsd::StringView text, const Pairs& pairs) {
+	lsd::String result;
+
+	for (std::size_t pos = 0; pos < text.size();) {
+		std::size_t best = pairs.size();
+
+		for (std::size_t i = 0; i < pairs.size(); i++) {
+			auto from = pairs[i].first;
+
+			if (!from.empty() && text.size() - pos >= from.size() && text.substr(pos, from.size()) == from && (best == pairs.size() || from.size() > pairs[best].first.size()))
+				best = i;
+		}
+
+		if (best == pairs.size()) result.pushBack(text[pos++]);
+		else {
+			result.append(pairs[best].second.data(), pairs[best].second.size());
+			pos += pairs[best].first.size();
+		}
+	}
+
+	return result;
+}
+
+static void checkReplaceAll(const char* text, const char* from, const char* to, const char* expected) {
+	lsd::String string(text);
+	lsd::replaceAll(string, from, to);
+	CHECK(string == expected);
+}
+
+static void checkReplaceAll() {
+	checkReplaceAll("a.b.c", ".", "::", "a::b::c"); // growing
+	checkReplaceAll("a::b::c", "::", ".", "a.b.c"); // shrinking
+	checkReplaceAll("a::b::c", "::", "--", "a--b--c");
+	checkReplaceAll("aaaaa", "aa", "b", "bba"); // occurences do not overlap
+	checkReplaceAll("aaa", "a", "aa", "aaaaaa"); // the replacement is not searched again
+	checkReplaceAll("abc", "x", "yy", "abc");
+	checkReplaceAll("abc", "", "yy", "abc");
+	checkReplaceAll("", "a", "b", "");
+	checkReplaceAll("abcabc", "abc", "", "");
+
+	// long strings crossing the inline capacity in both directions
+	lsd::String longString;
+	for (int i = 0; i < 100; i++) longString.append("word ");
+
+	lsd::replaceAll(longString, " ", "");
+	CHECK(longString.size() == 400);
+
+	lsd::replaceAll(longString, "word", "w");
+	CHECK(longString == lsd::String(100, 'w'));
+
+	lsd::replaceAll(longString, "w", "<word>");
+	CHECK(longString.size() == 600 && longString.substr(0, 12) == "<word><word>");
+}
+
+static void checkReplaceMany() {
+	lsd::String string("the cat sat on the mat");
+	lsd::replaceMany(string, { { "cat", "dog" }, { "the", "a" }, { "mat", "rug" } });
+	CHECK(string == "a dog sat on a rug");
+
+	// the longest pattern wins at a position and replaced text is not searched again
+	string = "abcd";
+	lsd::replaceMany(string, { { "ab", "x" }, { "abc", "y" }, { "cd", "z" }, { "y", "ab" } });
+	CHECK(string == "yd");
+
+	// swapping is only possible in a single pass
+	string = "left right left";
+	lsd::replaceMany(string, { { "left", "right" }, { "right", "left" } });
+	CHECK(string == "right left right");
+
+	// identical patterns use the first replacement and empty patterns are ignored
+	string = "aXa";
+	lsd::replaceMany(string, { { "", "!" }, { "a", "1" }, { "a", "2" } });
+	CHECK(string == "1X1");
+
+	lsd::StringReplacer html { { "<", "&lt;" }, { ">", "&gt;" }, { "&", "&amp;" } };
+	CHECK(html.replaced("<a href=\"x&y\">") == "&lt;a href=\"x&amp;y\"&gt;");
+	CHECK(html.replaced("plain") == "plain");
+}
+
+// compares the replacer with the naive version for random texts over a small alphabet, which produces many overlapping matches
+static void checkRandom(std::size_t patternCount) {
+	std::mt19937 random(static_cast<unsigned>(patternCount));
+
+	auto randomString = [&random](std::size_t maxSize) {
+		lsd::String string;
+		for (auto size = random() % (maxSize + 1); string.size() < size;) string.pushBack(static_cast<char>('a' + random() % 3));
+
+		return string;
+	};
+
+	for (int iteration = 0; iteration < 300; iteration++) {
+		lsd::Vector<lsd::String> storage;
+		for (std::size_t i = 0; i < 2 * patternCount; i++) storage.pushBack(randomString(i % 2 == 0 ? 5 : 8));
+
+		Pairs pairs;
+		for (std::size_t i = 0; i < patternCount; i++) pairs.pushBack({ storage[2 * i], storage[2 * i + 1] });
+
+		lsd::StringReplacer replacer(pairs);
+
+		for (int text = 0; text < 10; text++) {
+			auto string = randomString(200);
+			auto expected = naiveReplace(string, pairs);
+
+			CHECK(replacer.replaced(string) == expected);
+			CHECK(replacer.apply(string) == expected);
+		}
+	}
+}
+
+int main() {
+	checkReplaceAll();
+	checkReplaceMany();
+
+	checkRandom(3);
+	checkRandom(lsd::MultiSearcher::teddyMaxPatterns + 8); // too many patterns for the fingerprint search
+
+	std::printf("StringReplace: %d failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,121 @@
+#include <LSD/StringSplit.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <cwctype>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+using Fields = std::initializer_list<lsd::StringView>;
+
+// compares the fields of a range with the expected views
+template <class Range, class Expected> static bool equal(const Range& range, const Expected& expected) {
+	auto it = range.begin();
+
+	for (const auto& field : expected) {
+		if (it == range.end() || *it != field) return false;
+		++it;
+	}
+
+	return it == range.end() && range.count() == expected.size() && range.empty() == (expected.size() == 0);
+}
+
+static_assert(std::forward_iterator<decltype(lsd::split(lsd::StringView(), ',').begin())>);
+static_assert(std::ranges::forward_range<decltype(lsd::split(lsd::StringView(), ','))>);
+static_assert(std::same_as<std::iter_reference_t<decltype(lsd::lines(lsd::StringView()).begin())>, lsd::StringView>);
+
+static void checkSplit() {
+	CHECK(equal(lsd::split(lsd::StringView("a,b,c"), ','), Fields { "a", "b", "c" }));
+	CHECK(equal(lsd::split(lsd::StringView(",a,,b,"), ','), Fields { "", "a", "", "b", "" }));
+	CHECK(equal(lsd::split(lsd::StringView("abc"), ','), Fields { "abc" }));
+	CHECK(equal(lsd::split(lsd::StringView(","), ','), Fields { "", "" }));
+
+	// an empty string is a single empty field
+	CHECK(equal(lsd::split(lsd::StringView(""), ','), Fields { "" }));
+	CHECK(equal(lsd::split(lsd::StringView(""), lsd::StringView("::")), Fields { "" }));
+
+	CHECK(equal(lsd::split(lsd::StringView("a::b:c::"), lsd::StringView("::")), Fields { "a", "b:c", "" }));
+	CHECK(equal(lsd::split(lsd::StringView("a:::b"), lsd::StringView("::")), Fields { "a", ":b" }));
+	CHECK(equal(lsd::split(lsd::StringView("abc"), lsd::StringView("")), Fields { "a", "b", "c" }));
+
+	// the fields are views into the source
+	lsd::String source("key=value");
+	auto range = lsd::split(source, '=');
+	auto it = range.begin();
+	CHECK(it->data() == source.data() && it->size() == 3);
+	CHECK((++it)->data() == source.data() + 4);
+}
+
+static void checkSplitAny() {
+	CHECK(equal(lsd::splitAny(lsd::StringView("a,b;c d"), lsd::StringView(",; ")), Fields { "a", "b", "c", "d" }));
+	CHECK(equal(lsd::splitAny(lsd::StringView(";;a"), lsd::StringView(",;")), Fields { "", "", "a" }));
+	CHECK(equal(lsd::splitAny(lsd::StringView("a,b"), lsd::StringView(",")), Fields { "a", "b" }));
+	CHECK(equal(lsd::splitAny(lsd::StringView("abc"), lsd::StringView("")), Fields { "abc" }));
+	CHECK(equal(lsd::splitAny(lsd::StringView(""), lsd::StringView(",;")), Fields { "" }));
+
+	// characters above 127 are looked up in the upper half of the table
+	CHECK(equal(lsd::splitAny(lsd::StringView("a\xFF" "b\x80" "c"), lsd::StringView("\x80\xFF")), Fields { "a", "b", "c" }));
+
+	auto wide = lsd::splitAny(lsd::WStringView(L"x|y/z"), lsd::WStringView(L"/|"));
+	std::vector<lsd::WStringView> fields(wide.begin(), wide.end());
+	CHECK(fields.size() == 3 && fields[0] == L"x" && fields[1] == L"y" && fields[2] == L"z");
+}
+
+static void checkLines() {
+	CHECK(equal(lsd::lines(lsd::StringView("a\nb\r\nc")), Fields { "a", "b", "c" }));
+	CHECK(equal(lsd::lines(lsd::StringView("a\n\nb\n")), Fields { "a", "", "b" }));
+	CHECK(equal(lsd::lines(lsd::StringView("\r\n")), Fields { "" }));
+	CHECK(equal(lsd::lines(lsd::StringView("a\r")), Fields { "a" }));
+	CHECK(equal(lsd::lines(lsd::StringView("")), Fields { }));
+	CHECK(equal(lsd::lines(lsd::StringView("\n\n")), Fields { "", "" }));
+}
+
+static void checkTokenize() {
+	auto space = [](char c) { return c == ' ' || c == '\t'; };
+
+	CHECK(equal(lsd::tokenize(lsd::StringView("  one two\t\tthree  "), space), Fields { "one", "two", "three" }));
+	CHECK(equal(lsd::tokenize(lsd::StringView("one"), space), Fields { "one" }));
+	CHECK(equal(lsd::tokenize(lsd::StringView("   "), space), Fields { }));
+	CHECK(equal(lsd::tokenize(lsd::StringView(""), space), Fields { }));
+
+	auto wide = lsd::tokenize(lsd::WStringView(L" a  bc "), [](wchar_t c) { return std::iswspace(c) != 0; });
+	CHECK(std::ranges::distance(wide) == 2);
+	CHECK(*std::ranges::next(wide.begin()) == L"bc");
+}
+
+static void checkIterators() {
+	auto range = lsd::split(lsd::StringView("a,b,c"), ',');
+
+	// copies of an iterator advance independently
+	auto first = range.begin();
+	auto second = first;
+	++second;
+	CHECK(*first == "a" && *second == "b");
+	CHECK(first != second);
+	CHECK(++first == second);
+
+	// the fields returned by value stay valid after the iterator moved on
+	auto it = range.begin();
+	auto field = *it++;
+	CHECK(field == "a" && *it == "b");
+
+	std::vector<lsd::StringView> fields;
+	for (auto f : range | std::views::take(2)) fields.push_back(f);
+	CHECK(fields.size() == 2 && fields[1] == "b");
+
+	CHECK(range.end() == decltype(range.begin())());
+}
+
+int main() {
+	checkSplit();
+	checkSplitAny();
+	checkLines();
+	checkTokenize();
+	checkIterators();
+
+	std::printf("StringSplit: %d failures\n", failures);
+	return failures != 0;
+}
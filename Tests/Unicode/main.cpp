@@ -0,0 +1,52 @@
+#include <LSD/String.h>
+#include <LSD/StringView.h>
+#include <LSD/Unicode.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+
+int main() {
+	// short results stay in the small string buffer, long ones are allocated
+	constexpr const char* samples[] = {
+		"",
+		"ascii",
+		"\xE4\xB8\x80\xC4\x80", // U+4E00 U+0100
+		"h\xC3\xA9llo \xF0\x9F\x98\x80", // héllo and an astral code point
+		"\xF0\x9F\x98\x80\xF0\x90\x80\x80\xF4\x8F\xBF\xBF", // only astral code points
+		"\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x81\xA8 \xF0\x9F\x98\x80 mixed with a longer ASCII tail that does not fit inline"
+	};
+
+	for (auto sample : samples) {
+		lsd::StringView utf8(sample);
+
+		CHECK(lsd::isValidUtf8(utf8));
+
+		auto utf16 = lsd::toUtf16(utf8);
+		auto utf32 = lsd::toUtf32(utf8);
+		auto wide = lsd::toWide(utf8);
+
+		CHECK(utf16.size() == (lsd::transcodedSize<char16_t>(utf8.data(), utf8.size())));
+		CHECK(utf32.size() == (lsd::transcodedSize<char32_t>(utf8.data(), utf8.size())));
+		CHECK(wide.size() == (lsd::transcodedSize<wchar_t>(utf8.data(), utf8.size())));
+
+		CHECK(lsd::toUtf8(utf16) == sample);
+		CHECK(lsd::toUtf8(utf32) == sample);
+		CHECK(lsd::toUtf8(wide) == sample);
+		CHECK(lsd::toUtf32(utf16) == utf32);
+		CHECK(lsd::toUtf16(utf32) == utf16);
+	}
+
+	auto cjk = lsd::toUtf16(lsd::StringView("\xE4\xB8\x80\xC4\x80"));
+	CHECK(cjk.size() == 2 && cjk[0] == u'一' && cjk[1] == u'Ā');
+
+	auto astral = lsd::toUtf16(lsd::U8StringView(u8"héllo \U0001F600"));
+	CHECK(astral.size() == 8 && astral[6] == 0xD83D && astral[7] == 0xDE00);
+	CHECK(lsd::toUtf32(astral).size() == 7);
+
+	CHECK(!lsd::isValidUtf8(lsd::StringView("\xC0\xAF")));
+	CHECK(lsd::findInvalidUtf8(lsd::StringView("ok\xED\xA0\x80")) == 2);
+
+	std::printf("Unicode: %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+#include <LSD/String.h>
+#include <LSD/Vector.h>
+#include <LSD/UnorderedSmallSparseSet.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <algorithm>
+
+using Set = lsd::UnorderedSmallSparseSet<lsd::String>;
+
+static lsd::String key(int i) {
+	return lsd::toString(i * 7919).append("-key-long-enough-to-allocate");
+}
+
+// compares the set against the expected insertion order and checks that every element can be found
+static void checkContents(const Set& set, const lsd::Vector<lsd::String>& expected) {
+	CHECK(set.size() == expected.size());
+	CHECK(set.isSmall() == (expected.size() <= Set::smallSize));
+	CHECK(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+	CHECK(std::equal(set.rbegin(), set.rend(), expected.rbegin(), expected.rend()));
+
+	for (const auto& value : expected) {
+		auto it = set.find(value);
+		CHECK(it != set.end() && *it == value);
+	}
+
+	CHECK(!set.contains(key(-1)));
+}
+
+int main() {
+	Set set;
+	lsd::Vector<lsd::String> expected;
+
+	// grow past the small size, switching to hashed lookups
+	for (int i = 0; i < 40; i++) {
+		CHECK(set.insert(key(i)).second);
+		CHECK(!set.insert(key(i)).second);
+		expected.pushBack(key(i));
+
+		checkContents(set, expected);
+	}
+
+	CHECK(!set.isSmall());
+	CHECK(*set.rbegin() == key(39));
+	CHECK(*set.crbegin() == key(39));
+
+	// erase single elements from the front, the middle and the back while hashed
+	for (int i : { 0, 20, 39, 5, 17 }) {
+		CHECK(set.erase(key(i)) == 1);
+		CHECK(set.erase(key(i)) == 0);
+		expected.erase(std::find(expected.begin(), expected.end(), key(i)));
+
+		checkContents(set, expected);
+	}
+
+	// erase ranges while staying above the small size
+	set.erase(set.begin() + 3, set.begin() + 10);
+	expected.erase(expected.begin() + 3, expected.begin() + 10);
+	checkContents(set, expected);
+
+	auto extracted = set.extract(set.begin() + 1);
+	CHECK(extracted == expected[1]);
+	expected.erase(expected.begin() + 1);
+	checkContents(set, expected);
+
+	// shrink back to the small size, releasing the buckets
+	while (set.size() > Set::smallSize) {
+		set.erase(set.begin() + set.size() / 2);
+		expected.erase(expected.begin() + expected.size() / 2);
+
+		checkContents(set, expected);
+	}
+
+	CHECK(set.isSmall());
+
+	// and grow past it again
+	for (int i = 100; i < 120; i++) {
+		set.insert(key(i));
+		expected.pushBack(key(i));
+
+		checkContents(set, expected);
+	}
+
+	// erasing a range which ends in the small size
+	set.erase(set.begin(), set.end() - 4);
+	expected.erase(expected.begin(), expected.end() - 4);
+	checkContents(set, expected);
+
+	// operator[] inserts missing keys and returns a reference to the stored key
+	CHECK(set[key(200)] == key(200));
+	CHECK(&set[key(200)] == &*set.find(key(200)));
+	expected.pushBack(key(200));
+	checkContents(set, expected);
+
+	set.clear();
+	expected.clear();
+	checkContents(set, expected);
+
+	std::printf("UnorderedSmallSparseSet: %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <LSD/String.h>
+#include <LSD/Vector.h>
+
+#include "../Check.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <string>
+
+// element owning heap memory which counts the living instances, so leaked or doubly destroyed elements show up
+class Tracked {
+public:
+	static inline int alive = 0;
+
+	Tracked() : Tracked(0) { }
+	Tracked(int value) : m_value(lsd::toString(value).append(" is long enough for the heap")) {
+		++alive;
+	}
+	Tracked(const Tracked& other) : m_value(other.m_value) {
+		++alive;
+	}
+	Tracked(Tracked&& other) noexcept : m_value(std::move(other.m_value)) {
+		++alive;
+	}
+	~Tracked() {
+		--alive;
+	}
+
+	Tracked& operator=(const Tracked&) = default;
+	Tracked& operator=(Tracked&&) noexcept = default;
+
+	const lsd::String& value() const noexcept {
+		return m_value;
+	}
+
+private:
+	lsd::String m_value;
+};
+
+static bool sameElements(const lsd::Vector<Tracked>& vector, const std::vector<int>& expected) {
+	if (vector.size() != expected.size()) return false;
+
+	for (std::size_t i = 0; i < expected.size(); i++)
+		if (vector[i].value() != Tracked(expected[i]).value()) return false;
+
+	return true;
+}
+
+static lsd::Vector<Tracked> makeVector(const std::vector<int>& values) {
+	lsd::Vector<Tracked> vector;
+	for (auto value : values) vector.emplaceBack(value);
+
+	return vector;
+}
+
+int main() {
+	{
+		auto vector = makeVector({ 0, 1, 2, 3, 4, 5, 6, 7 });
+
+		auto it = vector.erase(vector.begin() + 2);
+		CHECK(it == vector.begin() + 2);
+		CHECK(sameElements(vector, { 0, 1, 3, 4, 5, 6, 7 }));
+
+		it = vector.erase(vector.begin() + 1, vector.begin() + 4);
+		CHECK(it == vector.begin() + 1);
+		CHECK(sameElements(vector, { 0, 5, 6, 7 }));
+
+		vector.erase(vector.begin() + 1, vector.begin() + 1);
+		CHECK(sameElements(vector, { 0, 5, 6, 7 }));
+
+		it = vector.eraseUnordered(vector.begin());
+		CHECK(sameElements(vector, { 7, 5, 6 }));
+
+		it = vector.eraseUnordered(vector.end() - 1);
+		CHECK(it == vector.end());
+		CHECK(sameElements(vector, { 7, 5 }));
+
+		CHECK(Tracked::alive == 2);
+	}
+	CHECK(Tracked::alive == 0);
+
+	{
+		auto vector = makeVector({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+
+		CHECK(vector.eraseIf([](const Tracked& t) { return t.value()[0] % 3 == 0; }) == 4); // the first character is the digit
+		CHECK(sameElements(vector, { 1, 2, 4, 5, 7, 8 }));
+
+		CHECK(vector.eraseIf([](const Tracked&) { return false; }) == 0);
+		CHECK(sameElements(vector, { 1, 2, 4, 5, 7, 8 }));
+
+		CHECK(vector.eraseIndices({ 0, 2, 5 }) == 3);
+		CHECK(sameElements(vector, { 2, 5, 7 }));
+
+		CHECK(vector.eraseIndices(std::vector<std::size_t> { }) == 0);
+		CHECK(vector.eraseIf([](const Tracked&) { return true; }) == 3);
+		CHECK(vector.empty());
+		CHECK(Tracked::alive == 0);
+	}
+
+	// random erasures against std::vector
+	{
+		std::mt19937 random(75);
+
+		for (int iteration = 0; iteration < 500; iteration++) {
+			std::vector<int> expected;
+			for (auto size = random() % 40; expected.size() < size;) expected.push_back(static_cast<int>(random() % 10));
+
+			auto vector = makeVector(expected);
+
+			switch (random() % 3) {
+				case 0: {
+					auto first = expected.empty() ? 0 : random() % expected.size();
+					auto last = first + random() % (expected.size() - first + 1);
+
+					vector.erase(vector.begin() + first, vector.begin() + last);
+					expected.erase(expected.begin() + first, expected.begin() + last);
+					break;
+				}
+
+				case 1: {
+					auto digit = static_cast<char>('0' + random() % 10);
+
+					auto count = vector.eraseIf([digit](const Tracked& t) { return t.value()[0] == digit; });
+					CHECK(count == std::erase(expected, digit - '0'));
+					break;
+				}
+
+				case 2: {
+					std::vector<std::size_t> indices;
+					for (std::size_t i = 0; i < expected.size(); i++)
+						if (random() % 3 == 0) indices.push_back(i);
+
+					CHECK(vector.eraseIndices(indices) == indices.size());
+					for (auto it = indices.rbegin(); it != indices.rend(); ++it) expected.erase(expected.begin() + *it);
+					break;
+				}
+			}
+
+			CHECK(sameElements(vector, expected));
+			CHECK(Tracked::alive == static_cast<int>(expected.size()));
+		}
+	}
+	CHECK(Tracked::alive == 0);
+
+	std::printf("Vector: %d failures\n", failures);
+	return failures != 0;
+}